@@ -15,6 +15,10 @@
 SERIAL_PORT = "auto"  # Auto-detect ESP32
 SERIAL_BAUDRATE = 115200
 SERIAL_TIMEOUT = 5.0
+# Firmware built with -DTRANSPORT=2 (UART2 on the GPIO header): use
+# "/dev/ttyAMA0", SERIAL_BAUDRATE = 2000000 and SERIAL_RTSCTS = True, and
+# wire RTS/CTS as in esp32/README.md
+SERIAL_RTSCTS = False
 
 # Camera (USB OV5695 module)
 CAMERA_DEVICE = "/dev/video0"
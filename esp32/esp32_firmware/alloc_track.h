@@ -0,0 +1,149 @@
+#ifndef ALLOC_TRACK_H
+#define ALLOC_TRACK_H
+
+/*
+ * Post-boot heap allocation tracking (debug builds).
+ *
+ * The steady state of the firmware is meant to be heap-free: buffers are
+ * static and per-request data lives on the stack. With ALLOC_TRACKING set
+ * to 1, every heap allocation made after allocTrackArm() is counted and
+ * attributed to a call-site PC (resolve with addr2line against the ELF).
+ *
+ * - C++ operator new is always covered (exact caller PC).
+ * - malloc/realloc (Arduino String, WebServer internals) are covered when
+ *   the core is built with CONFIG_HEAP_USE_HOOKS; the PC is taken
+ *   ALLOC_TRACK_FRAME_DEPTH frames above the hook.
+ */
+
+#include <Arduino.h>
+#include <esp_heap_caps.h>
+
+#ifndef ALLOC_TRACKING
+#define ALLOC_TRACKING 0
+#endif
+
+#define ALLOC_TRACK_SITES        16
+#define ALLOC_TRACK_FRAME_DEPTH  3
+
+struct AllocSite {
+    uint32_t pc;
+    uint32_t count;
+    uint32_t bytes;
+};
+
+#if ALLOC_TRACKING
+
+#include <new>
+#include <esp_debug_helpers.h>
+#include <esp_cpu_utils.h>
+
+static volatile bool allocTrackArmed = false;
+static uint32_t allocTrackCount = 0;
+static uint32_t allocTrackBytes = 0;
+static uint32_t allocTrackUnattributed = 0;
+static AllocSite allocTrackSites[ALLOC_TRACK_SITES];
+static portMUX_TYPE allocTrackMux = portMUX_INITIALIZER_UNLOCKED;
+
+static void IRAM_ATTR allocTrackRecord(uint32_t pc, size_t size) {
+    if (!allocTrackArmed) return;
+    portENTER_CRITICAL_SAFE(&allocTrackMux);
+    allocTrackCount++;
+    allocTrackBytes += size;
+    int i = 0;
+    for (; i < ALLOC_TRACK_SITES; i++) {
+        if (allocTrackSites[i].pc == pc || allocTrackSites[i].pc == 0) break;
+    }
+    if (i < ALLOC_TRACK_SITES) {
+        allocTrackSites[i].pc = pc;
+        allocTrackSites[i].count++;
+        allocTrackSites[i].bytes += size;
+    } else {
+        allocTrackUnattributed++;
+    }
+    portEXIT_CRITICAL_SAFE(&allocTrackMux);
+}
+
+void* operator new(size_t size) {
+    allocTrackRecord((uint32_t)(uintptr_t)__builtin_return_address(0), size);
+    void* p = malloc(size);
+    if (!p) abort();
+    return p;
+}
+
+void* operator new[](size_t size) {
+    allocTrackRecord((uint32_t)(uintptr_t)__builtin_return_address(0), size);
+    void* p = malloc(size);
+    if (!p) abort();
+    return p;
+}
+
+#ifdef CONFIG_HEAP_USE_HOOKS
+// Called by the IDF heap for every malloc/calloc/realloc
+extern "C" void IRAM_ATTR esp_heap_trace_alloc_hook(void* ptr, size_t size, uint32_t caps) {
+    esp_backtrace_frame_t frame;
+    esp_backtrace_get_start(&frame.pc, &frame.sp, &frame.next_pc);
+    for (int i = 0; i < ALLOC_TRACK_FRAME_DEPTH; i++) {
+        if (!esp_backtrace_get_next_frame(&frame)) break;
+    }
+    allocTrackRecord(esp_cpu_process_stack_pc(frame.pc), size);
+}
+
+extern "C" void IRAM_ATTR esp_heap_trace_free_hook(void* ptr) {
+}
+#endif
+
+// Start counting; call once boot-time allocations are done
+void allocTrackArm() {
+    allocTrackArmed = true;
+}
+
+void allocTrackReset() {
+    portENTER_CRITICAL(&allocTrackMux);
+    allocTrackCount = 0;
+    allocTrackBytes = 0;
+    allocTrackUnattributed = 0;
+    memset(allocTrackSites, 0, sizeof(allocTrackSites));
+    portEXIT_CRITICAL(&allocTrackMux);
+}
+
+#else
+
+inline void allocTrackArm() {}
+inline void allocTrackReset() {}
+
+#endif // ALLOC_TRACKING
+
+// Formats heap state, and with tracking the post-boot allocation count
+// and busiest call sites:
+// free:<b> min:<b> largest:<b>[ psram:<b>] allocs:<n>/<b>[ sites:<pc>x<n>,...]
+int allocTrackReport(char* out, size_t size) {
+    int pos = snprintf(out, size, "free:%u min:%u largest:%u",
+                       (unsigned)heap_caps_get_free_size(MALLOC_CAP_INTERNAL),
+                       (unsigned)heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL),
+                       (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL));
+    if (psramFound() && pos < (int)size) {
+        pos += snprintf(out + pos, size - pos, " psram:%u",
+                        (unsigned)heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+    }
+#if ALLOC_TRACKING
+    if (pos < (int)size) {
+        pos += snprintf(out + pos, size - pos, " allocs:%u/%u",
+                        (unsigned)allocTrackCount, (unsigned)allocTrackBytes);
+    }
+    for (int i = 0; i < ALLOC_TRACK_SITES && allocTrackSites[i].pc && pos < (int)size; i++) {
+        pos += snprintf(out + pos, size - pos, "%s%08x x%u",
+                        i ? "," : " sites:", (unsigned)allocTrackSites[i].pc,
+                        (unsigned)allocTrackSites[i].count);
+    }
+    if (allocTrackUnattributed && pos < (int)size) {
+        pos += snprintf(out + pos, size - pos, ",other x%u", (unsigned)allocTrackUnattributed);
+    }
+#else
+    if (pos < (int)size) {
+        pos += snprintf(out + pos, size - pos, " allocs:untracked");
+    }
+#endif
+    return pos;
+}
+
+#endif // ALLOC_TRACK_H
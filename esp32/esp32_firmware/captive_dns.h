@@ -0,0 +1,67 @@
+#ifndef CAPTIVE_DNS_H
+#define CAPTIVE_DNS_H
+
+/*
+ * Captive-portal DNS answers, built in place in the query's buffer.
+ *
+ * Every A (or ANY) question in class IN is answered with the portal's
+ * address, so any name a joining phone looks up leads to the web UI.
+ * Other types (AAAA, HTTPS, ...) get an empty NOERROR answer, which makes
+ * clients fall back to A at once instead of waiting for a timeout.
+ * Additional records (EDNS) are dropped from the reply.
+ *
+ * The caller owns the socket; the network task blocks in recvfrom() and
+ * only runs when a query arrives. The header has no Arduino dependency so
+ * the host tools can build it.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define CAPTIVE_DNS_TTL_S    60
+#define CAPTIVE_DNS_MAX_LEN  512   // Classic DNS over UDP
+
+// Rewrites the query in packet (len bytes, capacity bytes of room) into
+// the reply. Returns the reply length, or 0 if the packet should be
+// dropped (not a standard query, or malformed).
+static inline size_t captiveDnsAnswer(uint8_t* packet, size_t len, size_t capacity, const uint8_t ip[4]) {
+    if (len < 12) return 0;
+    uint8_t flags = packet[2];
+    uint16_t questions = packet[4] << 8 | packet[5];
+    if ((flags & 0x80) || (flags & 0x78) || questions != 1) return 0;   // QR set, opcode != QUERY
+
+    // QNAME is a run of labels ending in a zero byte; queries carry no pointers
+    size_t pos = 12;
+    while (pos < len && packet[pos] != 0) {
+        if (packet[pos] & 0xC0) return 0;
+        pos += 1 + packet[pos];
+    }
+    pos++;   // Terminating zero
+    if (pos + 4 > len) return 0;
+    uint16_t qtype = packet[pos] << 8 | packet[pos + 1];
+    uint16_t qclass = packet[pos + 2] << 8 | packet[pos + 3];
+    pos += 4;
+
+    bool answer = (qtype == 1 || qtype == 255) && qclass == 1;
+    if (answer && pos + 16 > capacity) return 0;
+
+    packet[2] = 0x84 | (flags & 0x01);   // QR, AA, RD as asked
+    packet[3] = 0x00;                    // RA clear, NOERROR
+    packet[6] = 0;
+    packet[7] = answer ? 1 : 0;          // ANCOUNT
+    memset(packet + 8, 0, 4);            // NSCOUNT, ARCOUNT
+    if (!answer) return pos;
+
+    const uint8_t record[12] = {
+        0xC0, 0x0C,                      // Name: pointer to the question
+        0x00, 0x01, 0x00, 0x01,          // A, IN
+        0, 0, CAPTIVE_DNS_TTL_S >> 8, CAPTIVE_DNS_TTL_S & 0xFF,
+        0x00, 0x04,                      // RDLENGTH
+    };
+    memcpy(packet + pos, record, sizeof(record));
+    memcpy(packet + pos + sizeof(record), ip, 4);
+    return pos + sizeof(record) + 4;
+}
+
+#endif // CAPTIVE_DNS_H
@@ -0,0 +1,163 @@
+#ifndef CMD_STATS_H
+#define CMD_STATS_H
+
+/*
+ * Per-command serial protocol statistics.
+ *
+ * Every frame is split into four phases, each with its own histogram:
+ *   rx       first header byte parsed -> frame complete (wire + queueing)
+ *   crc      CRC check
+ *   handler  command handler, excluding response output
+ *   tx       writing the response into the UART TX buffer
+ * plus request/response byte counts and the number of ERR replies.
+ *
+ * Slots are claimed by command name on first use, but only for a known
+ * command whose CRC checked out: the name came off the wire and goes into
+ * JSON and metric labels as is. Everything else (CRC failures, oversized
+ * and unknown commands) shares the last slot, "other". Only the protocol
+ * task parses frames and sends responses, so nothing here is synchronized.
+ */
+
+#include <Arduino.h>
+#include "histogram.h"
+#include "transport.h"
+
+#define CMD_STATS_SLOTS    16
+#define CMD_STATS_NAME_LEN 8
+#define CMD_STATS_OTHER    (CMD_STATS_SLOTS - 1)
+
+struct CmdStats {
+    char name[CMD_STATS_NAME_LEN];
+    uint32_t count;
+    uint32_t errors;
+    uint64_t bytesIn;
+    uint64_t bytesOut;
+    LogHistogram rxUs;
+    LogHistogram crcUs;
+    LogHistogram handlerUs;
+    LogHistogram txUs;
+};
+
+// The frame being received or handled
+struct CmdFrame {
+    int slot;              // -1 until dispatched
+    uint32_t bytesIn;
+    uint32_t bytesOut;
+    int64_t rxStartUs;
+    int64_t dispatchUs;
+    int64_t crcDoneUs;
+    uint32_t txUs;
+    bool error;
+};
+
+static CmdStats cmdStats[CMD_STATS_SLOTS];
+static CmdFrame cmdFrame = {-1};
+static uint32_t cmdStatsSinceMs = 0;
+
+inline int cmdStatsSlot(const char* name) {
+    for (int i = 0; i < CMD_STATS_OTHER; i++) {
+        if (cmdStats[i].name[0] == '\0') {
+            strncpy(cmdStats[i].name, name, CMD_STATS_NAME_LEN - 1);
+            return i;
+        }
+        if (strncmp(cmdStats[i].name, name, CMD_STATS_NAME_LEN - 1) == 0) return i;
+    }
+    return CMD_STATS_OTHER;
+}
+
+// Parser: one call per received byte
+inline void cmdStatsByte() {
+    if (cmdFrame.bytesIn++ == 0) cmdFrame.rxStartUs = esp_timer_get_time();
+}
+
+// processCommand: frame complete, about to check the CRC. It counts as
+// "other" until cmdStatsCommand() names it.
+inline void cmdStatsDispatch() {
+    strcpy(cmdStats[CMD_STATS_OTHER].name, "other");
+    cmdFrame.slot = CMD_STATS_OTHER;
+    cmdFrame.dispatchUs = esp_timer_get_time();
+    cmdFrame.crcDoneUs = cmdFrame.dispatchUs;
+}
+
+// processCommand: CRC checked, handler starts
+inline void cmdStatsCrcDone() {
+    cmdFrame.crcDoneUs = esp_timer_get_time();
+}
+
+// processCommand: a known command with a good CRC was handled
+inline void cmdStatsCommand(const char* name) {
+    cmdFrame.slot = cmdStatsSlot(name);
+}
+
+// sendResponse: bytes written and time spent writing them
+inline void cmdStatsResponse(uint32_t bytes, uint32_t us, bool error) {
+    if (cmdFrame.slot < 0) return;
+    cmdFrame.bytesOut += bytes;
+    cmdFrame.txUs += us;
+    cmdFrame.error |= error;
+}
+
+// Parser: drop a partial frame without recording it
+inline void cmdStatsDiscard() {
+    cmdFrame = CmdFrame{-1};
+}
+
+// Parser: the frame has been handled
+inline void cmdStatsEnd() {
+    if (cmdFrame.slot >= 0) {
+        CmdStats& s = cmdStats[cmdFrame.slot];
+        int64_t end = esp_timer_get_time();
+        int64_t handler = end - cmdFrame.crcDoneUs - cmdFrame.txUs;
+        s.count++;
+        if (cmdFrame.error) s.errors++;
+        s.bytesIn += cmdFrame.bytesIn;
+        s.bytesOut += cmdFrame.bytesOut;
+        s.rxUs.record((uint32_t)(cmdFrame.dispatchUs - cmdFrame.rxStartUs));
+        s.crcUs.record((uint32_t)(cmdFrame.crcDoneUs - cmdFrame.dispatchUs));
+        s.handlerUs.record(handler > 0 ? (uint32_t)handler : 0);
+        s.txUs.record(cmdFrame.txUs);
+    }
+    cmdStatsDiscard();
+}
+
+inline void cmdStatsReset() {
+    memset(cmdStats, 0, sizeof(cmdStats));
+    cmdStatsSinceMs = millis();
+}
+
+static int cmdStatsHist(char* out, size_t size, const char* key, const LogHistogram& h) {
+    return snprintf(out, size, ",\"%s\":[%u,%u,%u,%u]", key, (unsigned)h.average(),
+                    (unsigned)h.percentile(50), (unsigned)h.percentile(99), (unsigned)h.max);
+}
+
+// Single-line JSON; each histogram is [avg, p50, p99, max] in microseconds:
+// {"since_ms":<ms>,"link":{"transport":"uart0|uart2|usb","baud":<n>},
+//  "commands":{"MVEL":{"n":..,"err":..,"in":..,"out":..,
+//  "rx":[..],"crc":[..],"handler":[..],"tx":[..]},...}}
+int cmdStatsReport(char* out, size_t size) {
+    int pos = snprintf(out, size,
+                       "{\"since_ms\":%lu,\"link\":{\"transport\":\"%s\",\"baud\":%lu},\"commands\":{",
+                       (unsigned long)(millis() - cmdStatsSinceMs), TRANSPORT_NAME,
+                       (unsigned long)TRANSPORT_BAUD);
+    bool first = true;
+    for (int i = 0; i < CMD_STATS_SLOTS && pos < (int)size; i++) {
+        const CmdStats& s = cmdStats[i];
+        if (s.count == 0) continue;
+        pos += snprintf(out + pos, size - pos,
+                        "%s\"%s\":{\"n\":%u,\"err\":%u,\"in\":%llu,\"out\":%llu",
+                        first ? "" : ",", s.name, (unsigned)s.count, (unsigned)s.errors,
+                        (unsigned long long)s.bytesIn, (unsigned long long)s.bytesOut);
+        if (pos < (int)size) pos += cmdStatsHist(out + pos, size - pos, "rx", s.rxUs);
+        if (pos < (int)size) pos += cmdStatsHist(out + pos, size - pos, "crc", s.crcUs);
+        if (pos < (int)size) pos += cmdStatsHist(out + pos, size - pos, "handler", s.handlerUs);
+        if (pos < (int)size) pos += cmdStatsHist(out + pos, size - pos, "tx", s.txUs);
+        if (pos < (int)size) pos += snprintf(out + pos, size - pos, "}");
+        first = false;
+    }
+    if (pos < (int)size) pos += snprintf(out + pos, size - pos, "}}");
+    // A truncated report is not valid JSON; say so instead
+    if (pos >= (int)size) pos = snprintf(out, size, "{\"error\":\"stats truncated\"}");
+    return pos;
+}
+
+#endif // CMD_STATS_H
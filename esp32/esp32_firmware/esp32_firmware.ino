@@ -2,12 +2,20 @@
  * ESP32 Combined Firmware for Spherical Robot with Web Portal
  * 
  * Features:
- * - Serial communication with Pi5 using protocol
- * - Motor control (A1, A2, B1, B2 on GPIO 18, 19, 5, 17)
+ * - Serial communication with Pi5 using protocol (UART0, UART2 with flow
+ *   control, or native USB on the S3; see transport.h)
+ * - Motor control (A1, A2, B1, B2 on GPIO 18, 19, 5, 4)
  * - E-Paper display control (4.2" V2 on SPI pins)
  * - WiFi Access Point with Web Portal for image upload
  * - Command protocol: <CMD><PARAM_LENGTH>\n<DATA>\n<CRC>\n
  * 
+ * Tasks (FreeRTOS, see Task Configuration):
+ * - motor    (core 1, highest priority): applies motor commands, enforces timeouts
+ * - protocol (core 1): parses serial frames and dispatches commands
+ * - display  (core 0): EPD init/refresh jobs, never blocks the protocol
+ * - network  (core 0): brings up the access point, answers captive DNS
+ * - httpd    (core 0): esp_http_server, serves web clients concurrently
+ * 
  * Motor Commands:
  * - MVEL: Motor velocity (left, right, duration_ms)
  * - MSTOP: Emergency stop
@@ -21,12 +29,45 @@
  * - SRESET: Soft reset
  * - SHALT: Enter deep sleep
  * - SPING: Heartbeat/ping
+ * - STASKS: Per-task stack high-water marks and CPU time
+ * - SSCHED: Scheduler timer count and lateness statistics
+ * - SHEAP: Heap free/minimum/largest block and post-boot allocations
+ * - SPROF: Per-subsystem latency histograms ("reset" clears them)
+ * - SSTATS: Per-command protocol timing and byte counts as JSON
+ * - STRACE: Dump the event trace ring (base64, see esp_serial/trace.py)
+ * - SBENCH: On-target microbenchmarks in CPU cycles (EPD shift, CRC,
+ *   memcpy, PWM writes, UART loopback)
+ *
+ * Web endpoints: / (UI), /upload, /clear, /motor, /preview, /profile, /metrics
+ * WebSocket: /ws/motor (joystick frames with a motion lease),
+ *            /ws/telemetry (JSON state pushed every sample)
  */
 
 #include <Arduino.h>
 #include <WiFi.h>
-#include <WebServer.h>
-#include <DNSServer.h>
+#include <esp_http_server.h>
+#include <unistd.h>
+#include <lwip/sockets.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
+#include <freertos/semphr.h>
+#include <driver/uart.h>
+#include <esp_cpu.h>
+#include <atomic>
+
+#include "transport.h"
+#include "log.h"
+#include "spsc.h"
+#include "timer_wheel.h"
+#include "alloc_track.h"
+#include "profiler.h"
+#include "cmd_stats.h"
+#include "trace.h"
+#include "metrics.h"
+#include "frame_preview.h"
+#include "captive_dns.h"
+#include "web_assets.h"   // Web UI, gzip-compressed from web_page.h
 
 // ===========================================
 // WiFi Access Point Configuration
@@ -40,26 +81,56 @@ IPAddress AP_LOCAL_IP(192, 168, 4, 1);
 IPAddress AP_GATEWAY(192, 168, 4, 1);
 IPAddress AP_SUBNET(255, 255, 255, 0);
 
-// Web Server
-WebServer server(80);
-DNSServer dnsServer;
-const byte DNS_PORT = 53;
+// Web Server (esp_http_server, runs its own task)
+httpd_handle_t httpServer = nullptr;
+const uint16_t DNS_PORT = 53;
+
+// Captive DNS, written only by the network task
+uint32_t dnsAnswered = 0;
+uint32_t dnsDropped = 0;
+
+#if configGENERATE_RUN_TIME_STATS
+// lwIP and WiFi driver tasks. Their core is an sdkconfig choice
+// (CONFIG_LWIP_TCPIP_TASK_AFFINITY_CPU0, CONFIG_ESP_WIFI_TASK_PINNED_TO_CORE_0);
+// their CPU time comes from the FreeRTOS run-time counter (esp_timer us).
+struct NetSysTask {
+    const char* name;
+    TaskHandle_t handle;   // Resolved by the network task once the AP is up
+};
+NetSysTask netSysTasks[] = {
+    {"tiT", nullptr},
+    {"wifi", nullptr},
+};
+#endif
 
 // ===========================================
 // Motor Configuration
 // ===========================================
+// The ESP32-S3 has no GPIO 22-25 and uses 19/20 for native USB, so it
+// takes the pinout of the original S3 motor sketch
+#if CONFIG_IDF_TARGET_ESP32S3
+#define MOTOR_A1 1
+#define MOTOR_A2 2
+#define MOTOR_B1 42
+#define MOTOR_B2 41
+#else
 // Motor A pins (Left Motor) - Updated pinout
 #define MOTOR_A1 18
 #define MOTOR_A2 19
 
 // Motor B pins (Right Motor) - Updated pinout
 #define MOTOR_B1 5
-#define MOTOR_B2 17
+#define MOTOR_B2 4   // GPIO 17 is the UART2 TX to the Pi
+#endif
 
 // PWM properties
 #define PWM_FREQ 5000
 #define PWM_RESOLUTION 8
 
+// Battery sense: ADC pin behind a resistor divider, -1 if not fitted
+#define BATTERY_ADC_PIN   -1
+#define BATTERY_DIVIDER   2     // Battery voltage / pin voltage
+
 // ===========================================
 // E-Paper Display Configuration (4.2" V2)
 // ===========================================
@@ -68,6 +139,15 @@ const byte DNS_PORT = 53;
 #define IMAGE_BUFFER_SIZE  15000  // 400*300/8
 
 // SPI Pin definitions
+#if CONFIG_IDF_TARGET_ESP32S3
+#define PIN_SPI_SCK   12  // Clock
+#define PIN_SPI_DIN   11  // MOSI (Data In)
+#define PIN_SPI_CS    10  // Chip Select
+#define PIN_SPI_BUSY  9   // Busy signal (INPUT)
+#define PIN_SPI_RST   8   // Reset
+#define PIN_SPI_DC    7   // Data/Command
+#define PIN_SPI_PWR   6   // Power control
+#else
 #define PIN_SPI_SCK   13  // Clock
 #define PIN_SPI_DIN   14  // MOSI (Data In)
 #define PIN_SPI_CS    15  // Chip Select
@@ -75,437 +155,276 @@ const byte DNS_PORT = 53;
 #define PIN_SPI_RST   26  // Reset
 #define PIN_SPI_DC    27  // Data/Command
 #define PIN_SPI_PWR   33  // Power control
+#endif
 
 // ===========================================
 // Protocol Configuration
 // ===========================================
-#define SERIAL_BAUD 115200
 #define MAX_COMMAND_SIZE 15050  // Max data size (image + overhead)
 #define CMD_TIMEOUT_MS 5000
 
 // CRC-CCITT polynomial
 #define CRC_POLYNOMIAL 0x1021
 
+// ===========================================
+// Task Configuration
+// ===========================================
+// Core 1 carries the real-time work (motor, protocol). Core 0 shares
+// time with the WiFi stack and carries the slow work (display, network),
+// so an EPD refresh or a stalled HTTP client never delays a motor command.
+// Nothing network-related polls: the network task sleeps in recvfrom()
+// and httpd in select() until a packet arrives.
+#define MOTOR_TASK_CORE      1
+#define MOTOR_TASK_PRIO      5
+#define MOTOR_TASK_STACK     3072
+
+#define PROTOCOL_TASK_CORE   1
+#define PROTOCOL_TASK_PRIO   4
+#define PROTOCOL_TASK_STACK  4096
+
+#define DISPLAY_TASK_CORE    0
+#define DISPLAY_TASK_PRIO    2
+#define DISPLAY_TASK_STACK   4096
+
+#define NETWORK_TASK_CORE    0
+#define NETWORK_TASK_PRIO    1
+#define NETWORK_TASK_STACK   3072
+
+// esp_http_server task: multiplexes all client sockets with select(), so a
+// slow client only costs a socket, not the server. Handlers stream request
+// bodies in HTTP_RECV_CHUNK pieces.
+#define HTTP_TASK_CORE       0
+#define HTTP_TASK_PRIO       1
+#define HTTP_TASK_STACK      8192
+#define HTTP_MAX_CLIENTS     5
+#define HTTP_RECV_CHUNK      1460   // One TCP segment
+#define HTTP_RECV_TIMEOUT_S  5      // Per recv, not per request
+
+// WebSocket motor channel (/ws/motor): binary frames of int16 left, int16
+// right, uint16 lease_ms, little-endian. Each frame renews the motion
+// lease, so the motors stop by themselves once frames stop arriving.
+#define MOTOR_WS_FRAME_LEN   6
+#define MOTOR_LEASE_MAX_MS   500
+
+// Telemetry push (/ws/telemetry): every sample goes to each subscriber,
+// at most at the rate it asked for (?hz=). A client whose socket cannot
+// take a frame right now misses that sample instead of blocking the server.
+#define TELEMETRY_MAX_CLIENTS  HTTP_MAX_CLIENTS
+#define TELEMETRY_FRAME_SIZE   384
+
+#if !CONFIG_HTTPD_WS_SUPPORT
+#error "esp_http_server must be built with WebSocket support (CONFIG_HTTPD_WS_SUPPORT)"
+#endif
+
+// Runs timer callbacks; they only post to other tasks, so it can sit
+// above the motor task without delaying it
+#define SCHED_TASK_CORE      1
+#define SCHED_TASK_PRIO      6
+#define SCHED_TASK_STACK     3072
+
+// Bounded queues between tasks
+#define MOTOR_RING_LEN       8     // Per producer, power of two
+#define UART_RX_RING_LEN     4096  // UART event task -> protocol task, power of two
+#define DISPLAY_QUEUE_LEN    2
+
+// ===========================================
+// Scheduler Configuration
+// ===========================================
+#define SCHED_TICK_US              1000   // Hardware timer period, one wheel tick
+#define SCHED_MAX_EXPIRED          16     // Callbacks fired per tick, extras slip a tick
+#define SCHED_MS_TO_TICKS(ms)      (((uint32_t)(ms) * 1000 + SCHED_TICK_US - 1) / SCHED_TICK_US)
+
+#define DISPLAY_IDLE_SLEEP_MS      60000  // Cut EPD power after this long without jobs
+#define TELEMETRY_PERIOD_MS        200    // Telemetry sample and push rate
+#define LINK_HEARTBEAT_TIMEOUT_MS  0      // Stop motors if the host is silent this long (0 = off)
+
+// ===========================================
+// Self-Benchmark Configuration (SBENCH)
+// ===========================================
+#define BENCH_RUNS            3        // Per test; the fastest run is reported
+#define BENCH_EPD_BYTES       1024     // Shifted out with the panel deselected
+#define BENCH_MEMCPY_INTERNAL 8192
+#define BENCH_MEMCPY_PSRAM    65536    // Twice the PSRAM cache, so the copy misses
+#define BENCH_LEDC_WRITES     64
+#define BENCH_UART            UART_NUM_1
+#define BENCH_UART_BAUD       1000000
+#define BENCH_UART_BYTES      512      // About 5 ms a run at BENCH_UART_BAUD
+#define BENCH_WAIT_MS         50       // For the display and motor tasks' tests
+#define BENCH_LOCK_MS         20       // For the frame buffer, held through a display load
+#define BENCH_BUDGET_MS       150      // Tests not started by then report skipped
+#define BENCH_FAILED          UINT32_MAX  // Cycles of a test that could not run
+
 // ===========================================
 // Global Variables
 // ===========================================
-// Image buffer
-uint8_t* imageBuffer = nullptr;
+// Image buffer (guarded by frameMutex while being written or sent to the EPD).
+// Static so the steady state never touches the heap.
+uint8_t imageBuffer[IMAGE_BUFFER_SIZE];
 uint16_t bufferIndex = 0;
 bool bufferReady = false;
 bool uploadInProgress = false;
+SemaphoreHandle_t frameMutex = nullptr;
 
 // Command buffer
 char cmdBuffer[16];
 uint8_t dataBuffer[MAX_COMMAND_SIZE];
+char crcBuffer[8];
 int cmdIndex = 0;
 int dataIndex = 0;
+int crcIndex = 0;
 int expectedDataLength = 0;
-bool receivingData = false;
 
-// Motor state
+// Frame parser state: <CMD><LEN>\n<DATA>\n<CRC>\n
+enum ParseState : uint8_t {
+    PARSE_HEADER,
+    PARSE_DATA,
+    PARSE_DATA_END,
+    PARSE_CRC
+};
+
+ParseState parseState = PARSE_HEADER;
+uint32_t frameTimeouts = 0;   // Partial frames dropped after CMD_TIMEOUT_MS
+
+// Raw bytes from the UART event task, drained by the protocol task
+SpscRing<uint8_t, UART_RX_RING_LEN> uartRxRing;
+
+// Motor state (owned by the motor task)
 int motorSpeed = 200;
 bool motorsRunning = false;
 unsigned long motorStopTime = 0;
 
-// ===========================================
-// HTML Web Interface
-// ===========================================
-const char* HTML_PAGE = R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-    <meta charset="UTF-8">
-    <meta name="viewport" content="width=device-width, initial-scale=1.0">
-    <title>Spherical Robot - E-Paper Control</title>
-    <style>
-        * { margin: 0; padding: 0; box-sizing: border-box; }
-        body {
-            font-family: -apple-system, BlinkMacSystemFont, 'Segoe UI', Roboto, sans-serif;
-            background: #1a1a2e;
-            color: #fff;
-            padding: 20px;
-            max-width: 600px;
-            margin: 0 auto;
-        }
-        h1 {
-            text-align: center;
-            color: #00d4ff;
-            margin-bottom: 30px;
-            font-size: 24px;
-        }
-        .card {
-            background: #16213e;
-            border-radius: 10px;
-            padding: 20px;
-            margin-bottom: 20px;
-            border: 1px solid #0f3460;
-        }
-        h2 {
-            color: #e94560;
-            margin-bottom: 15px;
-            font-size: 18px;
-        }
-        .upload-area {
-            border: 2px dashed #0f3460;
-            border-radius: 10px;
-            padding: 40px;
-            text-align: center;
-            cursor: pointer;
-            transition: all 0.3s;
-            margin-bottom: 15px;
-        }
-        .upload-area:hover {
-            border-color: #00d4ff;
-            background: rgba(0, 212, 255, 0.05);
-        }
-        .upload-area.dragover {
-            border-color: #00d4ff;
-            background: rgba(0, 212, 255, 0.1);
-        }
-        .upload-icon {
-            font-size: 48px;
-            margin-bottom: 10px;
-        }
-        .upload-text {
-            color: #888;
-            font-size: 14px;
-        }
-        input[type="file"] {
-            display: none;
-        }
-        .btn {
-            background: #0f3460;
-            color: #fff;
-            border: none;
-            padding: 12px 24px;
-            border-radius: 5px;
-            cursor: pointer;
-            font-size: 14px;
-            width: 100%;
-            transition: background 0.3s;
-        }
-        .btn:hover {
-            background: #1a5490;
-        }
-        .btn:disabled {
-            background: #333;
-            cursor: not-allowed;
-        }
-        .btn-primary {
-            background: #00d4ff;
-            color: #000;
-        }
-        .btn-primary:hover {
-            background: #33ddff;
-        }
-        .btn-danger {
-            background: #e94560;
-        }
-        .btn-danger:hover {
-            background: #ff6b6b;
-        }
-        .status {
-            padding: 10px;
-            border-radius: 5px;
-            margin-top: 10px;
-            font-size: 14px;
-            display: none;
-        }
-        .status.success {
-            display: block;
-            background: rgba(46, 204, 113, 0.2);
-            color: #2ecc71;
-        }
-        .status.error {
-            display: block;
-            background: rgba(231, 76, 60, 0.2);
-            color: #e74c3c;
-        }
-        .status.uploading {
-            display: block;
-            background: rgba(0, 212, 255, 0.2);
-            color: #00d4ff;
-        }
-        .preview {
-            max-width: 100%;
-            border-radius: 5px;
-            margin-top: 15px;
-            display: none;
-        }
-        .info {
-            background: rgba(0, 212, 255, 0.1);
-            border-left: 3px solid #00d4ff;
-            padding: 10px;
-            margin-top: 15px;
-            font-size: 12px;
-            color: #888;
-        }
-        .motor-controls {
-            display: grid;
-            grid-template-columns: repeat(3, 1fr);
-            gap: 10px;
-            margin-top: 15px;
-        }
-        .motor-btn {
-            padding: 20px;
-            font-size: 24px;
-            background: #0f3460;
-            border: none;
-            border-radius: 5px;
-            cursor: pointer;
-            color: #fff;
-        }
-        .motor-btn:hover {
-            background: #1a5490;
-        }
-        .motor-btn.stop {
-            background: #e94560;
-        }
-        .motor-btn.stop:hover {
-            background: #ff6b6b;
-        }
-    </style>
-</head>
-<body>
-    <h1>🤖 Spherical Robot Control</h1>
-    
-    <div class="card">
-        <h2>📷 Image Upload</h2>
-        <div class="upload-area" id="uploadArea" onclick="document.getElementById('fileInput').click()">
-            <div class="upload-icon">📁</div>
-            <div class="upload-text">
-                Click or drag image here<br>
-                <small>Supports JPG, PNG, BMP (will be converted to 400x300 B&W)</small>
-            </div>
-        </div>
-        <input type="file" id="fileInput" accept="image/*" onchange="handleFileSelect(event)">
-        <img id="preview" class="preview">
-        <button class="btn btn-primary" id="uploadBtn" onclick="uploadImage()" disabled>📤 Upload to Display</button>
-        <button class="btn btn-danger" onclick="clearDisplay()">🗑 Clear Display</button>
-        <div id="status" class="status"></div>
-        <div class="info">
-            <strong>Tip:</strong> Images will be automatically resized to 400x300 and converted to black & white using Floyd-Steinberg dithering for best results on E-Paper display.
-        </div>
-    </div>
-    
-    <div class="card">
-        <h2>🎮 Motor Control</h2>
-        <div class="motor-controls">
-            <div></div>
-            <button class="motor-btn" onclick="sendCommand('forward')">⬆</button>
-            <div></div>
-            <button class="motor-btn" onclick="sendCommand('left')">⬅</button>
-            <button class="motor-btn stop" onclick="sendCommand('stop')">⏹</button>
-            <button class="motor-btn" onclick="sendCommand('right')">➡</button>
-            <div></div>
-            <button class="motor-btn" onclick="sendCommand('backward')">⬇</button>
-            <div></div>
-        </div>
-    </div>
-    
-    <script>
-        let selectedFile = null;
-        let canvas = document.createElement('canvas');
-        let ctx = canvas.getContext('2d');
-        
-        // Drag and drop
-        const uploadArea = document.getElementById('uploadArea');
-        
-        uploadArea.addEventListener('dragover', (e) => {
-            e.preventDefault();
-            uploadArea.classList.add('dragover');
-        });
-        
-        uploadArea.addEventListener('dragleave', () => {
-            uploadArea.classList.remove('dragover');
-        });
-        
-        uploadArea.addEventListener('drop', (e) => {
-            e.preventDefault();
-            uploadArea.classList.remove('dragover');
-            const files = e.dataTransfer.files;
-            if (files.length > 0) {
-                handleFile(files[0]);
-            }
-        });
-        
-        function handleFileSelect(event) {
-            const file = event.target.files[0];
-            if (file) {
-                handleFile(file);
-            }
-        }
-        
-        function handleFile(file) {
-            selectedFile = file;
-            
-            // Show preview
-            const reader = new FileReader();
-            reader.onload = (e) => {
-                const img = new Image();
-                img.onload = () => {
-                    document.getElementById('preview').src = e.target.result;
-                    document.getElementById('preview').style.display = 'block';
-                    document.getElementById('uploadBtn').disabled = false;
-                };
-                img.src = e.target.result;
-            };
-            reader.readAsDataURL(file);
-            
-            showStatus('Image selected: ' + file.name, 'uploading');
-        }
-        
-        function uploadImage() {
-            if (!selectedFile) return;
-            
-            const statusEl = document.getElementById('status');
-            statusEl.className = 'status uploading';
-            statusEl.textContent = 'Processing image...';
-            statusEl.style.display = 'block';
-            
-            const reader = new FileReader();
-            reader.onload = (e) => {
-                const img = new Image();
-                img.onload = () => {
-                    // Process image
-                    processAndUpload(img);
-                };
-                img.src = e.target.result;
-            };
-            reader.readAsDataURL(selectedFile);
-        }
-        
-        function processAndUpload(img) {
-            // Resize to 400x300
-            canvas.width = 400;
-            canvas.height = 300;
-            
-            // Draw and resize
-            ctx.drawImage(img, 0, 0, 400, 300);
-            
-            // Get image data
-            const imageData = ctx.getImageData(0, 0, 400, 300);
-            const data = imageData.data;
-            
-            // Convert to 1-bit with Floyd-Steinberg dithering
-            const binaryData = floydSteinbergDither(data, 400, 300);
-            
-            // Upload to server - send raw binary data
-            fetch('/upload', {
-                method: 'POST',
-                headers: {
-                    'Content-Type': 'application/octet-stream',
-                    'Content-Length': binaryData.length
-                },
-                body: binaryData
-            })
-            .then(response => response.text())
-            .then(result => {
-                showStatus('✓ ' + result, 'success');
-            })
-            .catch(error => {
-                showStatus('✗ Error: ' + error.message, 'error');
-            });
-        }
-        
-        function floydSteinbergDither(data, width, height) {
-            // Convert to grayscale first
-            const gray = new Float32Array(width * height);
-            for (let i = 0; i < width * height; i++) {
-                const r = data[i * 4];
-                const g = data[i * 4 + 1];
-                const b = data[i * 4 + 2];
-                gray[i] = r * 0.299 + g * 0.587 + b * 0.114;
-            }
-            
-            // Apply Floyd-Steinberg dithering
-            for (let y = 0; y < height; y++) {
-                for (let x = 0; x < width; x++) {
-                    const idx = y * width + x;
-                    const oldPixel = gray[idx];
-                    const newPixel = oldPixel < 128 ? 0 : 255;
-                    const error = oldPixel - newPixel;
-                    gray[idx] = newPixel;
-                    
-                    // Distribute error
-                    if (x + 1 < width) {
-                        gray[idx + 1] += error * 7 / 16;
-                    }
-                    if (x - 1 >= 0 && y + 1 < height) {
-                        gray[idx + width - 1] += error * 3 / 16;
-                    }
-                    if (y + 1 < height) {
-                        gray[idx + width] += error * 5 / 16;
-                    }
-                    if (x + 1 < width && y + 1 < height) {
-                        gray[idx + width + 1] += error * 1 / 16;
-                    }
-                }
-            }
-            
-            // Pack into bytes (1 bit per pixel, 0=black, 1=white)
-            const packed = new Uint8Array(width * height / 8);
-            for (let i = 0; i < width * height; i++) {
-                const byteIdx = Math.floor(i / 8);
-                const bitIdx = 7 - (i % 8);
-                if (gray[i] < 128) {
-                    packed[byteIdx] &= ~(1 << bitIdx);
-                } else {
-                    packed[byteIdx] |= (1 << bitIdx);
-                }
-            }
-            
-            return packed;
-        }
-        
-        function clearDisplay() {
-            fetch('/clear', {method: 'POST'})
-            .then(response => response.text())
-            .then(result => {
-                showStatus('✓ ' + result, 'success');
-                document.getElementById('preview').style.display = 'none';
-                document.getElementById('uploadBtn').disabled = true;
-                selectedFile = null;
-            })
-            .catch(error => {
-                showStatus('✗ Error: ' + error.message, 'error');
-            });
-        }
-        
-        function sendCommand(cmd) {
-            fetch('/motor?cmd=' + cmd, {method: 'POST'})
-            .then(response => response.text())
-            .then(result => {
-                console.log('Motor command:', cmd, result);
-            })
-            .catch(error => {
-                console.error('Motor error:', error);
-            });
-        }
-        
-        function showStatus(message, type) {
-            const statusEl = document.getElementById('status');
-            statusEl.className = 'status ' + type;
-            statusEl.textContent = message;
-            statusEl.style.display = 'block';
-            
-            if (type === 'success' || type === 'error') {
-                setTimeout(() => {
-                    statusEl.style.display = 'none';
-                }, 5000);
-            }
-        }
-    </script>
-</body>
-</html>
-)rawliteral";
+// Why the motors stopped, for /metrics
+enum MotorStopReason : uint8_t {
+    MOTOR_STOP_COMMAND,    // Zero speed or stop request
+    MOTOR_STOP_TIMEOUT,    // Command duration elapsed
+    MOTOR_STOP_REASONS
+};
+const char* const motorStopReasonNames[] = {"command", "timeout"};
+
+// Motor usage counters (written by the motor task)
+uint32_t motorRunMs = 0;
+uint32_t motorRunSince = 0;
+uint32_t motorStops[MOTOR_STOP_REASONS] = {};
+
+// Current outputs, published by the motor task for other readers
+struct MotorState {
+    int16_t left;
+    int16_t right;
+    uint8_t running;
+};
+
+Mailbox<MotorState> motorState;
+
+// Motor commands posted to the motor task, one ring per producing task
+struct MotorCommand {
+    int16_t left;
+    int16_t right;
+    uint16_t duration_ms;
+};
+
+SpscRing<MotorCommand, MOTOR_RING_LEN> motorFromSerial;  // protocol task
+SpscRing<MotorCommand, MOTOR_RING_LEN> motorFromWeb;     // httpd task
+std::atomic<bool> motorStopRequested{false};             // any task
+
+// WebSocket motor channel (owned by the httpd task)
+int motorSocketFd = -1;          // Socket of the last client to drive, -1 if none
+uint32_t motorWsFrames = 0;
+uint32_t motorWsBadFrames = 0;
+
+// Display jobs posted to the display task
+enum DisplayOp : uint8_t {
+    DISPLAY_OP_INIT,
+    DISPLAY_OP_SHOW,
+    DISPLAY_OP_CLEAR,
+    DISPLAY_OP_POWER_OFF,
+    DISPLAY_OP_BENCH,      // SBENCH's EPD transfer test
+    DISPLAY_OP_COUNT
+};
+const char* const displayOpNames[] = {"init", "show", "clear", "power_off", "bench"};
+
+QueueHandle_t displayQueue = nullptr;
+
+// Per-op job counts and durations (written by the display task)
+struct DisplayOpStats {
+    uint32_t count;
+    uint32_t lastMs;
+    LogHistogram us;
+};
+DisplayOpStats displayOpStats[DISPLAY_OP_COUNT];
+volatile bool displayBusy = false;
+volatile uint8_t displayJobOp = 0;        // Job in progress while displayBusy
+volatile uint32_t displayJobStartMs = 0;
+bool displayPowered = true;   // Owned by the display task
+uint32_t lastRefreshMs = 0;
+
+// micros() of the last BUSY falling edge, published by the BUSY ISR
+DRAM_ATTR Mailbox<uint32_t> busyIdleAt;
+
+// SBENCH tests run by the display and motor tasks post here, tagged with
+// the request they answer, and give benchDone
+struct BenchResult {
+    uint32_t seq;
+    uint32_t count;    // Bytes or writes per run
+    uint32_t cycles;   // Fastest of BENCH_RUNS
+};
+BenchResult epdBenchResult;                    // Written by the display task
+BenchResult ledcBenchResult;                   // Written by the motor task
+volatile uint32_t benchSeq = 0;                // Request in progress (protocol task)
+std::atomic<bool> motorBenchRequested{false};
+SemaphoreHandle_t benchDone = nullptr;
+
+// Per-task bookkeeping for STASKS
+enum TaskId : uint8_t {
+    TASK_MOTOR,
+    TASK_PROTOCOL,
+    TASK_DISPLAY,
+    TASK_NETWORK,
+    TASK_HTTP,
+    TASK_SCHEDULER,
+    TASK_COUNT
+};
+
+struct TaskInfo {
+    const char* name;
+    TaskHandle_t handle;
+    uint64_t busyUs;      // Written only by the owning task
+    uint32_t iterations;
+};
+
+TaskInfo taskInfo[TASK_COUNT] = {
+    {"motor", nullptr, 0, 0},
+    {"protocol", nullptr, 0, 0},
+    {"display", nullptr, 0, 0},
+    {"network", nullptr, 0, 0},
+    {"httpd", nullptr, 0, 0},
+    {"scheduler", nullptr, 0, 0},
+};
+
+// Adds one pass of the owning task's loop to its busy time
+static inline void taskAccount(TaskId id, int64_t startUs) {
+    taskInfo[id].busyUs += esp_timer_get_time() - startUs;
+    taskInfo[id].iterations++;
+}
+
+// Periodic snapshot of robot state, sampled by the telemetry timer
+struct TelemetrySample {
+    uint32_t uptimeMs;
+    int16_t motorLeft;
+    int16_t motorRight;
+    uint8_t motorsRunning;
+    uint8_t displayBusy;
+    uint16_t batteryMv;        // 0 if no battery sense is fitted
+    uint32_t lastRefreshMs;
+    uint32_t freeHeap;
+};
+
+Mailbox<TelemetrySample> telemetry;
 
 // ===========================================
 // CRC Calculation
 // ===========================================
-uint16_t calculateCRC(const uint8_t* data, int length) {
-    uint16_t crc = 0xFFFF;
+// Continues a CRC over more data, so a body can be checked chunk by chunk
+uint16_t crcUpdate(uint16_t crc, const uint8_t* data, int length) {
     for (int i = 0; i < length; i++) {
         crc ^= data[i] << 8;
         for (int j = 0; j < 8; j++) {
@@ -520,15 +439,44 @@ uint16_t calculateCRC(const uint8_t* data, int length) {
     return crc;
 }
 
+uint16_t calculateCRC(const uint8_t* data, int length) {
+    return crcUpdate(0xFFFF, data, length);
+}
+
 // ===========================================
 // Serial Protocol Functions
 // ===========================================
 void sendResponse(const char* status, const char* message) {
-    Serial.print(status);
-    Serial.print(strlen(message));
-    Serial.print("\n");
-    Serial.print(message);
-    Serial.print("\n");
+    SerialTxGuard guard;
+    int64_t start = esp_timer_get_time();
+    size_t bytes = protoSerial.print(status);
+    bytes += protoSerial.print(strlen(message));
+    bytes += protoSerial.print("\n");
+    bytes += protoSerial.print(message);
+    bytes += protoSerial.print("\n");
+    cmdStatsResponse(bytes, (uint32_t)(esp_timer_get_time() - start), status[0] == 'E');
+}
+
+// Streamed response: the caller writes exactly length message bytes to
+// protoSerial between begin and end, which hold the TX lock in between
+static int64_t streamStartUs;
+static size_t streamBytes;
+static bool streamError;
+
+void sendResponseBegin(const char* status, size_t length) {
+    if (serialTxMutex) xSemaphoreTake(serialTxMutex, portMAX_DELAY);
+    streamStartUs = esp_timer_get_time();
+    streamBytes = protoSerial.print(status);
+    streamBytes += protoSerial.print(length);
+    streamBytes += protoSerial.print("\n");
+    streamBytes += length;
+    streamError = status[0] == 'E';
+}
+
+void sendResponseEnd() {
+    streamBytes += protoSerial.print("\n");
+    cmdStatsResponse(streamBytes, (uint32_t)(esp_timer_get_time() - streamStartUs), streamError);
+    if (serialTxMutex) xSemaphoreGive(serialTxMutex);
 }
 
 void sendOK(const char* message = "") {
@@ -539,11 +487,79 @@ void sendError(const char* message) {
     sendResponse("ERR", message);
 }
 
+// ===========================================
+// Scheduler
+// ===========================================
+// One hardware timer advances the timer wheel; the scheduler task fires
+// expired callbacks. Callbacks must be short and must not block: they
+// notify or post to the task that owns the state.
+void onMotorCutoff(void* arg);
+void onDisplayIdle(void* arg);
+void onTelemetrySample(void* arg);
+void onHeartbeatLost(void* arg);
+void onFrameTimeout(void* arg);
+
+TimerEvent motorCutoffTimer  = {"motor_cutoff", onMotorCutoff, nullptr, 0};
+TimerEvent displayIdleTimer  = {"display_idle", onDisplayIdle, nullptr, 0};
+TimerEvent telemetryTimer    = {"telemetry", onTelemetrySample, nullptr, SCHED_MS_TO_TICKS(TELEMETRY_PERIOD_MS)};
+TimerEvent heartbeatTimer    = {"heartbeat", onHeartbeatLost, nullptr, 0};
+TimerEvent frameTimeoutTimer = {"frame_timeout", onFrameTimeout, nullptr, 0};
+
+TimerWheel timerWheel;
+portMUX_TYPE schedMux = portMUX_INITIALIZER_UNLOCKED;
+hw_timer_t* schedTimer = nullptr;
+volatile uint32_t schedTick = 0;   // Advanced by the timer ISR
+int64_t schedStartUs = 0;
+
+// Lateness of fired callbacks (owned by the scheduler task)
+uint32_t schedFired = 0;
+uint64_t schedLateSumUs = 0;
+uint32_t schedLateMaxUs = 0;
+const char* schedLateMaxName = "-";
+
+// (Re)arm ev to fire delayMs from now, from any task. O(1).
+void schedulerArm(TimerEvent* ev, uint32_t delayMs) {
+    portENTER_CRITICAL(&schedMux);
+    timerWheel.addAt(ev, schedTick + SCHED_MS_TO_TICKS(delayMs));
+    portEXIT_CRITICAL(&schedMux);
+}
+
+void schedulerCancel(TimerEvent* ev) {
+    portENTER_CRITICAL(&schedMux);
+    timerWheel.remove(ev);
+    portEXIT_CRITICAL(&schedMux);
+}
+
+void IRAM_ATTR onSchedulerTimer() {
+    uint32_t t = schedTick + 1;
+    schedTick = t;
+    
+    // Only wake the task on ticks that have something to do
+    portENTER_CRITICAL_ISR(&schedMux);
+    bool due = timerWheel.hasWorkAt(t);
+    portEXIT_CRITICAL_ISR(&schedMux);
+    
+    TaskHandle_t task = taskInfo[TASK_SCHEDULER].handle;
+    if (due && task) {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(task, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+}
+
+void initScheduler() {
+    schedStartUs = esp_timer_get_time();
+    schedTimer = timerBegin(1000000);
+    timerAttachInterrupt(schedTimer, onSchedulerTimer);
+    timerAlarm(schedTimer, SCHED_TICK_US, true, 0);
+    LOG_I("Scheduler timer started");
+}
+
 // ===========================================
 // Motor Control Functions
 // ===========================================
 // Forward declaration
-void stopMotors();
+void stopMotors(MotorStopReason reason = MOTOR_STOP_COMMAND);
 
 void initMotors() {
     // Configure PWM for each pin (ESP32 core 3.x API)
@@ -553,7 +569,20 @@ void initMotors() {
     ledcAttach(MOTOR_B2, PWM_FREQ, PWM_RESOLUTION);
     
     stopMotors();
-    Serial.println("[OK] Motors initialized on pins 18, 19, 5, 17");
+    LOG_I("Motors initialized on pins %d, %d, %d, %d", MOTOR_A1, MOTOR_A2, MOTOR_B1, MOTOR_B2);
+}
+
+// Tracks run time across running/stopped transitions
+void motorAccount(bool running, MotorStopReason reason) {
+    static bool wasRunning = false;
+    uint32_t now = millis();
+    if (running && !wasRunning) {
+        motorRunSince = now;
+    } else if (!running && wasRunning) {
+        motorRunMs += now - motorRunSince;
+        motorStops[reason]++;
+    }
+    wasRunning = running;
 }
 
 void setMotorSpeed(int left, int right, int duration_ms) {
@@ -587,26 +616,72 @@ void setMotorSpeed(int left, int right, int duration_ms) {
         motorStopTime = 0;
         motorsRunning = (left != 0 || right != 0);
     }
+    
+    motorAccount(motorsRunning, MOTOR_STOP_COMMAND);
+    motorState.publish(MotorState{(int16_t)left, (int16_t)right, (uint8_t)motorsRunning});
+    TRACE_VALUES(TRACE_MOTOR_SET, left, right);
 }
 
-void stopMotors() {
+void stopMotors(MotorStopReason reason) {
     ledcWrite(MOTOR_A1, 0);
     ledcWrite(MOTOR_A2, 0);
     ledcWrite(MOTOR_B1, 0);
     ledcWrite(MOTOR_B2, 0);
     motorsRunning = false;
     motorStopTime = 0;
+    motorAccount(false, reason);
+    motorState.publish(MotorState{0, 0, 0});
+    TRACE_INSTANT(TRACE_MOTOR_STOP, nullptr);
 }
 
+// Stops an expired motion, otherwise (re)arms the cutoff timer for it
 void checkMotorTimeout() {
-    if (motorsRunning && motorStopTime > 0 && millis() >= motorStopTime) {
-        stopMotors();
+    if (motorsRunning && motorStopTime > 0) {
+        long remaining = (long)(motorStopTime - millis());
+        if (remaining <= 0) {
+            stopMotors(MOTOR_STOP_TIMEOUT);
+        } else {
+            schedulerArm(&motorCutoffTimer, remaining);
+            return;
+        }
     }
+    schedulerCancel(&motorCutoffTimer);
+}
+
+// Scheduler callback: let the motor task check its stop time
+void onMotorCutoff(void* arg) {
+    xTaskNotifyGive(taskInfo[TASK_MOTOR].handle);
+}
+
+// Called by the ring's producing task; the motor task applies the command
+bool motorSubmit(SpscRing<MotorCommand, MOTOR_RING_LEN>& ring, int left, int right, int duration_ms) {
+    MotorCommand mc = {(int16_t)left, (int16_t)right, (uint16_t)duration_ms};
+    if (!ring.push(mc)) return false;
+    xTaskNotifyGive(taskInfo[TASK_MOTOR].handle);
+    return true;
+}
+
+// Emergency stop from any task; discards any queued motion
+void motorRequestStop() {
+    motorStopRequested.store(true, std::memory_order_release);
+    xTaskNotifyGive(taskInfo[TASK_MOTOR].handle);
 }
 
 // ===========================================
 // E-Paper Display Functions
 // ===========================================
+// BUSY falling edge: wake the display task instead of polling
+void IRAM_ATTR onBusyFall() {
+    busyIdleAt.publish(micros());
+    TRACE_INSTANT(TRACE_EPD_BUSY_IDLE, nullptr);
+    TaskHandle_t display = taskInfo[TASK_DISPLAY].handle;
+    if (display) {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(display, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+}
+
 void initEPD() {
     // Initialize pins
     pinMode(PIN_SPI_BUSY, INPUT);
@@ -621,19 +696,24 @@ void initEPD() {
     digitalWrite(PIN_SPI_PWR, HIGH);
     digitalWrite(PIN_SPI_SCK, LOW);
     
-    Serial.println("[OK] EPD pins initialized");
+    attachInterrupt(digitalPinToInterrupt(PIN_SPI_BUSY), onBusyFall, FALLING);
+    
+    LOG_I("EPD pins initialized");
 }
 
-void EPD_SPI_Transfer(uint8_t data) {
-    digitalWrite(PIN_SPI_CS, LOW);
-    
+// Clocks one byte out on DIN, MSB first; the caller handles CS
+void EPD_SPI_Shift(uint8_t data) {
     for (int i = 0; i < 8; i++) {
         digitalWrite(PIN_SPI_DIN, (data & 0x80) ? HIGH : LOW);
         data <<= 1;
         digitalWrite(PIN_SPI_SCK, HIGH);
         digitalWrite(PIN_SPI_SCK, LOW);
     }
-    
+}
+
+void EPD_SPI_Transfer(uint8_t data) {
+    digitalWrite(PIN_SPI_CS, LOW);
+    EPD_SPI_Shift(data);
     digitalWrite(PIN_SPI_CS, HIGH);
 }
 
@@ -647,9 +727,11 @@ void EPD_SendData(uint8_t data) {
     EPD_SPI_Transfer(data);
 }
 
+// Called from the display task only
 void EPD_WaitUntilIdle_high() {
     while (digitalRead(PIN_SPI_BUSY) == 1) {
-        delay(100);
+        // The edge interrupt ends the wait early; the timeout is a safety net
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(100));
     }
 }
 
@@ -663,6 +745,7 @@ void EPD_Reset() {
 }
 
 void EPD_4in2_V2_Init() {
+    TRACE_SCOPE(TRACE_EPD_INIT, nullptr);
     EPD_Reset();
     EPD_WaitUntilIdle_high();
     
@@ -713,17 +796,26 @@ void EPD_4in2_V2_Init() {
 }
 
 void EPD_4in2_V2_Show() {
+    TRACE_SCOPE(TRACE_EPD_REFRESH, nullptr);
+    uint32_t start = micros();
     EPD_SendCommand(0x22);
     EPD_SendData(0xF7);
     EPD_SendCommand(0x20);
     EPD_WaitUntilIdle_high();
     
+    uint32_t idleAt;
+    if (busyIdleAt.read(idleAt) && (int32_t)(idleAt - start) > 0) {
+        lastRefreshMs = (idleAt - start) / 1000;
+    }
+    
     // Enter deep sleep
     EPD_SendCommand(0x10);
     EPD_SendData(0x01);
 }
 
-void EPD_4in2_V2_Display(const uint8_t* image) {
+// Reset, configure and write a frame into panel RAM (no refresh)
+void EPD_4in2_V2_Load(const uint8_t* image) {
+    TRACE_SCOPE(TRACE_EPD_LOAD, nullptr);
     EPD_Reset();
     EPD_WaitUntilIdle_high();
     
@@ -762,12 +854,17 @@ void EPD_4in2_V2_Display(const uint8_t* image) {
     for (int i = 0; i < IMAGE_BUFFER_SIZE; i++) {
         EPD_SendData(image[i]);
     }
+}
+
+void EPD_4in2_V2_Display(const uint8_t* image) {
+    EPD_4in2_V2_Load(image);
     
     // Trigger display refresh
     EPD_4in2_V2_Show();
 }
 
 void EPD_4in2_V2_Clear() {
+    TRACE_SCOPE(TRACE_EPD_CLEAR, nullptr);
     EPD_4in2_V2_Init();
 }
 
@@ -775,121 +872,593 @@ void EPD_4in2_V2_Clear() {
 // Image Buffer Functions
 // ===========================================
 void initImageBuffer() {
-    // Try to allocate in PSRAM first
-    if (psramFound()) {
-        imageBuffer = (uint8_t*)ps_malloc(IMAGE_BUFFER_SIZE);
-        Serial.println("[OK] Image buffer in PSRAM");
-    } else {
-        imageBuffer = (uint8_t*)malloc(IMAGE_BUFFER_SIZE);
-        Serial.println("[OK] Image buffer in RAM");
-    }
-    
-    if (imageBuffer == nullptr) {
-        Serial.println("[ERR] Failed to allocate image buffer!");
-        return;
-    }
-    
     memset(imageBuffer, 0xFF, IMAGE_BUFFER_SIZE);
     bufferIndex = 0;
     bufferReady = false;
+    LOG_I("Image buffer in RAM (%d bytes)", IMAGE_BUFFER_SIZE);
 }
 
 void clearImageBuffer() {
-    if (imageBuffer != nullptr) {
-        memset(imageBuffer, 0xFF, IMAGE_BUFFER_SIZE);
-    }
+    memset(imageBuffer, 0xFF, IMAGE_BUFFER_SIZE);
     bufferIndex = 0;
     bufferReady = false;
 }
 
+// Called from any task; the display task performs the refresh
+bool displaySubmit(DisplayOp op) {
+    return xQueueSend(displayQueue, &op, 0) == pdTRUE;
+}
+
+// Scheduler callback: no display jobs for DISPLAY_IDLE_SLEEP_MS
+void onDisplayIdle(void* arg) {
+    displaySubmit(DISPLAY_OP_POWER_OFF);
+}
+
 // ===========================================
 // Web Server Handlers
 // ===========================================
-void handleRoot() {
-    server.send(200, "text/html", HTML_PAGE);
+// Handlers run on the httpd task. Each request counts as one pass of
+// that task for STASKS.
+struct HttpBusy {
+    int64_t start = esp_timer_get_time();
+    ~HttpBusy() { taskAccount(TASK_HTTP, start); }
+};
+
+#define HTTP_SCOPE(route) \
+    HttpBusy _httpBusy; \
+    PROF_SCOPE(PROF_HTTP); \
+    PROF_CULPRIT(PROF_HTTP, route); \
+    TRACE_SCOPE(TRACE_HTTP, route)
+
+static esp_err_t httpReply(httpd_req_t* req, const char* status, const char* message) {
+    httpd_resp_set_status(req, status);
+    httpd_resp_set_type(req, "text/plain");
+    return httpd_resp_sendstr(req, message);
 }
 
-void handleUpload() {
-    if (server.method() != HTTP_POST) {
-        server.send(405, "text/plain", "Method Not Allowed");
-        return;
+// Copies the value of key from the query string; false if absent. A value
+// too long for the buffer comes back empty, so a cut-off prefix ("pngx" as
+// "png") never matches a valid one.
+static bool httpQueryArg(httpd_req_t* req, const char* key, char* value, size_t size) {
+    char query[64];
+    if (httpd_req_get_url_query_str(req, query, sizeof(query)) != ESP_OK) return false;
+    esp_err_t err = httpd_query_key_value(query, key, value, size);
+    if (err == ESP_ERR_HTTPD_RESULT_TRUNC) value[0] = '\0';
+    return err == ESP_OK || err == ESP_ERR_HTTPD_RESULT_TRUNC;
+}
+
+// Sends an asset from web_assets.h as stored (gzip), or 304 if the
+// client's copy is current. With no-cache the browser revalidates on every
+// load: a firmware update shows up at once, an unchanged page costs a 304.
+static esp_err_t httpSendAsset(httpd_req_t* req, const char* type, const uint8_t* gz, size_t len,
+                               const char* etag) {
+    httpd_resp_set_hdr(req, "ETag", etag);
+    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+    char ifNoneMatch[64];
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", ifNoneMatch, sizeof(ifNoneMatch)) == ESP_OK &&
+        strstr(ifNoneMatch, etag)) {
+        httpd_resp_set_status(req, "304 Not Modified");
+        return httpd_resp_send(req, nullptr, 0);
+    }
+    httpd_resp_set_type(req, type);
+    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+    return httpd_resp_send(req, (const char*)gz, len);
+}
+
+esp_err_t handleRoot(httpd_req_t* req) {
+    HTTP_SCOPE("/");
+    return httpSendAsset(req, "text/html", HTML_PAGE_GZ, HTML_PAGE_GZ_LEN, HTML_PAGE_ETAG);
+}
+
+// POST /upload: the body is received in chunks straight into imageBuffer,
+// with the CRC computed as each chunk lands. An optional X-Image-CRC header
+// (CRC-CCITT of the frame, 4 hex digits, as in the serial protocol) is
+// checked before the frame is marked ready. A short or failed upload has
+// already overwritten part of the frame, so it leaves the buffer not
+// ready and the display refuses to show it until a good frame arrives.
+esp_err_t handleUpload(httpd_req_t* req) {
+    HTTP_SCOPE("/upload");
+    if (req->content_len != IMAGE_BUFFER_SIZE) {
+        char msg[128];
+        snprintf(msg, sizeof(msg), "Invalid content length: expected %d bytes, got %u bytes", 
+                 IMAGE_BUFFER_SIZE, (unsigned)req->content_len);
+        return httpReply(req, "400 Bad Request", msg);
     }
     
-    // Get content length from header
-    String contentLengthStr = server.header("Content-Length");
-    int contentLength = contentLengthStr.length() > 0 ? contentLengthStr.toInt() : 0;
+    char crcHeader[8];
+    bool checkCrc = httpd_req_get_hdr_value_str(req, "X-Image-CRC", crcHeader, sizeof(crcHeader)) == ESP_OK;
+    uint16_t expectedCrc = checkCrc ? (uint16_t)strtol(crcHeader, nullptr, 16) : 0;
     
-    if (contentLength != IMAGE_BUFFER_SIZE) {
-        char msg[128];
-        snprintf(msg, sizeof(msg), "Invalid content length: expected %d bytes, got %d bytes", 
-                 IMAGE_BUFFER_SIZE, contentLength);
-        server.send(400, "text/plain", msg);
-        return;
+    // The display task reads imageBuffer while loading the panel
+    if (xSemaphoreTake(frameMutex, 0) != pdTRUE) {
+        return httpReply(req, "503 Service Unavailable", "Display busy");
+    }
+    
+    size_t received = 0;
+    uint16_t crc = 0xFFFF;
+    int n = 0;
+    while (received < IMAGE_BUFFER_SIZE) {
+        n = httpd_req_recv(req, (char*)imageBuffer + received,
+                           min((size_t)HTTP_RECV_CHUNK, IMAGE_BUFFER_SIZE - received));
+        if (n <= 0) break;
+        crc = crcUpdate(crc, imageBuffer + received, n);
+        received += n;
+    }
+    
+    bool crcOk = !checkCrc || crc == expectedCrc;
+    bufferReady = (received == IMAGE_BUFFER_SIZE) && crcOk;
+    xSemaphoreGive(frameMutex);
+    
+    if (n == HTTPD_SOCK_ERR_TIMEOUT) {
+        LOG_W("Upload stalled after %u of %d bytes", (unsigned)received, IMAGE_BUFFER_SIZE);
+        httpd_resp_send_err(req, HTTPD_408_REQ_TIMEOUT, "Upload timed out");
+        return ESP_FAIL;
+    }
+    if (received != IMAGE_BUFFER_SIZE) {
+        return ESP_FAIL;   // Client went away; close the socket
+    }
+    if (!crcOk) {
+        char msg[64];
+        snprintf(msg, sizeof(msg), "CRC mismatch: expected %04X, got %04X", expectedCrc, crc);
+        return httpReply(req, "400 Bad Request", msg);
     }
     
-    // Read raw binary data directly
-    WiFiClient client = server.client();
-    int bytesRead = 0;
+    // Refresh runs on the display task
+    if (!displaySubmit(DISPLAY_OP_SHOW)) {
+        return httpReply(req, "503 Service Unavailable", "Display queue full");
+    }
     
-    // Wait for data with timeout
-    unsigned long startTime = millis();
-    while (bytesRead < IMAGE_BUFFER_SIZE && millis() - startTime < 10000) {
-        while (client.available() && bytesRead < IMAGE_BUFFER_SIZE) {
-            imageBuffer[bytesRead++] = client.read();
+    return httpReply(req, "200 OK", "Image uploaded, display refresh queued");
+}
+
+esp_err_t handleClear(httpd_req_t* req) {
+    HTTP_SCOPE("/clear");
+    if (!displaySubmit(DISPLAY_OP_CLEAR)) {
+        return httpReply(req, "503 Service Unavailable", "Display queue full");
+    }
+    return httpReply(req, "200 OK", "Display clear queued");
+}
+
+esp_err_t handleMotor(httpd_req_t* req) {
+    HTTP_SCOPE("/motor");
+    char cmd[12];
+    if (!httpQueryArg(req, "cmd", cmd, sizeof(cmd))) {
+        return httpReply(req, "400 Bad Request", "No command specified");
+    }
+    
+    bool queued;
+    const char* reply;
+    if (strcmp(cmd, "forward") == 0) {
+        queued = motorSubmit(motorFromWeb, 200, 200, 1000);
+        reply = "Moving forward";
+    } else if (strcmp(cmd, "backward") == 0) {
+        queued = motorSubmit(motorFromWeb, -200, -200, 1000);
+        reply = "Moving backward";
+    } else if (strcmp(cmd, "left") == 0) {
+        queued = motorSubmit(motorFromWeb, -200, 200, 1000);
+        reply = "Turning left";
+    } else if (strcmp(cmd, "right") == 0) {
+        queued = motorSubmit(motorFromWeb, 200, -200, 1000);
+        reply = "Turning right";
+    } else if (strcmp(cmd, "stop") == 0) {
+        motorRequestStop();
+        queued = true;
+        reply = "Stopped";
+    } else {
+        return httpReply(req, "400 Bad Request", "Unknown command");
+    }
+    
+    if (!queued) {
+        return httpReply(req, "503 Service Unavailable", "Motor queue full");
+    }
+    return httpReply(req, "200 OK", reply);
+}
+
+// GET /ws/motor: after the handshake, every WebSocket frame lands here.
+// Frames are applied as they come; with several clients the last one wins.
+// Lease 0 (or zero speed) stops at once. A frame of the wrong size closes
+// the socket, which stops the motors through httpOnClose().
+esp_err_t handleMotorSocket(httpd_req_t* req) {
+    if (req->method == HTTP_GET) {
+        LOG_I("Motor socket %d connected", httpd_req_to_sockfd(req));
+        return ESP_OK;
+    }
+    HTTP_SCOPE("/ws/motor");
+    
+    uint8_t payload[MOTOR_WS_FRAME_LEN];
+    httpd_ws_frame_t frame = {};
+    frame.payload = payload;
+    esp_err_t err = httpd_ws_recv_frame(req, &frame, 0);   // Header only, sets frame.len
+    if (err != ESP_OK) return err;
+    if (frame.type != HTTPD_WS_TYPE_BINARY || frame.len != MOTOR_WS_FRAME_LEN) {
+        motorWsBadFrames++;
+        LOG_W("Motor socket: bad frame (type %d, %u bytes)", frame.type, (unsigned)frame.len);
+        return ESP_FAIL;
+    }
+    err = httpd_ws_recv_frame(req, &frame, sizeof(payload));
+    if (err != ESP_OK) return err;
+    
+    int16_t left = (int16_t)(payload[0] | payload[1] << 8);
+    int16_t right = (int16_t)(payload[2] | payload[3] << 8);
+    uint16_t leaseMs = min((uint16_t)(payload[4] | payload[5] << 8), (uint16_t)MOTOR_LEASE_MAX_MS);
+    motorWsFrames++;
+    motorSocketFd = httpd_req_to_sockfd(req);
+    
+    if (leaseMs == 0 || (left == 0 && right == 0)) {
+        motorSubmit(motorFromWeb, 0, 0, 0);
+    } else {
+        // A full ring means the motor task is behind; the next frame renews the lease
+        motorSubmit(motorFromWeb, left, right, leaseMs);
+    }
+    return ESP_OK;
+}
+
+// Telemetry subscribers (owned by the httpd task)
+struct TelemetryClient {
+    int fd;                 // -1 = free slot
+    uint16_t intervalMs;    // Requested with ?hz=
+    uint32_t lastSentMs;
+};
+TelemetryClient telemetryClients[TELEMETRY_MAX_CLIENTS];   // Freed in startHttpServer()
+std::atomic<uint8_t> telemetryClientCount{0};
+std::atomic<bool> telemetryPushQueued{false};
+uint32_t telemetryFramesSent = 0;
+uint32_t telemetryFramesSkipped = 0;   // Socket not writable
+
+static void telemetryRemoveClient(int fd) {
+    for (TelemetryClient& c : telemetryClients) {
+        if (c.fd == fd) {
+            c.fd = -1;
+            telemetryClientCount--;
         }
-        if (bytesRead < IMAGE_BUFFER_SIZE) {
-            delay(10);
+    }
+}
+
+// GET /ws/telemetry?hz=N: subscribes the socket after the handshake.
+// Frames from the client are read and ignored.
+esp_err_t handleTelemetrySocket(httpd_req_t* req) {
+    int fd = httpd_req_to_sockfd(req);
+    if (req->method == HTTP_GET) {
+        char hz[4];
+        uint16_t intervalMs = TELEMETRY_PERIOD_MS;
+        if (httpQueryArg(req, "hz", hz, sizeof(hz)) && atoi(hz) > 0) {
+            intervalMs = max(1000 / atoi(hz), TELEMETRY_PERIOD_MS);
+        }
+        for (TelemetryClient& c : telemetryClients) {
+            if (c.fd < 0) {
+                c = {fd, intervalMs, 0};
+                telemetryClientCount++;
+                LOG_I("Telemetry socket %d subscribed, every %u ms", fd, intervalMs);
+                return ESP_OK;
+            }
         }
+        LOG_W("Telemetry socket %d refused: %d subscribers", fd, TELEMETRY_MAX_CLIENTS);
+        return ESP_FAIL;
     }
     
-    if (bytesRead != IMAGE_BUFFER_SIZE) {
-        char msg[128];
-        snprintf(msg, sizeof(msg), "Incomplete data: expected %d bytes, received %d bytes", 
-                 IMAGE_BUFFER_SIZE, bytesRead);
-        server.send(400, "text/plain", msg);
-        return;
+    uint8_t discard[32];
+    httpd_ws_frame_t frame = {};
+    frame.payload = discard;
+    esp_err_t err = httpd_ws_recv_frame(req, &frame, 0);
+    if (err != ESP_OK || frame.len > sizeof(discard)) return ESP_FAIL;
+    return httpd_ws_recv_frame(req, &frame, sizeof(discard));
+}
+
+// True if fd's send buffer has room right now. lwip reports a socket
+// writable above its low-water mark, which is far more than one frame,
+// so the send that follows does not block the server.
+static bool socketWritable(int fd) {
+    fd_set writeSet;
+    FD_ZERO(&writeSet);
+    FD_SET(fd, &writeSet);
+    struct timeval now = {0, 0};
+    return select(fd + 1, nullptr, &writeSet, nullptr, &now) > 0;
+}
+
+// Formats the latest sample; returns the length
+static int telemetryFormat(char* out, size_t size) {
+    TelemetrySample s = {};
+    telemetry.read(s);
+    
+    // Progress of the running job, estimated from the last job of its kind
+    char progress[8] = "null";
+    uint32_t expectedMs = displayOpStats[displayJobOp].lastMs;
+    if (s.displayBusy && expectedMs > 0) {
+        uint32_t pct = (millis() - displayJobStartMs) * 100 / expectedMs;
+        snprintf(progress, sizeof(progress), "%u", (unsigned)min(pct, (uint32_t)99));
     }
+    char battery[8] = "null";
+    if (s.batteryMv) snprintf(battery, sizeof(battery), "%u", s.batteryMv);
     
-    bufferReady = true;
+    uint32_t frames = 0, errors = 0;
+    uint64_t rxBytes = 0, txBytes = 0;
+    for (const CmdStats& c : cmdStats) {
+        frames += c.count;
+        errors += c.errors;
+        rxBytes += c.bytesIn;
+        txBytes += c.bytesOut;
+    }
     
-    // Display the image
-    EPD_4in2_V2_Display(imageBuffer);
+    return snprintf(out, size,
+        "{\"t\":%lu,\"motor\":{\"left\":%d,\"right\":%d,\"running\":%d},\"battery_mv\":%s,"
+        "\"display\":{\"busy\":%d,\"op\":\"%s\",\"progress\":%s,\"last_refresh_ms\":%lu},"
+        "\"link\":{\"transport\":\"%s\",\"frames\":%lu,\"errors\":%lu,\"rx_bytes\":%llu,"
+        "\"tx_bytes\":%llu,\"rx_dropped\":%lu,\"timeouts\":%lu},\"heap\":%lu,\"wifi_clients\":%u}",
+        (unsigned long)s.uptimeMs, s.motorLeft, s.motorRight, s.motorsRunning, battery,
+        s.displayBusy, s.displayBusy ? displayOpNames[displayJobOp] : "idle", progress,
+        (unsigned long)s.lastRefreshMs, TRANSPORT_NAME, (unsigned long)frames, (unsigned long)errors,
+        (unsigned long long)rxBytes, (unsigned long long)txBytes, (unsigned long)uartRxRing.dropped(),
+        (unsigned long)frameTimeouts, (unsigned long)s.freeHeap, (unsigned)WiFi.softAPgetStationNum());
+}
+
+// Runs on the httpd task (httpd_queue_work): one frame, many sockets
+static void telemetryPush(void* arg) {
+    telemetryPushQueued = false;
+    static char json[TELEMETRY_FRAME_SIZE];
+    int64_t start = esp_timer_get_time();
+    uint32_t now = millis();
+    int len = -1;
     
-    server.send(200, "text/plain", "Image uploaded and displayed successfully");
+    // Pushes follow the samples, which jitter around TELEMETRY_PERIOD_MS:
+    // a client is due half a period early, or one at the full sample rate
+    // would skip every sample that came a millisecond soon
+    for (TelemetryClient& c : telemetryClients) {
+        if (c.fd < 0 || now - c.lastSentMs + TELEMETRY_PERIOD_MS / 2 < c.intervalMs) continue;
+        if (!socketWritable(c.fd)) {
+            telemetryFramesSkipped++;
+            continue;
+        }
+        if (len < 0) len = min(telemetryFormat(json, sizeof(json)), (int)sizeof(json) - 1);
+        httpd_ws_frame_t frame = {};
+        frame.final = true;
+        frame.type = HTTPD_WS_TYPE_TEXT;
+        frame.payload = (uint8_t*)json;
+        frame.len = len;
+        if (httpd_ws_send_frame_async(httpServer, c.fd, &frame) == ESP_OK) {
+            telemetryFramesSent++;
+            c.lastSentMs = now;
+        } else {
+            httpd_sess_trigger_close(httpServer, c.fd);
+        }
+    }
+    taskAccount(TASK_HTTP, start);
 }
 
-void handleClear() {
-    clearImageBuffer();
-    EPD_4in2_V2_Clear();
-    server.send(200, "text/plain", "Display cleared");
+// From the telemetry timer: hand the push to the httpd task, once
+void telemetryPushRequest() {
+    if (httpServer && telemetryClientCount > 0 && !telemetryPushQueued.exchange(true)) {
+        if (httpd_queue_work(httpServer, telemetryPush, nullptr) != ESP_OK) {
+            telemetryPushQueued = false;
+        }
+    }
 }
 
-void handleMotor() {
-    if (!server.hasArg("cmd")) {
-        server.send(400, "text/plain", "No command specified");
-        return;
+static void previewSink(void* ctx, const uint8_t* data, size_t length) {
+    httpd_resp_send_chunk((httpd_req_t*)ctx, (const char*)data, length);
+}
+
+// GET /preview?format=png|bmp: the frame buffer as an image, encoded row
+// by row into chunks (see frame_preview.h). The ETag is the frame's CRC-32,
+// so polling an unchanged frame costs a 304. Rows are copied out under
+// frameMutex one at a time: a frame replaced mid-download comes out torn,
+// and the next request sees the new ETag and gets the new frame whole.
+esp_err_t handlePreview(httpd_req_t* req) {
+    HTTP_SCOPE("/preview");
+    char format[8] = "png";
+    httpQueryArg(req, "format", format, sizeof(format));
+    PreviewFormat previewFormat;
+    if (strcmp(format, "png") == 0) {
+        previewFormat = PREVIEW_PNG;
+        httpd_resp_set_type(req, "image/png");
+    } else if (strcmp(format, "bmp") == 0) {
+        previewFormat = PREVIEW_BMP;
+        httpd_resp_set_type(req, "image/bmp");
+    } else {
+        return httpReply(req, "400 Bad Request", "Format must be png or bmp");
     }
     
-    String cmd = server.arg("cmd");
-    
-    if (cmd == "forward") {
-        setMotorSpeed(200, 200, 1000);
-        server.send(200, "text/plain", "Moving forward");
-    } else if (cmd == "backward") {
-        setMotorSpeed(-200, -200, 1000);
-        server.send(200, "text/plain", "Moving backward");
-    } else if (cmd == "left") {
-        setMotorSpeed(-200, 200, 1000);
-        server.send(200, "text/plain", "Turning left");
-    } else if (cmd == "right") {
-        setMotorSpeed(200, -200, 1000);
-        server.send(200, "text/plain", "Turning right");
-    } else if (cmd == "stop") {
-        stopMotors();
-        server.send(200, "text/plain", "Stopped");
-    } else {
-        server.send(400, "text/plain", "Unknown command");
+    xSemaphoreTake(frameMutex, portMAX_DELAY);
+    uint32_t frameCrc = crc32Update(0, imageBuffer, IMAGE_BUFFER_SIZE);
+    xSemaphoreGive(frameMutex);
+    char etag[16];
+    snprintf(etag, sizeof(etag), "\"%s-%08lx\"", format, (unsigned long)frameCrc);
+    httpd_resp_set_hdr(req, "ETag", etag);
+    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+    char ifNoneMatch[64];
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", ifNoneMatch, sizeof(ifNoneMatch)) == ESP_OK &&
+        strstr(ifNoneMatch, etag)) {
+        httpd_resp_set_status(req, "304 Not Modified");
+        return httpd_resp_send(req, nullptr, 0);
+    }
+    
+    FramePreview preview(previewFormat, EPD_WIDTH, EPD_HEIGHT, previewSink, req);
+    uint8_t row[EPD_WIDTH / 8];
+    preview.begin();
+    for (uint16_t i = 0; i < EPD_HEIGHT; i++) {
+        uint16_t y = preview.rowAt(i);
+        xSemaphoreTake(frameMutex, portMAX_DELAY);
+        memcpy(row, imageBuffer + y * sizeof(row), sizeof(row));
+        xSemaphoreGive(frameMutex);
+        preview.row(row);
+    }
+    preview.end();
+    return httpd_resp_send_chunk(req, nullptr, 0);   // Last chunk
+}
+
+// Latency histograms; GET /profile?reset=1 clears them after the dump
+esp_err_t handleProfile(httpd_req_t* req) {
+    HTTP_SCOPE("/profile");
+    static char report[1536];
+    profReport(report, sizeof(report), '\n', true);
+    char reset[4];
+    if (httpQueryArg(req, "reset", reset, sizeof(reset))) {
+        profReset();
     }
+    return httpReply(req, "200 OK", report);
+}
+
+static void metricsSink(void* ctx, const char* data, size_t length) {
+    httpd_resp_send_chunk((httpd_req_t*)ctx, data, length);
+}
+
+// GET /metrics: Prometheus text format, streamed as chunks from a fixed
+// buffer. Counters owned by other tasks are read without locking; a
+// scrape may mix values from slightly different moments.
+esp_err_t handleMetrics(httpd_req_t* req) {
+    HTTP_SCOPE("/metrics");
+    MetricsWriter w(metricsSink, req);
+    // Longest label: a full-length command name in the "handler" phase
+    char labels[sizeof("command=\"\",phase=\"handler\"") + CMD_STATS_NAME_LEN];
+    
+    httpd_resp_set_type(req, "text/plain; version=0.0.4");
+    
+    w.family("robot_uptime_seconds", "gauge", "Time since boot");
+    w.printf("robot_uptime_seconds %llu\n", (unsigned long long)(esp_timer_get_time() / 1000000));
+    
+    // Serial protocol
+    w.family("robot_protocol_frames_total", "counter", "Serial frames handled");
+    for (const CmdStats& c : cmdStats) {
+        if (c.count) w.printf("robot_protocol_frames_total{command=\"%s\"} %u\n", c.name, (unsigned)c.count);
+    }
+    w.family("robot_protocol_errors_total", "counter", "ERR responses sent");
+    for (const CmdStats& c : cmdStats) {
+        if (c.count) w.printf("robot_protocol_errors_total{command=\"%s\"} %u\n", c.name, (unsigned)c.errors);
+    }
+    w.family("robot_protocol_received_bytes_total", "counter", "Frame bytes received");
+    for (const CmdStats& c : cmdStats) {
+        if (c.count) w.printf("robot_protocol_received_bytes_total{command=\"%s\"} %llu\n",
+                              c.name, (unsigned long long)c.bytesIn);
+    }
+    w.family("robot_protocol_sent_bytes_total", "counter", "Response bytes sent");
+    for (const CmdStats& c : cmdStats) {
+        if (c.count) w.printf("robot_protocol_sent_bytes_total{command=\"%s\"} %llu\n",
+                              c.name, (unsigned long long)c.bytesOut);
+    }
+    w.family("robot_protocol_phase_seconds", "summary", "Serial frame latency by phase");
+    for (const CmdStats& c : cmdStats) {
+        if (!c.count) continue;
+        const LogHistogram* phases[] = {&c.rxUs, &c.crcUs, &c.handlerUs, &c.txUs};
+        const char* phaseNames[] = {"rx", "crc", "handler", "tx"};
+        for (int i = 0; i < 4; i++) {
+            snprintf(labels, sizeof(labels), "command=\"%.*s\",phase=\"%s\"",
+                     CMD_STATS_NAME_LEN, c.name, phaseNames[i]);
+            w.summary("robot_protocol_phase_seconds", labels, *phases[i]);
+        }
+    }
+    w.family("robot_protocol_timeouts_total", "counter", "Partial frames dropped after CMD_TIMEOUT_MS");
+    w.printf("robot_protocol_timeouts_total %u\n", (unsigned)frameTimeouts);
+    w.family("robot_link_info", "gauge", "Protocol transport");
+    w.printf("robot_link_info{transport=\"%s\",baud=\"%lu\"} 1\n", TRANSPORT_NAME, (unsigned long)TRANSPORT_BAUD);
+    w.family("robot_uart_rx_dropped_bytes_total", "counter", "UART bytes lost to a full RX ring");
+    w.printf("robot_uart_rx_dropped_bytes_total %u\n", (unsigned)uartRxRing.dropped());
+    
+    // E-paper display
+    w.family("robot_epd_jobs_total", "counter", "Display jobs by mode");
+    for (int op = 0; op < DISPLAY_OP_COUNT; op++) {
+        w.printf("robot_epd_jobs_total{mode=\"%s\"} %u\n", displayOpNames[op],
+                 (unsigned)displayOpStats[op].count);
+    }
+    w.family("robot_epd_job_seconds", "summary", "Display job duration by mode");
+    for (int op = 0; op < DISPLAY_OP_COUNT; op++) {
+        snprintf(labels, sizeof(labels), "mode=\"%s\"", displayOpNames[op]);
+        w.summary("robot_epd_job_seconds", labels, displayOpStats[op].us);
+    }
+    w.family("robot_epd_last_refresh_seconds", "gauge", "Panel refresh time of the last image (BUSY high)");
+    w.printf("robot_epd_last_refresh_seconds %u.%03u\n", (unsigned)(lastRefreshMs / 1000),
+             (unsigned)(lastRefreshMs % 1000));
+    w.family("robot_epd_busy", "gauge", "Display job in progress");
+    w.printf("robot_epd_busy %d\n", displayBusy ? 1 : 0);
+    w.family("robot_epd_powered", "gauge", "Panel power on");
+    w.printf("robot_epd_powered %d\n", displayPowered ? 1 : 0);
+    
+    // Motors
+    MotorState motor = {};
+    motorState.read(motor);
+    uint32_t runMs = motorRunMs + (motor.running ? millis() - motorRunSince : 0);
+    w.family("robot_motor_running", "gauge", "Motors driven");
+    w.printf("robot_motor_running %d\n", motor.running ? 1 : 0);
+    w.family("robot_motor_speed", "gauge", "Current PWM duty (-255..255)");
+    w.printf("robot_motor_speed{side=\"left\"} %d\nrobot_motor_speed{side=\"right\"} %d\n",
+             motor.left, motor.right);
+    w.family("robot_motor_runtime_seconds_total", "counter", "Time spent driving");
+    w.printf("robot_motor_runtime_seconds_total %u.%03u\n", (unsigned)(runMs / 1000), (unsigned)(runMs % 1000));
+    w.family("robot_motor_stops_total", "counter", "Transitions from driving to stopped");
+    for (int r = 0; r < MOTOR_STOP_REASONS; r++) {
+        w.printf("robot_motor_stops_total{reason=\"%s\"} %u\n", motorStopReasonNames[r],
+                 (unsigned)motorStops[r]);
+    }
+    w.family("robot_motor_commands_dropped_total", "counter", "Motor commands rejected by a full queue");
+    w.printf("robot_motor_commands_dropped_total{source=\"serial\"} %u\n", (unsigned)motorFromSerial.dropped());
+    w.printf("robot_motor_commands_dropped_total{source=\"web\"} %u\n", (unsigned)motorFromWeb.dropped());
+    w.family("robot_motor_ws_frames_total", "counter", "Joystick frames on /ws/motor");
+    w.printf("robot_motor_ws_frames_total{result=\"ok\"} %u\n", (unsigned)motorWsFrames);
+    w.printf("robot_motor_ws_frames_total{result=\"bad\"} %u\n", (unsigned)motorWsBadFrames);
+    
+    // Telemetry push
+    w.family("robot_telemetry_clients", "gauge", "Subscribers on /ws/telemetry");
+    w.printf("robot_telemetry_clients %u\n", (unsigned)telemetryClientCount.load());
+    w.family("robot_telemetry_frames_total", "counter", "Telemetry frames by outcome");
+    w.printf("robot_telemetry_frames_total{result=\"sent\"} %u\n", (unsigned)telemetryFramesSent);
+    w.printf("robot_telemetry_frames_total{result=\"skipped\"} %u\n", (unsigned)telemetryFramesSkipped);
+    
+    // Memory
+    w.family("robot_heap_free_bytes", "gauge", "Free internal heap");
+    w.printf("robot_heap_free_bytes %u\n", (unsigned)heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+    w.family("robot_heap_min_free_bytes", "gauge", "Lowest free internal heap since boot");
+    w.printf("robot_heap_min_free_bytes %u\n", (unsigned)heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL));
+    w.family("robot_heap_largest_free_block_bytes", "gauge", "Largest allocatable internal block");
+    w.printf("robot_heap_largest_free_block_bytes %u\n",
+             (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL));
+    if (psramFound()) {
+        w.family("robot_psram_free_bytes", "gauge", "Free PSRAM");
+        w.printf("robot_psram_free_bytes %u\n", (unsigned)heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+    }
+    
+    // Tasks and latency
+    w.family("robot_task_busy_seconds_total", "counter", "CPU time spent working per task");
+    for (const TaskInfo& t : taskInfo) {
+        w.printf("robot_task_busy_seconds_total{task=\"%s\"} %llu.%06u\n", t.name,
+                 (unsigned long long)(t.busyUs / 1000000), (unsigned)(t.busyUs % 1000000));
+    }
+    w.family("robot_task_stack_free", "gauge", "Stack high-water mark per task");
+    for (const TaskInfo& t : taskInfo) {
+        w.printf("robot_task_stack_free{task=\"%s\"} %u\n", t.name,
+                 (unsigned)(t.handle ? uxTaskGetStackHighWaterMark(t.handle) : 0));
+    }
+#if ENABLE_PROFILER
+    w.family("robot_latency_seconds", "summary", "Subsystem step latency (cycle counter)");
+    for (const ProfStats& p : profStats) {
+        if (p.epoch != profEpoch) continue;
+        snprintf(labels, sizeof(labels), "probe=\"%s\"", p.name);
+        w.summary("robot_latency_seconds", labels, p.hist);
+    }
+#endif
+    w.family("robot_scheduler_timers_fired_total", "counter", "Scheduler callbacks run");
+    w.printf("robot_scheduler_timers_fired_total %u\n", (unsigned)schedFired);
+    
+    // Network
+    w.family("robot_wifi_clients", "gauge", "Stations connected to the access point");
+    w.printf("robot_wifi_clients %u\n", (unsigned)WiFi.softAPgetStationNum());
+    w.family("robot_dns_queries_total", "counter", "Captive DNS queries by outcome");
+    w.printf("robot_dns_queries_total{result=\"answered\"} %u\n", (unsigned)dnsAnswered);
+    w.printf("robot_dns_queries_total{result=\"dropped\"} %u\n", (unsigned)dnsDropped);
+    w.family("robot_network_cpu_seconds_total", "counter", "CPU time spent on networking per task");
+    for (TaskId id : {TASK_NETWORK, TASK_HTTP}) {
+        const TaskInfo& t = taskInfo[id];
+        w.printf("robot_network_cpu_seconds_total{task=\"%s\"} %llu.%06u\n", t.name,
+                 (unsigned long long)(t.busyUs / 1000000), (unsigned)(t.busyUs % 1000000));
+    }
+#if configGENERATE_RUN_TIME_STATS
+    for (const NetSysTask& t : netSysTasks) {
+        if (!t.handle) continue;
+        uint64_t us = ulTaskGetRunTimeCounter(t.handle);   // Wraps with a 32-bit counter type
+        w.printf("robot_network_cpu_seconds_total{task=\"%s\"} %llu.%06u\n", t.name,
+                 (unsigned long long)(us / 1000000), (unsigned)(us % 1000000));
+    }
+#endif
+    
+    w.flush();
+    return httpd_resp_send_chunk(req, nullptr, 0);   // Last chunk
 }
 
 // ===========================================
@@ -906,7 +1475,10 @@ void handleMVEL(const uint8_t* data, int length) {
     int16_t right = data[2] | (data[3] << 8);
     uint16_t duration = data[4] | (data[5] << 8);
     
-    setMotorSpeed(left, right, duration);
+    if (!motorSubmit(motorFromSerial, left, right, duration)) {
+        sendError("Motor queue full");
+        return;
+    }
     
     char msg[64];
     snprintf(msg, sizeof(msg), "MVEL L:%d R:%d D:%d", left, right, duration);
@@ -914,7 +1486,7 @@ void handleMVEL(const uint8_t* data, int length) {
 }
 
 void handleMSTOP() {
-    stopMotors();
+    motorRequestStop();
     sendOK("Motors stopped");
 }
 
@@ -927,39 +1499,51 @@ void handleDIMG(const uint8_t* data, int length) {
         return;
     }
     
-    // Copy data to image buffer
+    // The display task reads imageBuffer while loading the panel
+    if (xSemaphoreTake(frameMutex, 0) != pdTRUE) {
+        sendError("Display busy");
+        return;
+    }
     memcpy(imageBuffer, data, IMAGE_BUFFER_SIZE);
     bufferReady = true;
+    xSemaphoreGive(frameMutex);
     
-    // Display the image
-    EPD_4in2_V2_Display(imageBuffer);
+    // Refresh runs on the display task
+    if (!displaySubmit(DISPLAY_OP_SHOW)) {
+        sendError("Display queue full");
+        return;
+    }
     
-    sendOK("Image displayed");
+    sendOK("Image queued");
 }
 
 void handleDCLEAR() {
-    clearImageBuffer();
-    EPD_4in2_V2_Clear();
-    sendOK("Display cleared");
+    if (!displaySubmit(DISPLAY_OP_CLEAR)) {
+        sendError("Display queue full");
+        return;
+    }
+    sendOK("Display clear queued");
 }
 
 void handleDSTATUS() {
     char msg[64];
-    snprintf(msg, sizeof(msg), "Buffer:%d Ready:%d", 
-             bufferIndex, bufferReady ? 1 : 0);
+    snprintf(msg, sizeof(msg), "Buffer:%d Ready:%d Busy:%d Refresh:%lums", 
+             bufferIndex, bufferReady ? 1 : 0, displayBusy ? 1 : 0,
+             (unsigned long)lastRefreshMs);
     sendOK(msg);
 }
 
 void handleSRESET() {
-    stopMotors();
-    clearImageBuffer();
+    motorRequestStop();
+    vTaskDelay(pdMS_TO_TICKS(10));
     sendOK("System reset");
     delay(100);
     ESP.restart();
 }
 
 void handleSHALT() {
-    stopMotors();
+    motorRequestStop();
+    vTaskDelay(pdMS_TO_TICKS(10));
     sendOK("Entering deep sleep");
     delay(100);
     esp_deep_sleep_start();
@@ -969,22 +1553,284 @@ void handleSPING() {
     sendOK("pong");
 }
 
+void handleSTASKS() {
+    // name:hw=<free stack words>,cpu=<percent busy>,n=<iterations>;...
+    // Integer formatting only: newlib's float printf allocates.
+    char msg[384];
+    int pos = 0;
+    uint64_t uptimeUs = esp_timer_get_time();
+    for (int i = 0; i < TASK_COUNT; i++) {
+        const TaskInfo& t = taskInfo[i];
+        UBaseType_t hw = t.handle ? uxTaskGetStackHighWaterMark(t.handle) : 0;
+        uint32_t cpu = uptimeUs ? (uint32_t)(t.busyUs * 10000 / uptimeUs) : 0;  // 0.01 %
+        pos += snprintf(msg + pos, sizeof(msg) - pos, "%s%s:hw=%u,cpu=%u.%02u,n=%u",
+                        i ? ";" : "", t.name, (unsigned)hw, (unsigned)(cpu / 100),
+                        (unsigned)(cpu % 100), (unsigned)t.iterations);
+        if (pos >= (int)sizeof(msg)) break;
+    }
+    sendOK(msg);
+}
+
+void handleSPROF(const uint8_t* data, int length) {
+    // Single line, the serial response is newline-terminated
+    char msg[640];
+    profReport(msg, sizeof(msg), ';', false);
+    if (length == 5 && memcmp(data, "reset", 5) == 0) {
+        profReset();
+    }
+    sendOK(msg);
+}
+
+void handleSSTATS(const uint8_t* data, int length) {
+    static char msg[3072];
+    cmdStatsReport(msg, sizeof(msg));
+    if (length == 5 && memcmp(data, "reset", 5) == 0) {
+        cmdStatsReset();
+    }
+    sendOK(msg);
+}
+
+void handleSTRACE(const uint8_t* data, int length) {
+#if ENABLE_TRACE
+    // The ring stays frozen while it streams out; "clear" restarts it empty
+    size_t encoded = traceDumpBegin();
+    sendResponseBegin("OK", encoded);
+    traceDumpWrite(protoSerial);
+    sendResponseEnd();
+    traceDumpEnd(length == 5 && memcmp(data, "clear", 5) == 0);
+#else
+    sendError("Tracing disabled");
+#endif
+}
+
+void handleSHEAP() {
+    char msg[384];
+    allocTrackReport(msg, sizeof(msg));
+    sendOK(msg);
+}
+
+void handleSSCHED() {
+    char msg[128];
+    snprintf(msg, sizeof(msg), "armed:%u fired:%u late_avg:%luus late_max:%luus(%s)",
+             (unsigned)timerWheel.armed(), (unsigned)schedFired,
+             (unsigned long)(schedFired ? schedLateSumUs / schedFired : 0),
+             (unsigned long)schedLateMaxUs, schedLateMaxName);
+    sendOK(msg);
+}
+
+// ===========================================
+// Self-Benchmark (SBENCH)
+// ===========================================
+// Each test times the same work BENCH_RUNS times in CPU cycles and keeps
+// the fastest, so a preemption in one run does not count. Tests run on
+// the task that owns the hardware: the EPD shift on the display task, the
+// PWM writes on the motor task, the rest on the protocol task. Every wait
+// is bounded and the whole request kept under BENCH_BUDGET_MS, since
+// motor and heartbeat frames queue behind it.
+template <class F>
+static uint32_t benchCycles(F work) {
+    uint32_t best = UINT32_MAX;
+    for (int run = 0; run < BENCH_RUNS; run++) {
+        uint32_t start = esp_cpu_get_cycle_count();
+        work();
+        uint32_t cycles = esp_cpu_get_cycle_count() - start;
+        if (cycles < best) best = cycles;
+    }
+    return best;
+}
+
+// Display task: the EPD bit-bang with CS high, so the panel ignores it
+void epdBenchRun() {
+    digitalWrite(PIN_SPI_CS, HIGH);
+    uint32_t cycles = benchCycles([] {
+        for (int i = 0; i < BENCH_EPD_BYTES; i++) EPD_SPI_Shift(0xA5);
+    });
+    epdBenchResult = {benchSeq, BENCH_EPD_BYTES, cycles};
+    xSemaphoreGive(benchDone);
+}
+
+// Motor task: rewrites A1's current duty, so the motor does not change
+void ledcBenchRun() {
+    uint32_t duty = ledcRead(MOTOR_A1);
+    uint32_t cycles = benchCycles([duty] {
+        for (int i = 0; i < BENCH_LEDC_WRITES; i++) ledcWrite(MOTOR_A1, duty);
+    });
+    ledcBenchResult = {benchSeq, BENCH_LEDC_WRITES, cycles};
+    xSemaphoreGive(benchDone);
+}
+
+// Waits for the result of this request from another task
+static bool benchWait(const BenchResult& result, uint32_t seq) {
+    TickType_t deadline = xTaskGetTickCount() + pdMS_TO_TICKS(BENCH_WAIT_MS);
+    while (result.seq != seq) {
+        TickType_t left = deadline - xTaskGetTickCount();
+        if ((int32_t)left <= 0 || xSemaphoreTake(benchDone, left) != pdTRUE) return false;
+    }
+    return true;
+}
+
+// Copies bytes from one half of a caps buffer to the other,
+// BENCH_FAILED if it cannot be allocated
+static uint32_t memcpyBench(uint32_t caps, size_t bytes) {
+    uint8_t* buf = (uint8_t*)heap_caps_malloc(2 * bytes, caps);
+    if (!buf) return BENCH_FAILED;
+    uint32_t cycles = benchCycles([buf, bytes] { memcpy(buf + bytes, buf, bytes); });
+    heap_caps_free(buf);
+    return cycles;
+}
+
+// UART1 with its TX looped back to RX inside the chip: write the bytes
+// and read them all back. BENCH_FAILED if the driver cannot be set up or
+// bytes are lost.
+static uint32_t uartBench() {
+    uart_config_t config = {};
+    config.baud_rate = BENCH_UART_BAUD;
+    config.data_bits = UART_DATA_8_BITS;
+    config.parity = UART_PARITY_DISABLE;
+    config.stop_bits = UART_STOP_BITS_1;
+    config.flow_ctrl = UART_HW_FLOWCTRL_DISABLE;
+    config.source_clk = UART_SCLK_DEFAULT;
+    if (uart_driver_install(BENCH_UART, 2 * BENCH_UART_BYTES, 0, 0, nullptr, 0) != ESP_OK) {
+        return BENCH_FAILED;
+    }
+    bool ok = uart_param_config(BENCH_UART, &config) == ESP_OK &&
+              uart_set_loop_back(BENCH_UART, true) == ESP_OK;
+    uint32_t cycles = 0;
+    if (ok) {
+        // The payload does not matter, so the frame is read without its lock
+        cycles = benchCycles([&ok] {
+            uart_write_bytes(BENCH_UART, imageBuffer, BENCH_UART_BYTES);
+            uint8_t chunk[128];
+            int received = 0;
+            while (received < BENCH_UART_BYTES) {
+                int n = uart_read_bytes(BENCH_UART, chunk, sizeof(chunk), pdMS_TO_TICKS(20));
+                if (n <= 0) break;
+                received += n;
+            }
+            if (received < BENCH_UART_BYTES) ok = false;
+        });
+    }
+    uart_set_loop_back(BENCH_UART, false);
+    uart_driver_delete(BENCH_UART);
+    return ok ? cycles : BENCH_FAILED;
+}
+
+// Test names in data: a comma-separated list, empty for all
+static bool benchSelected(const uint8_t* data, int length, const char* name) {
+    if (length == 0) return true;
+    int nameLength = strlen(name);
+    for (int start = 0; start < length;) {
+        int end = start;
+        while (end < length && data[end] != ',') end++;
+        if (end - start == nameLength && memcmp(data + start, name, nameLength) == 0) return true;
+        start = end + 1;
+    }
+    return false;
+}
+
+static void benchAppend(char* msg, size_t size, int& pos, const char* name, uint32_t count,
+                        uint32_t cycles, const char* failure) {
+    if (pos >= (int)size) return;
+    if (cycles != BENCH_FAILED) {
+        pos += snprintf(msg + pos, size - pos, " %s:%u/%u", name, (unsigned)count, (unsigned)cycles);
+    } else {
+        pos += snprintf(msg + pos, size - pos, " %s:%s", name, failure);
+    }
+}
+
+void handleSBENCH(const uint8_t* data, int length) {
+    // mhz:<MHz> <test>:<bytes or writes>/<cycles> ..., or <test>:<reason>
+    char msg[192];
+    int pos = snprintf(msg, sizeof(msg), "mhz:%u", (unsigned)getCpuFrequencyMhz());
+    uint32_t seq = benchSeq + 1;
+    benchSeq = seq;
+    uint32_t startMs = millis();
+    // Selected and started within the budget
+    auto run = [&](const char* name) {
+        if (!benchSelected(data, length, name)) return false;
+        if (millis() - startMs < BENCH_BUDGET_MS) return true;
+        benchAppend(msg, sizeof(msg), pos, name, 0, BENCH_FAILED, "skipped");
+        return false;
+    };
+    
+    if (run("epd")) {
+        // Only on an idle display, not after a refresh that takes seconds
+        bool queued = !displayBusy && uxQueueMessagesWaiting(displayQueue) == 0 &&
+                      displaySubmit(DISPLAY_OP_BENCH);
+        bool done = queued && benchWait(epdBenchResult, seq);
+        benchAppend(msg, sizeof(msg), pos, "epd", BENCH_EPD_BYTES,
+                    done ? epdBenchResult.cycles : BENCH_FAILED, queued ? "timeout" : "busy");
+    }
+    if (run("ledc")) {
+        motorBenchRequested.store(true, std::memory_order_release);
+        xTaskNotifyGive(taskInfo[TASK_MOTOR].handle);
+        bool done = benchWait(ledcBenchResult, seq);
+        benchAppend(msg, sizeof(msg), pos, "ledc", BENCH_LEDC_WRITES,
+                    done ? ledcBenchResult.cycles : BENCH_FAILED, "timeout");
+    }
+    if (run("crc")) {
+        uint32_t cycles = BENCH_FAILED;
+        if (xSemaphoreTake(frameMutex, pdMS_TO_TICKS(BENCH_LOCK_MS)) == pdTRUE) {
+            cycles = benchCycles([] {
+                volatile uint16_t crc = calculateCRC(imageBuffer, IMAGE_BUFFER_SIZE);
+                (void)crc;
+            });
+            xSemaphoreGive(frameMutex);
+        }
+        benchAppend(msg, sizeof(msg), pos, "crc", IMAGE_BUFFER_SIZE, cycles, "busy");
+    }
+    if (run("memcpy_int")) {
+        benchAppend(msg, sizeof(msg), pos, "memcpy_int", BENCH_MEMCPY_INTERNAL,
+                    memcpyBench(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT, BENCH_MEMCPY_INTERNAL), "no_mem");
+    }
+    if (run("memcpy_psram")) {
+        uint32_t cycles = psramFound() ? memcpyBench(MALLOC_CAP_SPIRAM, BENCH_MEMCPY_PSRAM) : BENCH_FAILED;
+        benchAppend(msg, sizeof(msg), pos, "memcpy_psram", BENCH_MEMCPY_PSRAM, cycles,
+                    psramFound() ? "no_mem" : "none");
+    }
+    if (run("uart")) {
+#if LOG_OUTPUT == LOG_OUTPUT_UART
+        benchAppend(msg, sizeof(msg), pos, "uart", BENCH_UART_BYTES, BENCH_FAILED, "busy");  // UART1 carries the log
+#else
+        benchAppend(msg, sizeof(msg), pos, "uart", BENCH_UART_BYTES, uartBench(), "failed");
+#endif
+    }
+    sendOK(msg);
+}
+
 // ===========================================
 // Protocol Parser
 // ===========================================
 void processCommand(const char* cmd, const uint8_t* data, int dataLength, const char* crcStr) {
+    PROF_SCOPE(PROF_COMMAND);
+    PROF_CULPRIT(PROF_COMMAND, cmd);
+    TRACE_SCOPE(TRACE_COMMAND, cmd);
+    cmdStatsDispatch();
+    
+    if (dataLength > MAX_COMMAND_SIZE) {
+        sendError("Command too large");
+        return;
+    }
+    
     // Verify CRC
     uint16_t expectedCRC = calculateCRC(data, dataLength);
     uint16_t receivedCRC = (uint16_t)strtol(crcStr, nullptr, 16);
+    cmdStatsCrcDone();
     
     if (expectedCRC != receivedCRC) {
         char msg[64];
         snprintf(msg, sizeof(msg), "CRC mismatch: expected %04X, got %04X", 
                  expectedCRC, receivedCRC);
+        LOG_D("%s: %s", cmd, msg);
         sendError(msg);
         return;
     }
     
+    // Any valid frame counts as a host heartbeat
+    if (LINK_HEARTBEAT_TIMEOUT_MS > 0) {
+        schedulerArm(&heartbeatTimer, LINK_HEARTBEAT_TIMEOUT_MS);
+    }
+    
     // Dispatch command
     if (strcmp(cmd, "MVEL") == 0) {
         handleMVEL(data, dataLength);
@@ -1002,18 +1848,41 @@ void processCommand(const char* cmd, const uint8_t* data, int dataLength, const
         handleSHALT();
     } else if (strcmp(cmd, "SPING") == 0) {
         handleSPING();
+    } else if (strcmp(cmd, "STASKS") == 0) {
+        handleSTASKS();
+    } else if (strcmp(cmd, "SSCHED") == 0) {
+        handleSSCHED();
+    } else if (strcmp(cmd, "SHEAP") == 0) {
+        handleSHEAP();
+    } else if (strcmp(cmd, "SPROF") == 0) {
+        handleSPROF(data, dataLength);
+    } else if (strcmp(cmd, "SSTATS") == 0) {
+        handleSSTATS(data, dataLength);
+    } else if (strcmp(cmd, "STRACE") == 0) {
+        handleSTRACE(data, dataLength);
+    } else if (strcmp(cmd, "SBENCH") == 0) {
+        handleSBENCH(data, dataLength);
     } else {
         char msg[32];
         snprintf(msg, sizeof(msg), "Unknown command: %s", cmd);
         sendError(msg);
+        return;
     }
+    cmdStatsCommand(cmd);
 }
 
-void parseSerialData() {
-    while (Serial.available() > 0) {
-        char c = Serial.read();
-        
-        if (!receivingData) {
+void resetParser() {
+    parseState = PARSE_HEADER;
+    cmdIndex = 0;
+    dataIndex = 0;
+    crcIndex = 0;
+    expectedDataLength = 0;
+}
+
+void parseByte(char c) {
+    cmdStatsByte();
+    switch (parseState) {
+        case PARSE_HEADER:
             // Reading command header: CMD<LENGTH>\n
             if (c == '\n') {
                 cmdBuffer[cmdIndex] = '\0';
@@ -1026,99 +1895,460 @@ void parseSerialData() {
                     expectedDataLength = atoi(cmdEnd);
                     *cmdEnd = '\0';
                     
-                    receivingData = true;
                     dataIndex = 0;
+                    parseState = expectedDataLength > 0 ? PARSE_DATA : PARSE_DATA_END;
+                } else {
+                    // Not a header (blank or stray line): no frame started
+                    cmdStatsDiscard();
                 }
                 cmdIndex = 0;
-            } else if (cmdIndex < sizeof(cmdBuffer) - 1) {
+            } else if (cmdIndex < (int)sizeof(cmdBuffer) - 1) {
                 cmdBuffer[cmdIndex++] = c;
             }
-        } else {
-            // Reading data + CRC
-            if (dataIndex < expectedDataLength) {
-                dataBuffer[dataIndex++] = c;
-            } else if (c == '\n') {
-                // Read CRC
-                char crcBuffer[8];
-                int crcIndex = 0;
-                while (Serial.available() > 0 && crcIndex < 5) {
-                    char crcChar = Serial.read();
-                    if (crcChar == '\n') break;
-                    crcBuffer[crcIndex++] = crcChar;
-                }
+            break;
+            
+        case PARSE_DATA:
+            // Oversized payloads are consumed but not stored
+            if (dataIndex < MAX_COMMAND_SIZE) {
+                dataBuffer[dataIndex] = c;
+            }
+            if (++dataIndex >= expectedDataLength) {
+                parseState = PARSE_DATA_END;
+            }
+            break;
+            
+        case PARSE_DATA_END:
+            if (c == '\n') {
+                crcIndex = 0;
+                parseState = PARSE_CRC;
+            }
+            break;
+            
+        case PARSE_CRC:
+            if (c == '\n') {
                 crcBuffer[crcIndex] = '\0';
-                
                 processCommand(cmdBuffer, dataBuffer, expectedDataLength, crcBuffer);
-                
-                receivingData = false;
-                cmdIndex = 0;
-                dataIndex = 0;
-                expectedDataLength = 0;
+                cmdStatsEnd();
+                resetParser();
+            } else if (crcIndex < (int)sizeof(crcBuffer) - 1) {
+                crcBuffer[crcIndex++] = c;
             }
+            break;
+    }
+}
+
+// Runs on the UART event task: move received bytes into the ring
+void onSerialReceive() {
+    uint8_t chunk[64];
+    bool pushed = false;
+    int avail;
+    while ((avail = protoSerial.available()) > 0) {
+        size_t space = uartRxRing.capacity() - uartRxRing.size();
+        if (space == 0) break;
+        size_t n = protoSerial.readBytes(chunk, min((size_t)avail, min(space, sizeof(chunk))));
+        uartRxRing.pushN(chunk, n);
+        pushed = true;
+    }
+    if (pushed && taskInfo[TASK_PROTOCOL].handle) {
+        xTaskNotifyGive(taskInfo[TASK_PROTOCOL].handle);
+    }
+}
+
+// Set by the frame timeout callback, consumed by the protocol task
+std::atomic<bool> frameTimedOut{false};
+
+void parseSerialData() {
+    PROF_SCOPE(PROF_PARSE);
+    uint8_t chunk[64];
+    size_t n;
+    bool received = false;
+    while ((n = uartRxRing.popN(chunk, sizeof(chunk))) > 0) {
+        for (size_t i = 0; i < n; i++) {
+            parseByte((char)chunk[i]);
         }
+        received = true;
+    }
+    
+    if (frameTimedOut.exchange(false) && !received && parseState != PARSE_HEADER) {
+        resetParser();
+        cmdStatsDiscard();
+        frameTimeouts++;
+        LOG_W("Partial frame dropped after %d ms", CMD_TIMEOUT_MS);
+        sendError("Command timeout");
+        return;
+    }
+    
+    // A frame stalled mid-way for CMD_TIMEOUT_MS is dropped
+    if (received) {
+        if (parseState != PARSE_HEADER) {
+            schedulerArm(&frameTimeoutTimer, CMD_TIMEOUT_MS);
+        } else {
+            schedulerCancel(&frameTimeoutTimer);
+        }
+    }
+}
+
+// Scheduler callback: no bytes arrived for CMD_TIMEOUT_MS mid-frame
+void onFrameTimeout(void* arg) {
+    frameTimedOut.store(true);
+    xTaskNotifyGive(taskInfo[TASK_PROTOCOL].handle);
+}
+
+// Scheduler callback: no valid frame for LINK_HEARTBEAT_TIMEOUT_MS
+void onHeartbeatLost(void* arg) {
+    // This task outranks the motor task on core 1, so a read can land in
+    // the middle of its publish and give up; stop then as well
+    MotorState state;
+    if (!motorState.read(state) || state.running) {
+        motorRequestStop();
     }
 }
 
+// ===========================================
+// FreeRTOS Tasks
+// ===========================================
+void motorTask(void* arg) {
+    MotorCommand mc;
+    for (;;) {
+        // Woken by new commands, stop requests and the cutoff timer
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        int64_t start = esp_timer_get_time();
+        PROF_SCOPE(PROF_MOTOR);
+        
+        if (motorStopRequested.exchange(false, std::memory_order_acquire)) {
+            motorFromSerial.clear();
+            motorFromWeb.clear();
+            stopMotors();
+        }
+        while (motorFromSerial.pop(mc)) {
+            setMotorSpeed(mc.left, mc.right, mc.duration_ms);
+        }
+        while (motorFromWeb.pop(mc)) {
+            setMotorSpeed(mc.left, mc.right, mc.duration_ms);
+        }
+        checkMotorTimeout();
+        if (motorBenchRequested.exchange(false, std::memory_order_acquire)) {
+            ledcBenchRun();
+        }
+        taskAccount(TASK_MOTOR, start);
+    }
+}
+
+void protocolTask(void* arg) {
+    for (;;) {
+        // Woken by onSerialReceive(); the timeout only bounds a lost wakeup
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(100));
+        int64_t start = esp_timer_get_time();
+        parseSerialData();
+        taskAccount(TASK_PROTOCOL, start);
+    }
+}
+
+static void displayAccount(DisplayOp op, int64_t startUs) {
+    uint32_t us = (uint32_t)(esp_timer_get_time() - startUs);
+    displayOpStats[op].count++;
+    displayOpStats[op].lastMs = us / 1000;
+    displayOpStats[op].us.record(us);
+}
+
+void displayTask(void* arg) {
+    DisplayOp op;
+    for (;;) {
+        if (xQueueReceive(displayQueue, &op, portMAX_DELAY) != pdTRUE) continue;
+        int64_t start = esp_timer_get_time();
+        PROF_SCOPE(PROF_DISPLAY);
+        PROF_CULPRIT(PROF_DISPLAY, displayOpNames[op]);
+        TRACE_SCOPE(TRACE_DISPLAY_JOB, displayOpNames[op]);
+        
+        if (op == DISPLAY_OP_POWER_OFF) {
+            if (displayPowered) {
+                digitalWrite(PIN_SPI_PWR, LOW);
+                displayPowered = false;
+            }
+            displayAccount(op, start);
+            taskAccount(TASK_DISPLAY, start);
+            continue;
+        }
+        if (op == DISPLAY_OP_BENCH) {
+            // Panel deselected throughout, so it needs no power or reset
+            epdBenchRun();
+            displayAccount(op, start);
+            taskAccount(TASK_DISPLAY, start);
+            continue;
+        }
+        
+        displayJobOp = op;
+        displayJobStartMs = millis();
+        displayBusy = true;
+        if (!displayPowered) {
+            // Every job starts with EPD_Reset, which also wakes the panel
+            digitalWrite(PIN_SPI_PWR, HIGH);
+            displayPowered = true;
+            delay(10);
+        }
+        
+        switch (op) {
+            case DISPLAY_OP_INIT:
+                EPD_4in2_V2_Init();
+                break;
+            case DISPLAY_OP_SHOW: {
+                // Hold the frame only while it is copied to panel RAM. A
+                // failed upload since the job was queued left it partial.
+                xSemaphoreTake(frameMutex, portMAX_DELAY);
+                bool ready = bufferReady;
+                if (ready) EPD_4in2_V2_Load(imageBuffer);
+                xSemaphoreGive(frameMutex);
+                if (ready) {
+                    EPD_4in2_V2_Show();
+                } else {
+                    LOG_W("Frame buffer not ready (failed upload), refresh skipped");
+                }
+                break;
+            }
+            case DISPLAY_OP_CLEAR:
+                xSemaphoreTake(frameMutex, portMAX_DELAY);
+                clearImageBuffer();
+                xSemaphoreGive(frameMutex);
+                EPD_4in2_V2_Clear();
+                break;
+            default:
+                break;
+        }
+        
+        displayBusy = false;
+        schedulerArm(&displayIdleTimer, DISPLAY_IDLE_SLEEP_MS);
+        displayAccount(op, start);
+        taskAccount(TASK_DISPLAY, start);
+    }
+}
+
+void startHttpServer();   // With the HTTP handlers below
+
+void networkTask(void* arg) {
+    WiFi.mode(WIFI_AP);
+    WiFi.softAPConfig(AP_LOCAL_IP, AP_GATEWAY, AP_SUBNET);
+    WiFi.softAP(AP_SSID, AP_PASSWORD, AP_CHANNEL, 0, AP_MAX_CONNECTIONS);
+    LOG_I("WiFi Access Point started: SSID %s, password %s, IP %u.%u.%u.%u", AP_SSID, AP_PASSWORD,
+          AP_LOCAL_IP[0], AP_LOCAL_IP[1], AP_LOCAL_IP[2], AP_LOCAL_IP[3]);
+    // httpd opens its listen socket at once, so only once the AP's
+    // netif exists
+    startHttpServer();
+#if configGENERATE_RUN_TIME_STATS
+    for (NetSysTask& t : netSysTasks) t.handle = xTaskGetHandle(t.name);
+#endif
+    
+    // Captive DNS: block until a query arrives, answer it, block again
+    int sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(DNS_PORT);
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (sock < 0 || bind(sock, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+        LOG_E("DNS socket failed");
+        vTaskSuspend(NULL);   // Stay in taskInfo; the portal still works by IP
+    }
+    LOG_I("DNS server started");
+    
+    const uint8_t ip[4] = {AP_LOCAL_IP[0], AP_LOCAL_IP[1], AP_LOCAL_IP[2], AP_LOCAL_IP[3]};
+    static uint8_t packet[CAPTIVE_DNS_MAX_LEN];
+    for (;;) {
+        struct sockaddr_in from;
+        socklen_t fromLen = sizeof(from);
+        int n = recvfrom(sock, packet, sizeof(packet), 0, (struct sockaddr*)&from, &fromLen);
+        if (n <= 0) continue;
+        int64_t start = esp_timer_get_time();
+        {
+            PROF_SCOPE(PROF_DNS);
+            size_t reply = captiveDnsAnswer(packet, n, sizeof(packet), ip);
+            if (reply > 0) {
+                sendto(sock, packet, reply, 0, (struct sockaddr*)&from, fromLen);
+                dnsAnswered++;
+            } else {
+                dnsDropped++;
+            }
+        }
+        taskAccount(TASK_NETWORK, start);
+    }
+}
+
+// Scheduler callback: refresh the telemetry snapshot
+void onTelemetrySample(void* arg) {
+    TelemetrySample sample = {};
+    // Kept from the last sample if the read gives up: this task can
+    // preempt the motor task mid-publish
+    static MotorState motor = {};
+    motorState.read(motor);
+    sample.uptimeMs = millis();
+    sample.motorLeft = motor.left;
+    sample.motorRight = motor.right;
+    sample.motorsRunning = motor.running;
+    sample.displayBusy = displayBusy;
+    sample.lastRefreshMs = lastRefreshMs;
+    sample.freeHeap = ESP.getFreeHeap();
+#if BATTERY_ADC_PIN >= 0
+    sample.batteryMv = analogReadMilliVolts(BATTERY_ADC_PIN) * BATTERY_DIVIDER;
+#endif
+    telemetry.publish(sample);
+    telemetryPushRequest();
+}
+
+void schedulerTask(void* arg) {
+    uint32_t processed = timerWheel.now();
+    TimerEvent* fire[SCHED_MAX_EXPIRED];
+    
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        int64_t start = esp_timer_get_time();
+        
+        while (processed != schedTick) {
+            processed++;
+            
+            // Detach this tick's events; periodic ones are re-armed
+            // relative to their due tick so they do not drift
+            int count = 0;
+            portENTER_CRITICAL(&schedMux);
+            TimerEvent* ev = timerWheel.tick();
+            while (ev) {
+                TimerEvent* next = ev->next;
+                if (count < SCHED_MAX_EXPIRED) {
+                    fire[count++] = ev;
+                    if (ev->period) timerWheel.addAt(ev, ev->expires + ev->period);
+                } else {
+                    timerWheel.addAt(ev, processed + 1);
+                }
+                ev = next;
+            }
+            portEXIT_CRITICAL(&schedMux);
+            
+            int64_t due = schedStartUs + (int64_t)processed * SCHED_TICK_US;
+            for (int i = 0; i < count; i++) {
+                int64_t late = esp_timer_get_time() - due;
+                uint32_t lateUs = late > 0 ? (uint32_t)late : 0;
+                fire[i]->fired++;
+                if (lateUs > fire[i]->maxLateUs) fire[i]->maxLateUs = lateUs;
+                schedFired++;
+                schedLateSumUs += lateUs;
+                if (lateUs > schedLateMaxUs) {
+                    schedLateMaxUs = lateUs;
+                    schedLateMaxName = fire[i]->name;
+                }
+                PROF_SCOPE(PROF_TIMER);
+                PROF_CULPRIT(PROF_TIMER, fire[i]->name);
+                TRACE_SCOPE(TRACE_TIMER, fire[i]->name);
+                fire[i]->callback(fire[i]->arg);
+            }
+        }
+        taskAccount(TASK_SCHEDULER, start);
+    }
+}
+
+static const httpd_uri_t httpRoutes[] = {
+    {"/", HTTP_GET, handleRoot, nullptr},
+    {"/upload", HTTP_POST, handleUpload, nullptr},
+    {"/clear", HTTP_POST, handleClear, nullptr},
+    {"/motor", HTTP_POST, handleMotor, nullptr},
+    {"/preview", HTTP_GET, handlePreview, nullptr},
+    {"/profile", HTTP_GET, handleProfile, nullptr},
+    {"/metrics", HTTP_GET, handleMetrics, nullptr},
+    {"/ws/motor", HTTP_GET, handleMotorSocket, nullptr, true},
+    {"/ws/telemetry", HTTP_GET, handleTelemetrySocket, nullptr, true},
+};
+
+// Socket closed (client gone, or purged for a new one). A driver that
+// drops off stops the motors now rather than at the end of its lease.
+// httpd leaves closing the socket to close_fn.
+static void httpOnClose(httpd_handle_t server, int fd) {
+    if (fd == motorSocketFd) {
+        motorSocketFd = -1;
+        motorRequestStop();
+        LOG_I("Motor socket %d closed, motors stopped", fd);
+    }
+    telemetryRemoveClient(fd);
+    close(fd);
+}
+
+void startHttpServer() {
+    httpd_config_t config = HTTPD_DEFAULT_CONFIG();
+    config.core_id = HTTP_TASK_CORE;
+    config.task_priority = HTTP_TASK_PRIO;
+    config.stack_size = HTTP_TASK_STACK;
+    config.max_open_sockets = HTTP_MAX_CLIENTS;
+    config.max_uri_handlers = sizeof(httpRoutes) / sizeof(httpRoutes[0]);
+    config.lru_purge_enable = true;   // A new client evicts the idlest one
+    config.recv_wait_timeout = HTTP_RECV_TIMEOUT_S;
+    config.send_wait_timeout = HTTP_RECV_TIMEOUT_S;
+    config.close_fn = httpOnClose;
+    for (TelemetryClient& c : telemetryClients) c.fd = -1;
+    if (httpd_start(&httpServer, &config) != ESP_OK) {
+        LOG_E("Web server failed to start");
+        return;
+    }
+    for (const httpd_uri_t& route : httpRoutes) {
+        httpd_register_uri_handler(httpServer, &route);
+    }
+    taskInfo[TASK_HTTP].handle = xTaskGetHandle("httpd");
+    traceRegisterThread(taskInfo[TASK_HTTP].handle, taskInfo[TASK_HTTP].name);
+    LOG_I("Web server started on port 80");
+}
+
+void startTasks() {
+    displayQueue = xQueueCreate(DISPLAY_QUEUE_LEN, sizeof(DisplayOp));
+    frameMutex = xSemaphoreCreateMutex();
+    benchDone = xSemaphoreCreateBinary();
+    
+    xTaskCreatePinnedToCore(motorTask, "motor", MOTOR_TASK_STACK, nullptr,
+                            MOTOR_TASK_PRIO, &taskInfo[TASK_MOTOR].handle, MOTOR_TASK_CORE);
+    xTaskCreatePinnedToCore(protocolTask, "protocol", PROTOCOL_TASK_STACK, nullptr,
+                            PROTOCOL_TASK_PRIO, &taskInfo[TASK_PROTOCOL].handle, PROTOCOL_TASK_CORE);
+    xTaskCreatePinnedToCore(displayTask, "display", DISPLAY_TASK_STACK, nullptr,
+                            DISPLAY_TASK_PRIO, &taskInfo[TASK_DISPLAY].handle, DISPLAY_TASK_CORE);
+    xTaskCreatePinnedToCore(networkTask, "network", NETWORK_TASK_STACK, nullptr,
+                            NETWORK_TASK_PRIO, &taskInfo[TASK_NETWORK].handle, NETWORK_TASK_CORE);
+    xTaskCreatePinnedToCore(schedulerTask, "scheduler", SCHED_TASK_STACK, nullptr,
+                            SCHED_TASK_PRIO, &taskInfo[TASK_SCHEDULER].handle, SCHED_TASK_CORE);
+    // httpd registers itself once the network task has started it
+    for (int i = 0; i < TASK_COUNT; i++) {
+        if (taskInfo[i].handle) traceRegisterThread(taskInfo[i].handle, taskInfo[i].name);
+    }
+    
+    // Feed the protocol task from the UART event task from now on
+    transportOnReceive(onSerialReceive);
+    
+    schedulerArm(&telemetryTimer, TELEMETRY_PERIOD_MS);
+    
+    LOG_I("Tasks started (motor, protocol, display, network, scheduler)");
+}
+
 // ===========================================
 // Setup and Loop
 // ===========================================
 void setup() {
-    Serial.begin(SERIAL_BAUD);
+    transportInit();
+    logInit();
     delay(1000);
     
-    Serial.println("\n========================================");
-    Serial.println("Spherical Robot ESP32 Firmware");
-    Serial.println("Motor + E-Paper + Web Portal");
-    Serial.println("========================================");
+    LOG_I("Spherical Robot ESP32 Firmware: Motor + E-Paper + Web Portal");
     
     // Initialize subsystems
     initMotors();
     initEPD();
     initImageBuffer();
     
-    // Initialize display
-    EPD_4in2_V2_Init();
+    // The access point and captive DNS come up on the network task
+    profInit();
+    initScheduler();
+    startTasks();
     
-    // Setup WiFi Access Point
-    WiFi.mode(WIFI_AP);
-    WiFi.softAPConfig(AP_LOCAL_IP, AP_GATEWAY, AP_SUBNET);
-    WiFi.softAP(AP_SSID, AP_PASSWORD, AP_CHANNEL, 0, AP_MAX_CONNECTIONS);
-    
-    Serial.println("\n[OK] WiFi Access Point started");
-    Serial.printf("    SSID: %s\n", AP_SSID);
-    Serial.printf("    Password: %s\n", AP_PASSWORD);
-    Serial.printf("    IP: %s\n", AP_LOCAL_IP.toString().c_str());
-    
-    // Start DNS server for captive portal
-    dnsServer.start(DNS_PORT, "*", AP_LOCAL_IP);
-    Serial.println("[OK] DNS server started");
+    // Initialize display on the display task so boot does not wait for it
+    displaySubmit(DISPLAY_OP_INIT);
     
-    // Setup web server routes
-    server.on("/", HTTP_GET, handleRoot);
-    server.on("/upload", HTTP_POST, handleUpload);
-    server.on("/clear", HTTP_POST, handleClear);
-    server.on("/motor", HTTP_POST, handleMotor);
-    server.begin();
-    Serial.println("[OK] Web server started on port 80");
+    // Everything from here on should run without heap allocations
+    allocTrackArm();
     
-    Serial.println("\n========================================");
-    Serial.println("Ready!");
-    Serial.println("Serial: <CMD><LEN>\\n<DATA>\\n<CRC>\\n");
-    Serial.println("Web: Connect to WiFi and open browser");
-    Serial.println("========================================\n");
+    LOG_I("Ready. Serial: <CMD><LEN>\\n<DATA>\\n<CRC>\\n, web: join the access point");
 }
 
 void loop() {
-    // Handle DNS and web server
-    dnsServer.processNextRequest();
-    server.handleClient();
-    
-    // Check for serial commands
-    parseSerialData();
-    
-    // Check motor timeout
-    checkMotorTimeout();
-    
-    // Small delay to prevent tight loop
-    delay(1);
+    // All work runs in the tasks started by setup()
+    vTaskDelete(NULL);
 }
@@ -0,0 +1,217 @@
+#ifndef FRAME_PREVIEW_H
+#define FRAME_PREVIEW_H
+
+/*
+ * Streaming image encoder for the 1-bit frame buffer.
+ *
+ * FramePreview turns rows of packed pixels (MSB first, 1 = white, the
+ * EPD's own layout) into a PNG or BMP as they are fed in, through a small
+ * fixed buffer handed to a sink whenever it fills, so an image of any size
+ * needs neither a copy of the frame nor heap.
+ *
+ * - PNG: 1-bit grayscale, filter "none", zlib stream of stored (not
+ *   compressed) deflate blocks. Every length is known up front, so the
+ *   chunk CRC and Adler-32 are computed on the fly.
+ * - BMP: 1-bit with a black/white palette, rows bottom-up as BMP readers
+ *   expect, so feed the rows in rowAt() order.
+ *
+ * The header has no Arduino dependency so the host tools can build it.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define PREVIEW_CHUNK_SIZE 1024
+
+enum PreviewFormat : uint8_t {
+    PREVIEW_PNG,
+    PREVIEW_BMP,
+};
+
+typedef void (*PreviewSink)(void* ctx, const uint8_t* data, size_t length);
+
+// CRC-32 (IEEE, as in PNG and zlib), half a byte per step from a 16-entry table
+static inline uint32_t crc32Update(uint32_t crc, const uint8_t* data, size_t length) {
+    static const uint32_t table[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+    };
+    crc = ~crc;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ table[crc & 0x0F];
+        crc = (crc >> 4) ^ table[crc & 0x0F];
+    }
+    return ~crc;
+}
+
+class FramePreview {
+public:
+    FramePreview(PreviewFormat format, uint16_t width, uint16_t height, PreviewSink sink, void* ctx)
+        : _format(format), _width(width), _height(height), _stride((width + 7) / 8),
+          _sink(sink), _ctx(ctx) {}
+
+    // Row to feed as the i-th call to row()
+    uint16_t rowAt(uint16_t i) const {
+        return _format == PREVIEW_BMP ? _height - 1 - i : i;
+    }
+
+    void begin() {
+        if (_format == PREVIEW_PNG) {
+            static const uint8_t signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+            put(signature, 8);
+            uint8_t ihdr[13];
+            be32(ihdr, _width);
+            be32(ihdr + 4, _height);
+            ihdr[8] = 1;    // Bit depth
+            ihdr[9] = 0;    // Grayscale
+            ihdr[10] = 0;   // Deflate
+            ihdr[11] = 0;   // Adaptive filtering (every row uses "none")
+            ihdr[12] = 0;   // Not interlaced
+            chunkBegin("IHDR", sizeof(ihdr));
+            chunkPut(ihdr, sizeof(ihdr));
+            chunkEnd();
+
+            // One IDAT: zlib header, stored blocks of at most 65535 bytes, Adler-32
+            _rawLeft = (uint32_t)_height * (1 + _stride);
+            uint32_t blocks = (_rawLeft + 65534) / 65535;
+            chunkBegin("IDAT", 2 + blocks * 5 + _rawLeft + 4);
+            static const uint8_t zlibHeader[2] = {0x78, 0x01};
+            chunkPut(zlibHeader, 2);
+            _adlerA = 1;
+            _adlerB = 0;
+            _blockLeft = 0;
+        } else {
+            uint32_t rowSize = ((_width + 31) / 32) * 4;
+            uint32_t imageSize = rowSize * _height;
+            uint8_t header[62] = {'B', 'M'};
+            le32(header + 2, 62 + imageSize);
+            le32(header + 10, 62);           // Pixel data offset
+            le32(header + 14, 40);           // BITMAPINFOHEADER
+            le32(header + 18, _width);
+            le32(header + 22, _height);      // Positive: bottom-up
+            header[26] = 1;                  // Planes
+            header[28] = 1;                  // Bits per pixel
+            le32(header + 34, imageSize);
+            le32(header + 38, 2835);         // 72 dpi
+            le32(header + 42, 2835);
+            le32(header + 46, 2);            // Palette entries
+            le32(header + 50, 2);
+            // Palette: index 0 black, index 1 white (BGRx)
+            header[58] = header[59] = header[60] = 0xFF;
+            put(header, sizeof(header));
+        }
+    }
+
+    // One row of packed pixels, _stride bytes
+    void row(const uint8_t* bits) {
+        if (_format == PREVIEW_PNG) {
+            static const uint8_t filterNone = 0;
+            rawPut(&filterNone, 1);
+            rawPut(bits, _stride);
+        } else {
+            static const uint8_t padding[3] = {0, 0, 0};
+            put(bits, _stride);
+            put(padding, (4 - _stride % 4) % 4);
+        }
+    }
+
+    void end() {
+        if (_format == PREVIEW_PNG) {
+            uint8_t adler[4];
+            be32(adler, (_adlerB << 16) | _adlerA);
+            chunkPut(adler, 4);
+            chunkEnd();
+            chunkBegin("IEND", 0);
+            chunkEnd();
+        }
+        flush();
+    }
+
+private:
+    PreviewFormat _format;
+    uint16_t _width;
+    uint16_t _height;
+    uint16_t _stride;
+    PreviewSink _sink;
+    void* _ctx;
+    uint8_t _buf[PREVIEW_CHUNK_SIZE];
+    size_t _len = 0;
+
+    // PNG state
+    uint32_t _crc = 0;
+    uint32_t _adlerA = 1;
+    uint32_t _adlerB = 0;
+    uint32_t _rawLeft = 0;     // Uncompressed bytes still to come
+    uint32_t _blockLeft = 0;   // Bytes left in the current stored block
+
+    static void be32(uint8_t* p, uint32_t v) {
+        p[0] = v >> 24; p[1] = v >> 16; p[2] = v >> 8; p[3] = v;
+    }
+    static void le32(uint8_t* p, uint32_t v) {
+        p[0] = v; p[1] = v >> 8; p[2] = v >> 16; p[3] = v >> 24;
+    }
+
+    void put(const uint8_t* data, size_t length) {
+        while (length > 0) {
+            size_t n = length < sizeof(_buf) - _len ? length : sizeof(_buf) - _len;
+            memcpy(_buf + _len, data, n);
+            _len += n;
+            data += n;
+            length -= n;
+            if (_len == sizeof(_buf)) flush();
+        }
+    }
+
+    void flush() {
+        if (_len > 0) _sink(_ctx, _buf, _len);
+        _len = 0;
+    }
+
+    void chunkBegin(const char* type, uint32_t length) {
+        uint8_t head[4];
+        be32(head, length);
+        put(head, 4);
+        _crc = 0;
+        chunkPut((const uint8_t*)type, 4);
+    }
+
+    void chunkPut(const uint8_t* data, size_t length) {
+        _crc = crc32Update(_crc, data, length);
+        put(data, length);
+    }
+
+    void chunkEnd() {
+        uint8_t crc[4];
+        be32(crc, _crc);
+        put(crc, 4);
+    }
+
+    // Image data inside the zlib stream, with stored block headers as needed
+    void rawPut(const uint8_t* data, size_t length) {
+        while (length > 0) {
+            if (_blockLeft == 0) {
+                _blockLeft = _rawLeft < 65535 ? _rawLeft : 65535;
+                uint8_t head[5] = {
+                    (uint8_t)(_blockLeft == _rawLeft ? 1 : 0),   // BFINAL, BTYPE 00
+                    (uint8_t)_blockLeft, (uint8_t)(_blockLeft >> 8),
+                    (uint8_t)~_blockLeft, (uint8_t)(~_blockLeft >> 8),
+                };
+                chunkPut(head, 5);
+            }
+            size_t n = length < _blockLeft ? length : _blockLeft;
+            for (size_t i = 0; i < n; i++) {
+                _adlerA = (_adlerA + data[i]) % 65521;
+                _adlerB = (_adlerB + _adlerA) % 65521;
+            }
+            chunkPut(data, n);
+            _blockLeft -= n;
+            _rawLeft -= n;
+            data += n;
+            length -= n;
+        }
+    }
+};
+
+#endif // FRAME_PREVIEW_H
@@ -0,0 +1,72 @@
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+/*
+ * Log2-bucket latency histogram.
+ *
+ * Bucket 0 counts values of 0, bucket k counts [2^(k-1), 2^k). With 24
+ * buckets and microsecond samples the top bucket starts at 4.2 s, enough
+ * for a full EPD refresh. Recording is a count-leading-zeros and a few
+ * adds; percentiles resolve to a bucket's upper bound (within 2x).
+ *
+ * Not synchronized: give each histogram a single writer.
+ *
+ * The header has no Arduino dependency so the host tools can build it.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+struct LogHistogram {
+    static const int BUCKETS = 24;
+
+    uint32_t buckets[BUCKETS];
+    uint32_t count;
+    uint32_t max;
+    uint64_t sum;
+
+    void reset() {
+        memset(this, 0, sizeof(*this));
+    }
+
+    static int bucketOf(uint32_t value) {
+        int b = value ? 32 - __builtin_clz(value) : 0;
+        return b < BUCKETS ? b : BUCKETS - 1;
+    }
+
+    // Largest value that lands in bucket b
+    static uint32_t upperBound(int b) {
+        return b == 0 ? 0 : (1u << b) - 1;
+    }
+
+    void record(uint32_t value) {
+        buckets[bucketOf(value)]++;
+        count++;
+        sum += value;
+        if (value > max) max = value;
+    }
+
+    uint32_t average() const {
+        return count ? (uint32_t)(sum / count) : 0;
+    }
+
+    // Upper bound of the bucket holding the given percentile (0-100),
+    // clamped to the observed maximum
+    uint32_t percentile(uint32_t pct) const {
+        if (!count) return 0;
+        uint64_t rank = ((uint64_t)count * pct + 99) / 100;
+        if (rank == 0) rank = 1;
+        uint64_t seen = 0;
+        for (int b = 0; b < BUCKETS; b++) {
+            seen += buckets[b];
+            if (seen >= rank) {
+                if (b == BUCKETS - 1) return max;
+                uint32_t bound = upperBound(b);
+                return bound < max ? bound : max;
+            }
+        }
+        return max;
+    }
+};
+
+#endif // HISTOGRAM_H
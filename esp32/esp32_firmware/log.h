@@ -0,0 +1,142 @@
+#ifndef LOG_H
+#define LOG_H
+
+/*
+ * Leveled logging that stays out of the way of the serial protocol.
+ *
+ * LOG_E/LOG_W/LOG_I/LOG_D take printf arguments. Levels above LOG_LEVEL
+ * are removed at compile time, arguments included. Output goes to one of:
+ *
+ * - LOG_OUTPUT_FRAMED (default on TRANSPORT_UART0): the protocol link,
+ *   wrapped in a tagged frame the host can tell apart from responses:
+ *     LOG<LEN>\n<L> <ms> <message>\n      (L = E, W, I or D)
+ *   esp_serial.SerialManager routes these to Python logging.
+ * - LOG_OUTPUT_UART: plain lines on a spare UART (TX only, LOG_UART_TX_PIN),
+ *   so the link carries nothing but protocol traffic.
+ * - LOG_OUTPUT_CONSOLE (default on TRANSPORT_UART2): plain lines on UART0,
+ *   which the protocol no longer uses.
+ *
+ * Every protocol link writer (responses and framed logs) holds
+ * SerialTxGuard, so frames from different tasks never interleave.
+ * Do not log from ISRs.
+ */
+
+#include <Arduino.h>
+#include <stdarg.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include "transport.h"
+
+#define LOG_LEVEL_NONE  0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN  2
+#define LOG_LEVEL_INFO  3
+#define LOG_LEVEL_DEBUG 4
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+#define LOG_OUTPUT_FRAMED 0
+#define LOG_OUTPUT_UART    1
+#define LOG_OUTPUT_CONSOLE 2
+
+#ifndef LOG_OUTPUT
+#if TRANSPORT == TRANSPORT_UART0
+#define LOG_OUTPUT LOG_OUTPUT_FRAMED
+#else
+#define LOG_OUTPUT LOG_OUTPUT_CONSOLE
+#endif
+#endif
+
+#if CONFIG_IDF_TARGET_ESP32S3
+#define LOG_UART_TX_PIN 40
+#else
+#define LOG_UART_TX_PIN 23
+#endif
+#define LOG_UART_BAUD   115200
+#define LOG_LINE_MAX    160
+
+static SemaphoreHandle_t serialTxMutex = nullptr;
+
+// Exclusive use of the protocol link TX for one frame
+class SerialTxGuard {
+public:
+    SerialTxGuard() {
+        if (serialTxMutex) xSemaphoreTake(serialTxMutex, portMAX_DELAY);
+    }
+    ~SerialTxGuard() {
+        if (serialTxMutex) xSemaphoreGive(serialTxMutex);
+    }
+};
+
+// Call once at the top of setup(), after transportInit()
+void logInit() {
+    serialTxMutex = xSemaphoreCreateMutex();
+#if LOG_OUTPUT == LOG_OUTPUT_UART
+    Serial1.begin(LOG_UART_BAUD, SERIAL_8N1, -1, LOG_UART_TX_PIN);
+#endif
+}
+
+void logWrite(char level, const char* fmt, ...) __attribute__((format(printf, 2, 3)));
+
+void logWrite(char level, const char* fmt, ...) {
+    char line[LOG_LINE_MAX + 1];  // Room for a trailing newline
+    int len = snprintf(line, sizeof(line), "%c %lu ", level, (unsigned long)millis());
+    va_list args;
+    va_start(args, fmt);
+    int n = vsnprintf(line + len, sizeof(line) - len, fmt, args);
+    va_end(args);
+    if (n > 0) len += n;
+    if (len >= LOG_LINE_MAX) len = LOG_LINE_MAX - 1;
+
+#if LOG_OUTPUT == LOG_OUTPUT_UART || LOG_OUTPUT == LOG_OUTPUT_CONSOLE
+    // One write per line, so lines from different tasks stay whole
+    line[len++] = '\n';
+    // Serial is an HWCDC, not a HardwareSerial, on an S3 with USB CDC on
+    // boot, so the two only share Print
+#if LOG_OUTPUT == LOG_OUTPUT_UART
+    Print& out = Serial1;
+#else
+    Print& out = Serial;
+#endif
+    out.write((const uint8_t*)line, len);
+#else
+    // Messages stay single-line so the frame reads as two lines
+    for (int i = 0; i < len; i++) {
+        if (line[i] == '\n' || line[i] == '\r') line[i] = ' ';
+    }
+    char header[12];
+    int headerLen = snprintf(header, sizeof(header), "LOG%d\n", len);
+    SerialTxGuard guard;
+    protoSerial.write((const uint8_t*)header, headerLen);
+    protoSerial.write((const uint8_t*)line, len);
+    protoSerial.write('\n');
+#endif
+}
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_E(...) logWrite('E', __VA_ARGS__)
+#else
+#define LOG_E(...) do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_W(...) logWrite('W', __VA_ARGS__)
+#else
+#define LOG_W(...) do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_I(...) logWrite('I', __VA_ARGS__)
+#else
+#define LOG_I(...) do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_D(...) logWrite('D', __VA_ARGS__)
+#else
+#define LOG_D(...) do {} while (0)
+#endif
+
+#endif // LOG_H
@@ -0,0 +1,82 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+/*
+ * Streaming Prometheus text exposition.
+ *
+ * MetricsWriter formats straight into a fixed buffer and hands it to a
+ * sink whenever it fills (a chunked HTTP response), so a scrape of any
+ * size needs neither Strings nor heap. printf() formats in place rather
+ * than through Print::printf, which mallocs for lines over 64 bytes.
+ *
+ * The header has no Arduino dependency so the host tools can build it.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include "histogram.h"
+
+#define METRICS_CHUNK_SIZE 1024
+
+typedef void (*MetricsSink)(void* ctx, const char* data, size_t length);
+
+class MetricsWriter {
+public:
+    MetricsWriter(MetricsSink sink, void* ctx) : _sink(sink), _ctx(ctx) {}
+
+    void printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) {
+        for (int attempt = 0; attempt < 2; attempt++) {
+            va_list args;
+            va_start(args, fmt);
+            int n = vsnprintf(_buf + _len, sizeof(_buf) - _len, fmt, args);
+            va_end(args);
+            if (n < 0) return;
+            if (_len + n < sizeof(_buf)) {
+                _len += n;
+                return;
+            }
+            // Did not fit: send what we have and format again at the start.
+            // A single line longer than the buffer is cut.
+            if (_len == 0) {
+                _len = sizeof(_buf) - 1;
+                return;
+            }
+            flush();
+        }
+    }
+
+    // # HELP and # TYPE lines for a metric family
+    void family(const char* name, const char* type, const char* help) {
+        printf("# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+    }
+
+    // Summary from a microsecond histogram, exported in seconds:
+    // name{labels,quantile="0.5|0.9|0.99"}, name_sum, name_count
+    void summary(const char* name, const char* labels, const LogHistogram& h) {
+        static const uint32_t quantiles[] = {50, 90, 99};
+        const char* sep = labels[0] ? "," : "";
+        for (uint32_t q : quantiles) {
+            printf("%s{%s%squantile=\"0.%02u\"} %u.%06u\n", name, labels, sep,
+                   (unsigned)q, (unsigned)(h.percentile(q) / 1000000),
+                   (unsigned)(h.percentile(q) % 1000000));
+        }
+        printf("%s_sum{%s} %llu.%06u\n%s_count{%s} %u\n", name, labels,
+               (unsigned long long)(h.sum / 1000000), (unsigned)(h.sum % 1000000),
+               name, labels, (unsigned)h.count);
+    }
+
+    void flush() {
+        if (_len) _sink(_ctx, _buf, _len);
+        _len = 0;
+    }
+
+private:
+    MetricsSink _sink;
+    void* _ctx;
+    char _buf[METRICS_CHUNK_SIZE];
+    size_t _len = 0;
+};
+
+#endif // METRICS_H
@@ -0,0 +1,154 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+/*
+ * Cycle-counter latency profiler.
+ *
+ * PROF_SCOPE(probe) times the rest of the enclosing block with the CPU's
+ * CCOUNT register and records it, in microseconds, into that probe's
+ * LogHistogram. PROF_CULPRIT(probe, name) labels the current pass (the
+ * command, display op or route being handled); the label of the slowest
+ * pass is kept next to the maximum.
+ *
+ * Each probe must only be used from one task, and every task is pinned
+ * to a core, so start and end read the same core's counter. CCOUNT wraps
+ * after 2^32 cycles (17.9 s at 240 MHz), far above any single pass.
+ *
+ * Resets are requested from any task and applied by the probe's owner on
+ * its next sample, so readers never race the writer on the bucket array.
+ *
+ * With ENABLE_PROFILER set to 0 every macro expands to nothing.
+ */
+
+#include <Arduino.h>
+#include "histogram.h"
+
+#ifndef ENABLE_PROFILER
+#define ENABLE_PROFILER 1
+#endif
+
+#define PROF_CULPRIT_LEN 16   // Longest label now: the "frame_timeout" timer, 13 chars
+
+enum ProfProbe {
+    PROF_MOTOR,       // Motor task pass
+    PROF_PARSE,       // Draining and parsing UART bytes
+    PROF_COMMAND,     // One serial command, CRC check to response
+    PROF_DISPLAY,     // One display job (refresh, clear, power-off)
+    PROF_DNS,         // Captive DNS request handling
+    PROF_HTTP,        // One esp_http_server handler, request to reply sent
+    PROF_TIMER,       // One scheduler callback
+    PROF_COUNT
+};
+
+#if ENABLE_PROFILER
+
+#include <esp_cpu.h>
+
+struct ProfStats {
+    const char* name;
+    LogHistogram hist;                  // Microseconds
+    char maxCulprit[PROF_CULPRIT_LEN];  // Label of the slowest pass
+    char culprit[PROF_CULPRIT_LEN];     // Label of the pass in progress
+    uint32_t epoch;                     // Last reset applied
+};
+
+static ProfStats profStats[PROF_COUNT] = {
+    {"motor"}, {"parse"}, {"command"}, {"display"},
+    {"dns"}, {"http"}, {"timer"},
+};
+static volatile uint32_t profEpoch = 0;
+static uint32_t profCyclesPerUs = 240;
+
+void profInit() {
+    profCyclesPerUs = getCpuFrequencyMhz();
+}
+
+// Owner side
+inline void profRecord(ProfProbe probe, uint32_t cycles) {
+    ProfStats& p = profStats[probe];
+    if (p.epoch != profEpoch) {
+        p.hist.reset();
+        p.maxCulprit[0] = '\0';
+        p.epoch = profEpoch;
+    }
+    uint32_t us = cycles / profCyclesPerUs;
+    if (us >= p.hist.max || p.hist.count == 0) {
+        memcpy(p.maxCulprit, p.culprit, PROF_CULPRIT_LEN);
+    }
+    p.hist.record(us);
+    p.culprit[0] = '\0';
+}
+
+inline void profCulprit(ProfProbe probe, const char* label) {
+    strncpy(profStats[probe].culprit, label, PROF_CULPRIT_LEN - 1);
+    profStats[probe].culprit[PROF_CULPRIT_LEN - 1] = '\0';
+}
+
+class ProfScope {
+public:
+    explicit ProfScope(ProfProbe probe)
+        : _probe(probe), _start(esp_cpu_get_cycle_count()) {}
+    ~ProfScope() {
+        profRecord(_probe, esp_cpu_get_cycle_count() - _start);
+    }
+
+private:
+    ProfProbe _probe;
+    uint32_t _start;
+};
+
+// Any task: owners clear their stats on their next sample
+void profReset() {
+    profEpoch = profEpoch + 1;
+}
+
+// One entry per probe, separated by sep:
+// name n=<count> avg=<us> p50=<us> p99=<us> max=<us>(<culprit>)[ h=<b0>,<b1>,...]
+// Stats not yet cleared after a reset read as empty.
+int profReport(char* out, size_t size, char sep, bool buckets) {
+    const char seps[2] = {sep, '\0'};
+    int pos = 0;
+    out[0] = '\0';
+    for (int i = 0; i < PROF_COUNT && pos < (int)size; i++) {
+        const ProfStats& p = profStats[i];
+        if (p.epoch != profEpoch || p.hist.count == 0) {
+            pos += snprintf(out + pos, size - pos, "%s%s n=0", i ? seps : "", p.name);
+            continue;
+        }
+        pos += snprintf(out + pos, size - pos,
+                        "%s%s n=%u avg=%u p50=%u p99=%u max=%u(%s)",
+                        i ? seps : "", p.name, (unsigned)p.hist.count,
+                        (unsigned)p.hist.average(), (unsigned)p.hist.percentile(50),
+                        (unsigned)p.hist.percentile(99), (unsigned)p.hist.max,
+                        p.maxCulprit[0] ? p.maxCulprit : "-");
+        if (!buckets) continue;
+        // Trailing empty buckets are left out
+        int last = LogHistogram::BUCKETS - 1;
+        while (last > 0 && p.hist.buckets[last] == 0) last--;
+        for (int b = 0; b <= last && pos < (int)size; b++) {
+            pos += snprintf(out + pos, size - pos, "%s%u", b ? "," : " h=",
+                            (unsigned)p.hist.buckets[b]);
+        }
+    }
+    return pos < (int)size ? pos : (int)size - 1;
+}
+
+#define PROF_CONCAT_(a, b) a##b
+#define PROF_CONCAT(a, b) PROF_CONCAT_(a, b)
+#define PROF_SCOPE(probe) ProfScope PROF_CONCAT(_profScope, __LINE__)(probe)
+#define PROF_CULPRIT(probe, label) profCulprit(probe, label)
+
+#else
+
+inline void profInit() {}
+inline void profReset() {}
+inline int profReport(char* out, size_t size, char sep, bool buckets) {
+    return snprintf(out, size, "profiler disabled");
+}
+
+#define PROF_SCOPE(probe) do {} while (0)
+#define PROF_CULPRIT(probe, label) do {} while (0)
+
+#endif // ENABLE_PROFILER
+
+#endif // PROFILER_H
@@ -0,0 +1,181 @@
+#ifndef SPSC_H
+#define SPSC_H
+
+/*
+ * Wait-free single-producer/single-consumer primitives.
+ *
+ * - SpscRing<T, N>: bounded FIFO, N must be a power of two. Exactly one
+ *   context may push and exactly one may pop (an ISR counts as a context).
+ * - Mailbox<T>:     latest-value slot (seqlock). One writer, any number of
+ *   readers; readers never block the writer and always see a whole value.
+ *   A reader must not be able to preempt the writer (same core, higher
+ *   priority): it would spin on a write that cannot finish. read() gives
+ *   up after MAILBOX_READ_TRIES so such a mistake costs a stale value, not
+ *   a livelocked core.
+ *
+ * Both are IRAM-safe: every member is force-inlined into its caller, so an
+ * IRAM_ATTR ISR never calls into flash, and the object itself holds all
+ * storage (declare globals used from ISRs with DRAM_ATTR).
+ *
+ * The header has no Arduino dependency so the host tools can build it.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+#include <type_traits>
+
+#define SPSC_INLINE inline __attribute__((always_inline))
+
+// Mailbox::read() attempts before it reports no value; a writer on another
+// core finishes its few-word copy well within this
+#ifndef MAILBOX_READ_TRIES
+#define MAILBOX_READ_TRIES 64
+#endif
+
+template <typename T, size_t N>
+class SpscRing {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscRing size must be a power of two");
+    static_assert(std::is_trivially_copyable<T>::value, "SpscRing holds plain data only");
+
+public:
+    // Producer side
+    SPSC_INLINE bool push(const T& item) {
+        uint32_t head = _head.load(std::memory_order_relaxed);
+        if (head - _tail.load(std::memory_order_acquire) >= N) {
+            _dropped++;
+            return false;
+        }
+        _buf[head & MASK] = item;
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Pushes as many items as fit, returns the number pushed
+    SPSC_INLINE size_t pushN(const T* items, size_t count) {
+        uint32_t head = _head.load(std::memory_order_relaxed);
+        size_t space = N - (head - _tail.load(std::memory_order_acquire));
+        if (count > space) {
+            _dropped += count - space;
+            count = space;
+        }
+        for (size_t i = 0; i < count; i++) {
+            _buf[(head + i) & MASK] = items[i];
+        }
+        _head.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    // Consumer side
+    SPSC_INLINE bool pop(T& item) {
+        uint32_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail == _head.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = _buf[tail & MASK];
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    SPSC_INLINE size_t popN(T* items, size_t max) {
+        uint32_t tail = _tail.load(std::memory_order_relaxed);
+        size_t avail = _head.load(std::memory_order_acquire) - tail;
+        if (max > avail) max = avail;
+        for (size_t i = 0; i < max; i++) {
+            items[i] = _buf[(tail + i) & MASK];
+        }
+        _tail.store(tail + max, std::memory_order_release);
+        return max;
+    }
+
+    // Consumer side: discard everything currently queued
+    SPSC_INLINE void clear() {
+        _tail.store(_head.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    // Approximate when called from a third context
+    SPSC_INLINE size_t size() const {
+        return _head.load(std::memory_order_acquire) - _tail.load(std::memory_order_acquire);
+    }
+
+    SPSC_INLINE bool empty() const { return size() == 0; }
+
+    // Items rejected because the ring was full (producer-owned counter)
+    SPSC_INLINE uint32_t dropped() const { return _dropped; }
+
+    static constexpr size_t capacity() { return N; }
+
+private:
+    static constexpr uint32_t MASK = N - 1;
+
+    // Head and tail on separate cache lines so producer and consumer
+    // cores do not fight over the same line
+    alignas(32) std::atomic<uint32_t> _head{0};
+    uint32_t _dropped = 0;
+    alignas(32) std::atomic<uint32_t> _tail{0};
+    alignas(32) T _buf[N];
+};
+
+template <typename T>
+class Mailbox {
+    static_assert(std::is_trivially_copyable<T>::value, "Mailbox holds plain data only");
+
+public:
+    // Writer side: a single writer, which may be an ISR. No reader may
+    // preempt it on its core (see the top of this file).
+    SPSC_INLINE void publish(const T& value) {
+        uint32_t seq = _seq.load(std::memory_order_relaxed);
+        _seq.store(seq + 1, std::memory_order_relaxed);   // odd: write in progress
+        copyIn(value);                                    // release: odd seq first
+        _seq.store(seq + 2, std::memory_order_release);   // even: stable
+    }
+
+    // Reader side. Returns false, leaving out untouched, if nothing was
+    // published yet or no stable value was seen in MAILBOX_READ_TRIES.
+    SPSC_INLINE bool read(T& out) const {
+        for (int tries = 0; tries < MAILBOX_READ_TRIES; tries++) {
+            uint32_t before = _seq.load(std::memory_order_acquire);
+            if (before & 1) continue;
+            T value;
+            copyOut(value);                               // acquire: seq re-read after
+            if (_seq.load(std::memory_order_relaxed) == before) {
+                if (before == 0) return false;
+                out = value;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Number of values published so far
+    SPSC_INLINE uint32_t version() const {
+        return _seq.load(std::memory_order_acquire) >> 1;
+    }
+
+private:
+    // Word-wise atomic copies keep the seqlock free of data races. Each data
+    // store releases the odd sequence number and each data load acquires it,
+    // so a reader that sees any new word also sees the sequence change.
+    static constexpr size_t WORDS = (sizeof(T) + 3) / 4;
+
+    SPSC_INLINE void copyIn(const T& value) {
+        uint32_t tmp[WORDS] = {};
+        __builtin_memcpy(tmp, &value, sizeof(T));
+        for (size_t i = 0; i < WORDS; i++) {
+            _data[i].store(tmp[i], std::memory_order_release);
+        }
+    }
+
+    SPSC_INLINE void copyOut(T& out) const {
+        uint32_t tmp[WORDS];
+        for (size_t i = 0; i < WORDS; i++) {
+            tmp[i] = _data[i].load(std::memory_order_acquire);
+        }
+        __builtin_memcpy(&out, tmp, sizeof(T));
+    }
+
+    std::atomic<uint32_t> _seq{0};
+    std::atomic<uint32_t> _data[WORDS] = {};
+};
+
+#endif // SPSC_H
@@ -0,0 +1,136 @@
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+/*
+ * Two-level hierarchical timer wheel.
+ *
+ * Level 0 has 256 one-tick slots, level 1 has 64 slots of 256 ticks each
+ * (16.4 s at 1 ms/tick). Longer timers park in the last level-1 slot and
+ * are re-placed every time that slot cascades. Insert and cancel are O(1)
+ * (intrusive doubly linked lists); a tick costs O(expiring timers), plus
+ * one cascade every 256 ticks.
+ *
+ * The wheel is not synchronized. The firmware wraps every call in a
+ * critical section and runs callbacks outside of it.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef void (*TimerCallback)(void* arg);
+
+struct TimerEvent {
+    const char* name;
+    TimerCallback callback;
+    void* arg;
+    uint32_t period;          // Ticks between firings, 0 = one-shot
+
+    // Owned by TimerWheel
+    uint32_t expires;         // Absolute tick
+    TimerEvent* next;
+    TimerEvent* prev;
+    TimerEvent** slot;        // List head the event is linked into, nullptr when idle
+
+    // Owned by the scheduler task
+    uint32_t fired;
+    uint32_t maxLateUs;
+};
+
+class TimerWheel {
+public:
+    static const uint32_t L0_BITS = 8;
+    static const uint32_t L0_SIZE = 1u << L0_BITS;
+    static const uint32_t L1_SIZE = 64;
+
+    // Arms ev to fire delay ticks from now (0 fires on the next tick)
+    void add(TimerEvent* ev, uint32_t delay) {
+        addAt(ev, _now + (delay ? delay : 1));
+    }
+
+    // Arms ev at an absolute tick; ticks already passed fire on the next one
+    void addAt(TimerEvent* ev, uint32_t expires) {
+        if (ev->slot) remove(ev);
+        if ((int32_t)(expires - _now) <= 0) expires = _now + 1;
+        ev->expires = expires;
+        place(ev);
+        _armed++;
+    }
+
+    void remove(TimerEvent* ev) {
+        if (!ev->slot) return;
+        if (ev->prev) ev->prev->next = ev->next;
+        else *ev->slot = ev->next;
+        if (ev->next) ev->next->prev = ev->prev;
+        ev->next = ev->prev = nullptr;
+        ev->slot = nullptr;
+        _armed--;
+    }
+
+    static bool pending(const TimerEvent* ev) { return ev->slot != nullptr; }
+
+    // Advances one tick and returns the events that expired on it, detached
+    // and chained through next. The caller fires them (and re-arms periodic
+    // ones) after leaving its critical section.
+    TimerEvent* tick() {
+        _now++;
+        if ((_now & (L0_SIZE - 1)) == 0) {
+            cascade(_l1[(_now >> L0_BITS) & (L1_SIZE - 1)]);
+        }
+
+        TimerEvent** head = &_l0[_now & (L0_SIZE - 1)];
+        TimerEvent* expired = *head;
+        *head = nullptr;
+        for (TimerEvent* ev = expired; ev; ev = ev->next) {
+            ev->slot = nullptr;
+            ev->prev = nullptr;
+            _armed--;
+        }
+        return expired;
+    }
+
+    // Cheap check, safe from an ISR: does tick t have any work?
+    inline __attribute__((always_inline)) bool hasWorkAt(uint32_t t) const {
+        return (t & (L0_SIZE - 1)) == 0 || _l0[t & (L0_SIZE - 1)] != nullptr;
+    }
+
+    uint32_t now() const { return _now; }
+    uint32_t armed() const { return _armed; }
+
+private:
+    void link(TimerEvent** head, TimerEvent* ev) {
+        ev->prev = nullptr;
+        ev->next = *head;
+        if (*head) (*head)->prev = ev;
+        *head = ev;
+        ev->slot = head;
+    }
+
+    void place(TimerEvent* ev) {
+        uint32_t delta = ev->expires - _now;
+        if (delta < L0_SIZE) {
+            link(&_l0[ev->expires & (L0_SIZE - 1)], ev);
+        } else if (delta < L0_SIZE * L1_SIZE) {
+            link(&_l1[(ev->expires >> L0_BITS) & (L1_SIZE - 1)], ev);
+        } else {
+            // Beyond the wheel: revisit on the last level-1 slot's cascade
+            link(&_l1[((_now >> L0_BITS) + L1_SIZE - 1) & (L1_SIZE - 1)], ev);
+        }
+    }
+
+    void cascade(TimerEvent*& head) {
+        TimerEvent* ev = head;
+        head = nullptr;
+        while (ev) {
+            TimerEvent* next = ev->next;
+            place(ev);
+            ev = next;
+        }
+    }
+
+    TimerEvent* _l0[L0_SIZE] = {};
+    TimerEvent* _l1[L1_SIZE] = {};
+    uint32_t _now = 0;
+    uint32_t _armed = 0;
+};
+
+#endif // TIMER_WHEEL_H
@@ -0,0 +1,279 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+/*
+ * Event trace ring.
+ *
+ * TRACE_SCOPE(name, label) records a begin event now and an end event when
+ * the block exits; TRACE_INSTANT(name, label) and TRACE_VALUES(name, a, b)
+ * record single points. Events are 16 bytes with a microsecond timestamp
+ * and the recording task, and overwrite the oldest once the ring is full.
+ *
+ * Recording is lock-free (one atomic increment claims a slot) and IRAM-safe,
+ * so tasks on both cores and ISRs can trace. traceDumpBegin() pauses recording
+ * until traceDumpEnd(); an event claimed just before the pause may be
+ * dumped half-written.
+ *
+ * Dump format (little endian), converted to Chrome trace JSON on the host
+ * by esp_serial/trace.py:
+ *   "ETRC" u8 version, u8 name count, u8 thread count, u8 reserved
+ *   u32 event count, u32 overwritten events, u32 timestamp at dump
+ *   names, then thread names: u8 length + characters each
+ *   events, oldest first
+ *
+ * With ENABLE_TRACE set to 0 every macro expands to nothing.
+ */
+
+#include <Arduino.h>
+
+#ifndef ENABLE_TRACE
+#define ENABLE_TRACE 1
+#endif
+
+#ifndef TRACE_EVENTS
+#define TRACE_EVENTS 512   // Power of two; 16 bytes each
+#endif
+
+#define TRACE_VERSION     1
+#define TRACE_MAX_THREADS 8
+#define TRACE_THREAD_ISR  (TRACE_MAX_THREADS - 1)
+#define TRACE_THREAD_NONE (TRACE_MAX_THREADS - 2)
+#define TRACE_LABEL_LEN   8
+#define TRACE_HEADER_SIZE 20
+
+// Event names; keep traceNames[] in sync
+enum TraceName : uint8_t {
+    TRACE_COMMAND,        // Serial command, label = command
+    TRACE_EPD_INIT,
+    TRACE_EPD_LOAD,       // Frame copied into panel RAM
+    TRACE_EPD_REFRESH,    // Panel refresh until BUSY drops
+    TRACE_EPD_CLEAR,
+    TRACE_EPD_BUSY_IDLE,  // BUSY falling edge (ISR)
+    TRACE_DISPLAY_JOB,    // Display task job, label = op
+    TRACE_MOTOR_SET,      // values = left, right
+    TRACE_MOTOR_STOP,
+    TRACE_HTTP,           // Web request, label = route
+    TRACE_TIMER,          // Scheduler callback, label = timer
+    TRACE_NAME_COUNT
+};
+
+enum TracePhase : uint8_t {
+    TRACE_PHASE_BEGIN = 'B',
+    TRACE_PHASE_END = 'E',
+    TRACE_PHASE_INSTANT = 'i',
+};
+
+#define TRACE_FLAG_VALUES 0x01   // payload holds two int32 values, not a label
+
+struct TraceEvent {
+    uint32_t tsUs;
+    uint8_t phase;
+    uint8_t thread;
+    uint8_t name;
+    uint8_t flags;
+    union {
+        char label[TRACE_LABEL_LEN];
+        int32_t values[2];
+    };
+};
+
+static_assert(sizeof(TraceEvent) == 16, "TraceEvent must stay 16 bytes");
+static_assert((TRACE_EVENTS & (TRACE_EVENTS - 1)) == 0, "TRACE_EVENTS must be a power of two");
+
+#if ENABLE_TRACE
+
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+static const char* const traceNames[TRACE_NAME_COUNT] = {
+    "command", "epd_init", "epd_load", "epd_refresh", "epd_clear", "epd_busy_idle",
+    "display_job", "motor_set", "motor_stop", "http", "timer",
+};
+
+static DRAM_ATTR TraceEvent traceRing[TRACE_EVENTS];
+static DRAM_ATTR std::atomic<uint32_t> traceHead{0};
+static DRAM_ATTR volatile bool tracePaused = false;
+static uint32_t traceDumpHead = 0;   // Ring end and size as traceDumpBegin() announced
+static uint32_t traceDumpCount = 0;
+static TaskHandle_t traceThreadHandles[TRACE_MAX_THREADS];
+static const char* traceThreadNames[TRACE_MAX_THREADS];
+static uint8_t traceThreadCount = 0;
+
+// Call before the task starts tracing; ISRs and unregistered tasks get
+// their own fixed threads
+void traceRegisterThread(TaskHandle_t handle, const char* name) {
+    if (traceThreadCount < TRACE_THREAD_NONE) {
+        traceThreadHandles[traceThreadCount] = handle;
+        traceThreadNames[traceThreadCount] = name;
+        traceThreadCount++;
+    }
+}
+
+static inline uint8_t IRAM_ATTR traceThread() {
+    if (xPortInIsrContext()) return TRACE_THREAD_ISR;
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    for (uint8_t i = 0; i < traceThreadCount; i++) {
+        if (traceThreadHandles[i] == self) return i;
+    }
+    return TRACE_THREAD_NONE;
+}
+
+static inline TraceEvent* IRAM_ATTR traceClaim(uint8_t phase, uint8_t name) {
+    if (tracePaused) return nullptr;
+    uint32_t idx = traceHead.fetch_add(1, std::memory_order_relaxed);
+    TraceEvent* ev = &traceRing[idx & (TRACE_EVENTS - 1)];
+    ev->tsUs = (uint32_t)esp_timer_get_time();
+    ev->phase = phase;
+    ev->thread = traceThread();
+    ev->name = name;
+    return ev;
+}
+
+static void IRAM_ATTR traceLabel(uint8_t phase, uint8_t name, const char* label) {
+    TraceEvent* ev = traceClaim(phase, name);
+    if (!ev) return;
+    ev->flags = 0;
+    uint8_t i = 0;
+    if (label) {
+        for (; i < TRACE_LABEL_LEN && label[i]; i++) ev->label[i] = label[i];
+    }
+    for (; i < TRACE_LABEL_LEN; i++) ev->label[i] = '\0';
+}
+
+static void IRAM_ATTR traceValues(uint8_t name, int32_t a, int32_t b) {
+    TraceEvent* ev = traceClaim(TRACE_PHASE_INSTANT, name);
+    if (!ev) return;
+    ev->flags = TRACE_FLAG_VALUES;
+    ev->values[0] = a;
+    ev->values[1] = b;
+}
+
+class TraceScope {
+public:
+    TraceScope(TraceName name, const char* label) : _name(name) {
+        traceLabel(TRACE_PHASE_BEGIN, name, label);
+    }
+    ~TraceScope() {
+        traceLabel(TRACE_PHASE_END, _name, nullptr);
+    }
+
+private:
+    TraceName _name;
+};
+
+// Base64 encoder over Print, so the dump can be streamed as a text response
+class Base64Writer {
+public:
+    explicit Base64Writer(Print& out) : _out(out) {}
+
+    static size_t encodedLength(size_t bytes) { return (bytes + 2) / 3 * 4; }
+
+    void write(const void* data, size_t length) {
+        const uint8_t* p = (const uint8_t*)data;
+        for (size_t i = 0; i < length; i++) {
+            _carry[_n++] = p[i];
+            if (_n == 3) flushGroup();
+        }
+    }
+
+    void finish() {
+        if (_n) flushGroup();
+    }
+
+private:
+    void flushGroup() {
+        static const char alphabet[] =
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        uint32_t v = (uint32_t)_carry[0] << 16 |
+                     (uint32_t)(_n > 1 ? _carry[1] : 0) << 8 |
+                     (uint32_t)(_n > 2 ? _carry[2] : 0);
+        char group[4] = {
+            alphabet[(v >> 18) & 63], alphabet[(v >> 12) & 63],
+            _n > 1 ? alphabet[(v >> 6) & 63] : '=',
+            _n > 2 ? alphabet[v & 63] : '=',
+        };
+        _out.write((const uint8_t*)group, 4);
+        _n = 0;
+    }
+
+    Print& _out;
+    uint8_t _carry[3];
+    uint8_t _n = 0;
+};
+
+static size_t traceStringsSize() {
+    size_t size = 0;
+    for (int i = 0; i < TRACE_NAME_COUNT; i++) size += 1 + strlen(traceNames[i]);
+    for (int i = 0; i < TRACE_MAX_THREADS; i++) {
+        const char* name = traceThreadNames[i] ? traceThreadNames[i] : "";
+        size += 1 + strlen(name);
+    }
+    return size;
+}
+
+static void traceWriteString(Base64Writer& out, const char* s) {
+    uint8_t len = (uint8_t)strlen(s);
+    out.write(&len, 1);
+    out.write(s, len);
+}
+
+// Freezes the ring until traceDumpEnd() and returns the encoded size
+size_t traceDumpBegin() {
+    tracePaused = true;
+    traceThreadNames[TRACE_THREAD_NONE] = "other";
+    traceThreadNames[TRACE_THREAD_ISR] = "isr";
+    // A claim already past the pause check can still move the head, so the
+    // write streams exactly what is counted here
+    traceDumpHead = traceHead.load(std::memory_order_relaxed);
+    traceDumpCount = traceDumpHead < TRACE_EVENTS ? traceDumpHead : TRACE_EVENTS;
+    return Base64Writer::encodedLength(TRACE_HEADER_SIZE + traceStringsSize() +
+                                       traceDumpCount * sizeof(TraceEvent));
+}
+
+// Streams the ring as traceDumpBegin() froze it, base64 encoded
+void traceDumpWrite(Print& print) {
+    Base64Writer out(print);
+    uint32_t head = traceDumpHead;
+    uint32_t count = traceDumpCount;
+    uint32_t header[TRACE_HEADER_SIZE / 4];
+    memcpy(&header[0], "ETRC", 4);
+    header[1] = TRACE_VERSION | TRACE_NAME_COUNT << 8 | TRACE_MAX_THREADS << 16;
+    header[2] = count;
+    header[3] = head - count;
+    header[4] = (uint32_t)esp_timer_get_time();
+    out.write(header, sizeof(header));
+
+    for (int i = 0; i < TRACE_NAME_COUNT; i++) traceWriteString(out, traceNames[i]);
+    for (int i = 0; i < TRACE_MAX_THREADS; i++) {
+        traceWriteString(out, traceThreadNames[i] ? traceThreadNames[i] : "");
+    }
+    for (uint32_t i = head - count; i != head; i++) {
+        out.write(&traceRing[i & (TRACE_EVENTS - 1)], sizeof(TraceEvent));
+    }
+    out.finish();
+}
+
+// Resumes recording, optionally starting from an empty ring
+void traceDumpEnd(bool clear) {
+    if (clear) traceHead.store(0, std::memory_order_relaxed);
+    tracePaused = false;
+}
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+#define TRACE_SCOPE(name, label) TraceScope TRACE_CONCAT(_traceScope, __LINE__)(name, label)
+#define TRACE_INSTANT(name, label) traceLabel(TRACE_PHASE_INSTANT, name, label)
+#define TRACE_VALUES(name, a, b) traceValues(name, a, b)
+
+#else
+
+inline void traceRegisterThread(TaskHandle_t handle, const char* name) {}
+
+#define TRACE_SCOPE(name, label) do {} while (0)
+#define TRACE_INSTANT(name, label) do {} while (0)
+#define TRACE_VALUES(name, a, b) do {} while (0)
+
+#endif // ENABLE_TRACE
+
+#endif // TRACE_H
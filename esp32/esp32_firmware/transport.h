@@ -0,0 +1,131 @@
+#ifndef TRANSPORT_H
+#define TRANSPORT_H
+
+/*
+ * Protocol transport: which port carries the Pi link.
+ *
+ * - TRANSPORT_UART0 (default): Serial, the USB/UART bridge. Handy on the
+ *   bench, but the link shares the port with flashing and the boot ROM.
+ * - TRANSPORT_UART2: Serial2 on the Pi header pins (RX 16, TX 17) with
+ *   RTS/CTS hardware flow control and large driver rings, so it can run
+ *   at multi-megabaud rates without overruns. UART0 is left to logs
+ *   (plain lines, see log.h) and flashing.
+ * - TRANSPORT_USB: native USB CDC on the ESP32-S3 (TinyUSB, bulk
+ *   endpoints). No baud rate; a 15000-byte DIMG frame takes milliseconds
+ *   instead of 1.3 s at 115200. Needs "USB Mode: USB-OTG (TinyUSB)" and
+ *   "USB CDC On Boot: Disabled", so Serial stays on UART0 for logs.
+ *
+ * The framing is identical on every transport. Everything that speaks
+ * the protocol goes through protoSerial, and received data is signalled
+ * through transportOnReceive().
+ */
+
+#include <Arduino.h>
+
+#define TRANSPORT_UART0 0
+#define TRANSPORT_UART2 2
+#define TRANSPORT_USB   3
+
+#ifndef TRANSPORT
+#define TRANSPORT TRANSPORT_UART0
+#endif
+
+#if TRANSPORT == TRANSPORT_UART2
+
+#ifndef TRANSPORT_BAUD
+#define TRANSPORT_BAUD 2000000
+#endif
+
+#define TRANSPORT_RX_PIN  16
+#define TRANSPORT_TX_PIN  17
+#if CONFIG_IDF_TARGET_ESP32S3
+#define TRANSPORT_RTS_PIN 5   // To Pi CTS
+#define TRANSPORT_CTS_PIN 4   // From Pi RTS
+#else
+#define TRANSPORT_RTS_PIN 22  // To Pi CTS
+#define TRANSPORT_CTS_PIN 21  // From Pi RTS
+#endif
+
+// Driver ring sizes. The RX ring absorbs a whole DIMG frame while the
+// protocol task is busy; RTS rises once the hardware FIFO passes the
+// threshold, so bytes wait on the Pi rather than being dropped.
+#define TRANSPORT_RX_BUFFER     16384
+#define TRANSPORT_TX_BUFFER     4096
+#define TRANSPORT_RTS_THRESHOLD 100  // Of the 128-byte hardware FIFO
+#define TRANSPORT_RX_FIFO_FULL  64   // Wake the event task every 64 bytes...
+#define TRANSPORT_RX_TIMEOUT    2    // ...or after 2 idle symbol times
+
+#define protoSerial Serial2
+#define TRANSPORT_NAME "uart2"
+
+#elif TRANSPORT == TRANSPORT_USB
+
+#if !CONFIG_IDF_TARGET_ESP32S3 || ARDUINO_USB_MODE
+#error "TRANSPORT_USB needs an ESP32-S3 built with USB Mode: USB-OTG (TinyUSB)"
+#endif
+#if ARDUINO_USB_CDC_ON_BOOT
+#error "TRANSPORT_USB needs USB CDC On Boot disabled; Serial is the log console"
+#endif
+
+#include <USB.h>
+
+#define TRANSPORT_BAUD 0             // Full-speed USB, 12 Mbit/s bus
+#define TRANSPORT_RX_BUFFER 16384    // Whole DIMG frame
+#define TRANSPORT_TX_BUFFER 0
+
+static USBCDC usbSerial;
+#define protoSerial usbSerial
+#define TRANSPORT_NAME "usb"
+
+#else
+
+#define TRANSPORT_BAUD 115200
+#define TRANSPORT_RX_BUFFER 1024
+#define TRANSPORT_TX_BUFFER 0        // Blocking writes, as before
+
+#define protoSerial Serial
+#define TRANSPORT_NAME "uart0"
+
+#endif // TRANSPORT
+
+// Call first thing in setup(); the console (UART0) is opened here too
+void transportInit() {
+#if TRANSPORT == TRANSPORT_UART2
+    Serial.begin(115200);
+    Serial2.setRxBufferSize(TRANSPORT_RX_BUFFER);
+    Serial2.setTxBufferSize(TRANSPORT_TX_BUFFER);
+    Serial2.begin(TRANSPORT_BAUD, SERIAL_8N1, TRANSPORT_RX_PIN, TRANSPORT_TX_PIN);
+    Serial2.setPins(TRANSPORT_RX_PIN, TRANSPORT_TX_PIN, TRANSPORT_CTS_PIN, TRANSPORT_RTS_PIN);
+    Serial2.setHwFlowCtrlMode(UART_HW_FLOWCTRL_CTS_RTS, TRANSPORT_RTS_THRESHOLD);
+    Serial2.setRxFIFOFull(TRANSPORT_RX_FIFO_FULL);
+    Serial2.setRxTimeout(TRANSPORT_RX_TIMEOUT);
+#elif TRANSPORT == TRANSPORT_USB
+    Serial.begin(115200);
+    usbSerial.setRxBufferSize(TRANSPORT_RX_BUFFER);
+    usbSerial.begin();
+    USB.begin();
+#else
+    Serial.setRxBufferSize(TRANSPORT_RX_BUFFER);
+    Serial.begin(TRANSPORT_BAUD);
+#endif
+}
+
+#if TRANSPORT == TRANSPORT_USB
+static void (*transportRxCallback)() = nullptr;
+
+static void transportUsbEvent(void* arg, esp_event_base_t base, int32_t id, void* data) {
+    if (id == ARDUINO_USB_CDC_RX_EVENT && transportRxCallback) transportRxCallback();
+}
+#endif
+
+// onReceive runs on the driver's event task whenever bytes arrive
+void transportOnReceive(void (*callback)()) {
+#if TRANSPORT == TRANSPORT_USB
+    transportRxCallback = callback;
+    usbSerial.onEvent(ARDUINO_USB_CDC_RX_EVENT, transportUsbEvent);
+#else
+    protoSerial.onReceive(callback);
+#endif
+}
+
+#endif // TRANSPORT_H
@@ -0,0 +1,315 @@
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+// Generated by esp32/tools/embed_assets.py, do not edit. Regenerate with
+//   python esp32/tools/embed_assets.py esp32/esp32_firmware/web_assets.h esp32/esp32_firmware/web_page.h:HTML_PAGE
+
+#include <Arduino.h>
+
+// web_page.h: 18947 bytes, 4798 gzipped
+#define HTML_PAGE_GZ_LEN 4798
+#define HTML_PAGE_ETAG "\"5e46ac31aad5e845\""
+const uint8_t HTML_PAGE_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd5, 0x3c, 0xdb, 0x8e, 0xdb, 0xc8,
+    0x95, 0xef, 0xfe, 0x8a, 0x9a, 0x0e, 0xc6, 0xa2, 0x6c, 0x91, 0xba, 0xf4, 0xc5, 0x3d, 0x6a, 0xa9,
+    0x07, 0xed, 0x76, 0x3b, 0xe9, 0x59, 0x7b, 0xdc, 0xe8, 0x6e, 0xc7, 0x33, 0xeb, 0x75, 0x8c, 0x12,
+    0x59, 0x92, 0xe8, 0xa6, 0x58, 0x5c, 0xb2, 0xd4, 0x2d, 0x4d, 0xc6, 0x0b, 0x2c, 0xb0, 0x4f, 0x79,
+    0x48, 0xb0, 0x98, 0x45, 0xf2, 0xb2, 0x40, 0x5e, 0xf2, 0xbc, 0xaf, 0x8b, 0x05, 0xf6, 0x6b, 0xf2,
+    0x05, 0xf9, 0x84, 0x3d, 0xa7, 0x8a, 0xa4, 0x78, 0x29, 0x52, 0x52, 0xdb, 0x09, 0xb2, 0xc2, 0x60,
+    0x5a, 0x64, 0x9d, 0x3a, 0x75, 0xea, 0xdc, 0xcf, 0xa9, 0x92, 0x1f, 0x0c, 0xbe, 0x78, 0xf6, 0xea,
+    0xf4, 0xfa, 0xfb, 0x8b, 0x33, 0x32, 0x15, 0x33, 0xef, 0xf8, 0xc1, 0x20, 0xf9, 0xc3, 0xa8, 0x73,
+    0xfc, 0x80, 0xc0, 0x67, 0x30, 0x63, 0x82, 0x12, 0x7b, 0x4a, 0xc3, 0x88, 0x89, 0xe1, 0xce, 0xeb,
+    0xeb, 0xe7, 0xe6, 0xe1, 0x4e, 0x76, 0xc8, 0xa7, 0x33, 0x36, 0xdc, 0xb9, 0x75, 0xd9, 0x5d, 0xc0,
+    0x43, 0xb1, 0x43, 0x6c, 0xee, 0x0b, 0xe6, 0x03, 0xe8, 0x9d, 0xeb, 0x88, 0xe9, 0xd0, 0x61, 0xb7,
+    0xae, 0xcd, 0x4c, 0xf9, 0xd0, 0x22, 0xae, 0xef, 0x0a, 0x97, 0x7a, 0x66, 0x64, 0x53, 0x8f, 0x0d,
+    0xbb, 0x56, 0x27, 0x41, 0x25, 0x5c, 0xe1, 0xb1, 0xe3, 0xab, 0x60, 0xca, 0x42, 0x17, 0xc6, 0xc8,
+    0x25, 0x1f, 0x71, 0x41, 0x4c, 0x72, 0x66, 0x5e, 0xd0, 0x80, 0x85, 0xe4, 0x14, 0xb0, 0x86, 0xdc,
+    0x1b, 0xb4, 0x15, 0xa0, 0x9a, 0x14, 0x89, 0x65, 0xf2, 0x1d, 0x3f, 0x8f, 0xc8, 0xaf, 0xc9, 0x8c,
+    0x86, 0x13, 0xd7, 0xef, 0x93, 0xce, 0x11, 0x09, 0xa8, 0xe3, 0xb8, 0xfe, 0x44, 0x7e, 0x1f, 0xf1,
+    0x85, 0x19, 0xb9, 0x3f, 0xc8, 0xc7, 0x11, 0x0f, 0x1d, 0x16, 0x9a, 0xf0, 0xea, 0x88, 0x7c, 0x4c,
+    0x27, 0x8f, 0xb8, 0xb3, 0x24, 0xbf, 0x4e, 0x1f, 0xf1, 0x33, 0x86, 0x35, 0xcd, 0x31, 0x9d, 0xb9,
+    0xde, 0xb2, 0x4f, 0x4c, 0x1a, 0x04, 0x1e, 0x33, 0xa3, 0x65, 0x24, 0xd8, 0xac, 0x45, 0x9e, 0x7a,
+    0xae, 0x7f, 0xf3, 0x92, 0xda, 0x57, 0xf2, 0xf9, 0x39, 0x40, 0xb6, 0x48, 0xe3, 0x8a, 0x4d, 0x38,
+    0x23, 0xaf, 0xcf, 0x1b, 0x2d, 0x45, 0x3f, 0x6f, 0x91, 0x88, 0xfa, 0x91, 0x19, 0xc1, 0xa6, 0xc6,
+    0x47, 0x39, 0xdc, 0x23, 0x6a, 0xdf, 0x4c, 0x42, 0x3e, 0xf7, 0x9d, 0x3e, 0xf9, 0x59, 0x97, 0x76,
+    0x69, 0x8f, 0xe5, 0x01, 0x6c, 0xee, 0xf1, 0x10, 0xc6, 0xc6, 0xe3, 0xc2, 0xcc, 0x74, 0x5b, 0xbd,
+    0x4e, 0xb0, 0xc8, 0x0f, 0xcd, 0xe8, 0x42, 0x31, 0xba, 0x4f, 0x0e, 0x3a, 0x9a, 0xd1, 0x98, 0x35,
+    0x84, 0xce, 0x05, 0x5f, 0x8d, 0xad, 0x78, 0x30, 0xed, 0x16, 0x38, 0x20, 0xd8, 0x42, 0x98, 0xd4,
+    0x73, 0x27, 0x30, 0xcd, 0x06, 0xa1, 0xb2, 0x50, 0x4f, 0x64, 0xa7, 0xe3, 0xec, 0x15, 0xe9, 0x54,
+    0xcb, 0x01, 0x9b, 0x85, 0xe0, 0xb3, 0x3e, 0xd9, 0x2d, 0xd1, 0x23, 0xd9, 0x0b, 0x42, 0x61, 0xb0,
+    0x95, 0xbd, 0xec, 0xe0, 0x8a, 0x20, 0xcb, 0xa6, 0xa1, 0x53, 0xa0, 0x29, 0xcf, 0xb9, 0x83, 0x5e,
+    0x77, 0xb7, 0xc0, 0xb9, 0x58, 0xbe, 0x21, 0x75, 0xdc, 0x79, 0xd4, 0x27, 0xdd, 0xd2, 0xc2, 0xb5,
+    0x1c, 0xcc, 0x11, 0x5d, 0x06, 0x50, 0xc8, 0x01, 0x6b, 0xb0, 0x20, 0x11, 0xf7, 0x5c, 0x07, 0x36,
+    0x3f, 0xde, 0xdd, 0x3b, 0xe8, 0x68, 0xf9, 0xd9, 0x2b, 0xd0, 0x9e, 0xf0, 0x8b, 0x7d, 0xb5, 0xb7,
+    0x9f, 0x9d, 0xa2, 0x59, 0xba, 0xbb, 0x5f, 0xc3, 0xaf, 0xee, 0x61, 0x05, 0xbf, 0xe6, 0x81, 0xc7,
+    0xa9, 0x63, 0xd2, 0x90, 0xd1, 0x22, 0xdb, 0x62, 0xc2, 0x7b, 0x40, 0xb8, 0x43, 0xa3, 0x29, 0xd3,
+    0x50, 0xbe, 0x1d, 0xf7, 0xf6, 0x4a, 0x43, 0x6b, 0xd5, 0x65, 0x1e, 0x46, 0xb8, 0xff, 0x80, 0xbb,
+    0xe5, 0x41, 0x11, 0x82, 0xa9, 0x80, 0x77, 0xe0, 0x30, 0x99, 0x7a, 0x1e, 0xe9, 0x58, 0xbb, 0xd1,
+    0x16, 0x1c, 0xd2, 0x33, 0xa1, 0x3f, 0xe5, 0xb7, 0xe0, 0x3d, 0x74, 0xac, 0x30, 0xeb, 0x94, 0x37,
+    0xab, 0x64, 0xe1, 0x64, 0x44, 0x8d, 0x4e, 0x8b, 0xf4, 0xba, 0x3d, 0xf8, 0xdf, 0xfe, 0x7e, 0x0b,
+    0x48, 0xeb, 0xec, 0x37, 0xd7, 0x2d, 0x6d, 0x39, 0x21, 0x9d, 0xfc, 0x75, 0x56, 0xef, 0xd6, 0x2e,
+    0xee, 0x82, 0x07, 0xd6, 0x79, 0x32, 0xa5, 0x3a, 0x7b, 0x87, 0x6b, 0x74, 0x3e, 0x2f, 0xf1, 0x32,
+    0x7a, 0x14, 0x72, 0x85, 0x5a, 0x1f, 0x1e, 0x1e, 0x56, 0xab, 0x6c, 0x85, 0x89, 0xbb, 0x7e, 0x30,
+    0x17, 0x6f, 0xc5, 0x32, 0x80, 0x20, 0x32, 0x76, 0x3d, 0xb6, 0xf3, 0xae, 0x80, 0xdc, 0x71, 0xa3,
+    0xc0, 0xa3, 0xe0, 0x81, 0x7d, 0xee, 0x33, 0x2d, 0x61, 0x23, 0xe1, 0xd7, 0xf9, 0x08, 0x9d, 0x96,
+    0x57, 0x7a, 0xd7, 0xc4, 0x4c, 0xf2, 0x8b, 0xe5, 0xf4, 0xbe, 0x8b, 0x26, 0x94, 0xf7, 0x58, 0x1a,
+    0xc3, 0x29, 0x99, 0x6f, 0xad, 0xf2, 0x57, 0x32, 0x0a, 0x3f, 0xb1, 0x4b, 0xef, 0x76, 0x3a, 0x5f,
+    0x56, 0x9b, 0xcc, 0x6a, 0xcb, 0x05, 0xcb, 0xc9, 0x33, 0x4a, 0x6f, 0x10, 0xf9, 0x60, 0xb4, 0xbf,
+    0xf7, 0x55, 0xa7, 0x72, 0x3e, 0x88, 0x83, 0x8e, 0x3c, 0x56, 0xeb, 0x95, 0x77, 0x77, 0x77, 0xf5,
+    0x7b, 0xf7, 0x39, 0xfa, 0x07, 0x8f, 0xdf, 0x31, 0xa7, 0x6a, 0x01, 0x33, 0x08, 0x5d, 0xd0, 0xc8,
+    0x65, 0xad, 0x44, 0x35, 0x36, 0xb3, 0xb2, 0xa7, 0xce, 0x3a, 0xd4, 0xeb, 0x79, 0xb0, 0xbb, 0xeb,
+    0x38, 0xd9, 0x05, 0x0a, 0x78, 0x1c, 0xea, 0x4f, 0xea, 0x11, 0x14, 0x1d, 0xbc, 0x16, 0xc1, 0x7a,
+    0x3a, 0xc6, 0xe3, 0x83, 0xd1, 0xc1, 0x48, 0x8b, 0x26, 0x12, 0x54, 0xcc, 0xa3, 0xc2, 0xe4, 0x95,
+    0x8e, 0x76, 0xb6, 0x55, 0xcf, 0xd8, 0x0b, 0x08, 0x1e, 0xe8, 0x66, 0xd7, 0xea, 0xe7, 0x7a, 0x0b,
+    0x55, 0xc4, 0x5a, 0xd1, 0xdc, 0xb6, 0x59, 0x14, 0x55, 0x19, 0xf8, 0xc8, 0xe3, 0xf6, 0xcd, 0x1a,
+    0x4f, 0xb8, 0x77, 0x00, 0x5e, 0xb0, 0xb3, 0xd7, 0x22, 0xdd, 0xee, 0x2e, 0xba, 0xc2, 0x5e, 0x53,
+    0xaf, 0x06, 0x3d, 0x66, 0xdb, 0x4f, 0xba, 0x75, 0xc4, 0xb0, 0x30, 0xe4, 0xe1, 0xa7, 0x90, 0xd2,
+    0xdb, 0xed, 0xb6, 0xc8, 0x13, 0xa0, 0xe7, 0xa0, 0x53, 0x47, 0x09, 0x7b, 0xb2, 0x67, 0xef, 0xda,
+    0x75, 0x94, 0x28, 0xc7, 0x0a, 0x72, 0xfb, 0x14, 0x6a, 0x0a, 0x21, 0xa2, 0x8a, 0x9a, 0xa2, 0xe9,
+    0x64, 0xa8, 0x09, 0x42, 0x86, 0x59, 0x7c, 0x81, 0x88, 0x4c, 0x4e, 0x59, 0x76, 0x40, 0x5b, 0x29,
+    0xd5, 0xfe, 0xf6, 0x7a, 0xe3, 0xfa, 0x63, 0x5e, 0x63, 0x1f, 0xeb, 0x62, 0x63, 0x86, 0x44, 0x8f,
+    0x8d, 0x05, 0x24, 0xa1, 0x99, 0xac, 0x4d, 0xe3, 0x43, 0x6a, 0xcc, 0xa7, 0x7e, 0x27, 0x59, 0xf3,
+    0xe8, 0x95, 0x1c, 0xbf, 0x2e, 0x3a, 0x66, 0x36, 0xf9, 0x81, 0x43, 0x0d, 0xe1, 0xda, 0x37, 0x45,
+    0x5b, 0xe6, 0x89, 0x6b, 0x0f, 0x99, 0x47, 0x85, 0x7b, 0xcb, 0xb4, 0x51, 0xa1, 0x57, 0x4e, 0xf4,
+    0xa7, 0xcc, 0x9d, 0x4c, 0x85, 0x76, 0x28, 0xa9, 0x01, 0x70, 0x0b, 0x85, 0x32, 0x40, 0x27, 0xcf,
+    0x92, 0xbc, 0xd7, 0xc5, 0x55, 0xc1, 0xe7, 0xf6, 0xd4, 0xa4, 0xb6, 0x22, 0xbc, 0x52, 0xae, 0xc9,
+    0x96, 0xcd, 0x1b, 0x9f, 0x8f, 0x2a, 0xf7, 0x4d, 0x47, 0x20, 0xab, 0xb9, 0x28, 0xec, 0x5b, 0x49,
+    0xf2, 0xa0, 0x24, 0x03, 0x29, 0x9a, 0xf2, 0xeb, 0x98, 0x4d, 0x4f, 0x2a, 0xb9, 0xf4, 0x64, 0xad,
+    0xab, 0xac, 0xe7, 0x82, 0x4e, 0x8f, 0x54, 0x88, 0x37, 0xd9, 0x2d, 0x24, 0xc1, 0x51, 0x0d, 0x1f,
+    0x66, 0x50, 0x23, 0x42, 0x25, 0x5a, 0xca, 0x5f, 0x2a, 0x0d, 0xae, 0xa6, 0x74, 0xa9, 0x2c, 0xa7,
+    0x36, 0x12, 0x5c, 0x75, 0xde, 0xf3, 0x49, 0x79, 0x8d, 0x36, 0xcf, 0xd2, 0x31, 0xe0, 0x93, 0xf2,
+    0x92, 0x14, 0x0b, 0x78, 0x54, 0x1e, 0xdc, 0x33, 0x2e, 0xe7, 0x91, 0xdc, 0x37, 0x36, 0x0f, 0xda,
+    0x71, 0x53, 0x62, 0xd0, 0x56, 0x3d, 0x94, 0x01, 0x36, 0x16, 0xe2, 0x7e, 0xc5, 0xb4, 0x7b, 0xfc,
+    0x97, 0x3f, 0xfe, 0xe9, 0xf7, 0xa4, 0xd8, 0xe6, 0x48, 0x9b, 0x1b, 0x00, 0x20, 0x21, 0x15, 0xb8,
+    0xe3, 0xde, 0x12, 0xdb, 0xa3, 0x51, 0x34, 0xdc, 0xc1, 0x3a, 0x78, 0x67, 0xd5, 0xe9, 0x18, 0x4c,
+    0x7b, 0x80, 0xe9, 0xa7, 0xff, 0x26, 0xe7, 0x33, 0x3a, 0x61, 0xe4, 0xb5, 0x0c, 0x20, 0x30, 0xbd,
+    0x97, 0x01, 0xc9, 0xcc, 0xce, 0x54, 0x25, 0x3b, 0xc4, 0x75, 0x92, 0x17, 0x27, 0xf2, 0x99, 0xfb,
+    0xb6, 0x07, 0xa6, 0x38, 0xdc, 0x71, 0xb8, 0x3d, 0x9f, 0x81, 0xc2, 0x5a, 0x13, 0x26, 0xce, 0x3c,
+    0x86, 0x5f, 0x9f, 0x2e, 0xcf, 0x1d, 0xa3, 0x81, 0x69, 0xf9, 0x39, 0xa6, 0xe9, 0x8d, 0xa6, 0x25,
+    0x61, 0x8d, 0x66, 0x86, 0x96, 0x8a, 0xc5, 0xb0, 0x0a, 0xd9, 0x41, 0x22, 0xff, 0x75, 0xd0, 0x86,
+    0xd1, 0xb5, 0xf0, 0x58, 0x56, 0x14, 0xb0, 0xe2, 0xe7, 0x14, 0xd7, 0x23, 0x10, 0xa8, 0xb1, 0x9a,
+    0x22, 0xae, 0xdc, 0x2e, 0x30, 0x8f, 0x0d, 0x46, 0x61, 0x19, 0x78, 0x10, 0xcd, 0x20, 0xbb, 0x3c,
+    0xbe, 0x9a, 0x07, 0xd8, 0x8a, 0x8a, 0xc8, 0x37, 0x17, 0x3f, 0x6f, 0x91, 0x8b, 0x6f, 0xe1, 0x7f,
+    0x4f, 0x5f, 0x5e, 0x10, 0xe3, 0xce, 0x85, 0xb2, 0x72, 0xc4, 0xb0, 0x43, 0x05, 0xb2, 0x15, 0x90,
+    0xc3, 0x0a, 0x0e, 0x55, 0x6c, 0x67, 0xb1, 0xdb, 0xe9, 0x90, 0xa7, 0x0f, 0xdf, 0x34, 0x41, 0x78,
+    0x12, 0x41, 0x9e, 0xd6, 0x3c, 0xf9, 0xc5, 0x47, 0x59, 0xbf, 0x90, 0x4c, 0xfd, 0x22, 0x19, 0x9c,
+    0xb2, 0x6c, 0x87, 0x50, 0xc8, 0x79, 0x02, 0x31, 0xdc, 0x91, 0xb4, 0xb7, 0x1f, 0x49, 0x86, 0x4f,
+    0x31, 0xff, 0x1b, 0xee, 0xc0, 0x1f, 0xc7, 0x63, 0xcf, 0x01, 0xf6, 0x8a, 0x79, 0xcc, 0x16, 0x86,
+    0x74, 0x18, 0x59, 0xe6, 0x0e, 0xdc, 0xd9, 0x44, 0x22, 0x8c, 0x83, 0xf3, 0x4e, 0xc2, 0xb5, 0xe4,
+    0x39, 0x03, 0x3a, 0x9a, 0x43, 0x01, 0xe7, 0x27, 0x00, 0xe8, 0x54, 0x32, 0x39, 0x6f, 0x56, 0xee,
+    0x4f, 0x85, 0x9f, 0x11, 0xbb, 0x7a, 0x27, 0x15, 0x09, 0xe4, 0x4a, 0x92, 0xfc, 0x1e, 0x45, 0xf7,
+    0xa7, 0x58, 0xb3, 0x90, 0x4f, 0xcf, 0x54, 0xb0, 0x1e, 0xb4, 0xd5, 0x32, 0x6b, 0xd7, 0x55, 0x29,
+    0x6e, 0x66, 0x1d, 0xdb, 0x63, 0x34, 0x8c, 0xb1, 0xa0, 0x02, 0xfd, 0xe5, 0x8f, 0x7f, 0xf8, 0x77,
+    0x10, 0x2f, 0xbc, 0xac, 0xc1, 0x8d, 0x7a, 0x82, 0x84, 0xab, 0x4c, 0x29, 0xdd, 0x7d, 0xfc, 0x78,
+    0x5c, 0x14, 0x46, 0x46, 0xad, 0x30, 0x75, 0x28, 0x6a, 0x69, 0x04, 0x56, 0xe6, 0x4f, 0x8e, 0xaf,
+    0xdd, 0xa0, 0x8f, 0x76, 0x2a, 0x1f, 0x94, 0x09, 0x45, 0x24, 0x51, 0x0e, 0x0c, 0x8a, 0x33, 0x08,
+    0xb7, 0x60, 0x9d, 0xde, 0x12, 0x42, 0x2f, 0x7a, 0xd4, 0x9c, 0xa2, 0x80, 0xcc, 0xf2, 0x1a, 0x34,
+    0xf2, 0xc0, 0x2d, 0x90, 0x87, 0xe4, 0x6e, 0xea, 0x0a, 0x46, 0xe6, 0x11, 0x26, 0x72, 0xcf, 0x3d,
+    0xbe, 0x74, 0xcc, 0x2b, 0xc1, 0x5c, 0x7f, 0xc4, 0xc2, 0x09, 0x70, 0x55, 0xa0, 0xc9, 0xc3, 0xc8,
+    0x18, 0x74, 0x79, 0xc4, 0x22, 0x81, 0xa8, 0xe7, 0x1e, 0x28, 0x29, 0xb0, 0x2e, 0x69, 0x72, 0xc6,
+    0x09, 0x91, 0xa5, 0x53, 0xb6, 0xcc, 0xd7, 0xcd, 0xbc, 0xc3, 0xef, 0xff, 0x97, 0x3c, 0x0f, 0xe9,
+    0x8c, 0x91, 0xa7, 0xf3, 0xf1, 0x98, 0x85, 0x05, 0xef, 0x90, 0xe8, 0xd5, 0x18, 0x41, 0x2e, 0x2a,
+    0x94, 0x8b, 0x48, 0x5f, 0x06, 0x9e, 0x21, 0x9f, 0x88, 0x16, 0xfd, 0xe0, 0x18, 0x94, 0xdc, 0x03,
+    0x0d, 0x57, 0xcb, 0x8d, 0xe4, 0x72, 0x5b, 0x28, 0x66, 0xaa, 0x21, 0x21, 0x1b, 0x03, 0x53, 0xa6,
+    0x31, 0x35, 0x4a, 0x47, 0xfe, 0xe3, 0xdf, 0xc8, 0xa5, 0x7a, 0x9d, 0xd7, 0x8e, 0xad, 0xd9, 0xf1,
+    0xdb, 0xff, 0x22, 0x2f, 0xd1, 0xc3, 0x67, 0x9c, 0x6d, 0x85, 0xb7, 0x4c, 0x92, 0x13, 0x65, 0x32,
+    0xe9, 0xd3, 0xb1, 0x0e, 0x46, 0x26, 0x30, 0x79, 0xc0, 0x7f, 0xc0, 0x37, 0xb1, 0x66, 0x16, 0xf5,
+    0x33, 0xcf, 0x89, 0x55, 0xf4, 0xc7, 0x88, 0x93, 0x61, 0x04, 0x3e, 0x4a, 0x62, 0x23, 0x64, 0xc2,
+    0x9f, 0x7f, 0xf7, 0x3f, 0xe4, 0x0a, 0xde, 0x54, 0x98, 0x47, 0x56, 0xdf, 0x25, 0x21, 0x12, 0xed,
+    0x0b, 0xd7, 0x07, 0x92, 0xd5, 0x8e, 0xb1, 0x55, 0xdd, 0x47, 0x9d, 0xf5, 0xc1, 0xc7, 0x80, 0x0e,
+    0x5a, 0x96, 0xf5, 0x29, 0x8a, 0xf5, 0xd3, 0x6f, 0xc8, 0x0b, 0xc8, 0x46, 0x81, 0x26, 0x34, 0xc2,
+    0x6a, 0x3e, 0xae, 0x28, 0x12, 0x0c, 0xc3, 0x89, 0x40, 0x61, 0xc7, 0x1a, 0x25, 0x6d, 0xc5, 0x8c,
+    0x02, 0x6a, 0x43, 0xba, 0x02, 0xea, 0x66, 0x02, 0x8d, 0x6c, 0xe7, 0xf8, 0x0d, 0x75, 0x45, 0x62,
+    0x24, 0xe9, 0xa4, 0x35, 0xe4, 0x46, 0x76, 0xe8, 0x06, 0x62, 0x45, 0x82, 0xc7, 0x04, 0x89, 0xa4,
+    0x3b, 0x65, 0x0e, 0xba, 0x56, 0x32, 0x24, 0xfe, 0xdc, 0xf3, 0x8e, 0x72, 0x00, 0x36, 0xf5, 0x6f,
+    0x69, 0x04, 0x43, 0x69, 0xd0, 0xb3, 0x21, 0x18, 0x0a, 0x16, 0xc7, 0x3d, 0xa3, 0xa1, 0x00, 0x1a,
+    0xcd, 0xc2, 0x34, 0xb1, 0x80, 0x39, 0x6a, 0x0c, 0xc3, 0x24, 0xea, 0x12, 0xc4, 0x2d, 0xa3, 0xd1,
+    0x73, 0xb2, 0xa0, 0xe9, 0x97, 0x76, 0x9b, 0x3c, 0xc3, 0xb8, 0x85, 0x3e, 0xc3, 0x09, 0x79, 0xf0,
+    0x60, 0x95, 0x17, 0xf9, 0xe0, 0x02, 0x56, 0x61, 0x38, 0x4b, 0x49, 0x31, 0xfc, 0xae, 0xa0, 0xb4,
+    0x6b, 0xac, 0x86, 0x2d, 0x48, 0x0e, 0xcf, 0x30, 0x82, 0xbc, 0x70, 0x23, 0xc1, 0x7c, 0x16, 0x1a,
+    0x8d, 0xa4, 0x07, 0xd9, 0x68, 0x11, 0x83, 0x35, 0xc9, 0xf0, 0xb8, 0x90, 0xd1, 0x30, 0x59, 0xf5,
+    0xc1, 0x94, 0x67, 0x6c, 0x4c, 0xc1, 0x1d, 0x19, 0x85, 0xea, 0x29, 0x83, 0x5c, 0x4a, 0x15, 0x31,
+    0xe3, 0x32, 0x19, 0xcc, 0xd9, 0x5e, 0xe4, 0xbd, 0xe8, 0x83, 0x10, 0x70, 0xcb, 0x90, 0x40, 0x0d,
+    0x7d, 0xda, 0xf5, 0x43, 0x36, 0x83, 0x95, 0x3f, 0x1f, 0x09, 0x3c, 0xf8, 0xac, 0xec, 0xa9, 0x23,
+    0x6f, 0x25, 0x7b, 0xcc, 0x10, 0x50, 0x01, 0x99, 0xe5, 0x50, 0x41, 0xaf, 0xb1, 0x93, 0x07, 0x6e,
+    0xd3, 0x92, 0xaf, 0xf3, 0xf0, 0xee, 0x98, 0x18, 0xf2, 0xb5, 0xe5, 0x31, 0x7f, 0x22, 0xa6, 0xe4,
+    0x98, 0x74, 0x9a, 0x05, 0x42, 0x65, 0x41, 0x93, 0x66, 0x13, 0x0a, 0xfc, 0x6d, 0xe7, 0x5d, 0x61,
+    0xe5, 0x8f, 0xf5, 0x6c, 0x1a, 0xcf, 0x7d, 0x59, 0xb8, 0x91, 0x8a, 0xbc, 0xa4, 0xd4, 0xf5, 0x4d,
+    0xf6, 0x81, 0xdb, 0x40, 0x08, 0x4b, 0x40, 0x79, 0xc9, 0x84, 0x95, 0x2c, 0xaf, 0xdf, 0xc7, 0x06,
+    0xb4, 0x57, 0xd3, 0xbd, 0x11, 0xd5, 0xda, 0x65, 0x0a, 0x3e, 0x01, 0x41, 0xf2, 0xab, 0xe4, 0x1e,
+    0xc0, 0x72, 0xaf, 0xa6, 0xfc, 0x8e, 0xc4, 0xa1, 0x50, 0xb3, 0x71, 0x10, 0x3a, 0xd4, 0x45, 0xe8,
+    0x5d, 0xd8, 0x1d, 0x41, 0xa4, 0x97, 0xf2, 0x45, 0x51, 0x45, 0x14, 0x98, 0xc5, 0x7d, 0x99, 0x48,
+    0x0d, 0xf5, 0x7a, 0xb6, 0xc2, 0x8a, 0x71, 0x59, 0xa1, 0x8c, 0x33, 0xb2, 0xa3, 0x12, 0x20, 0x80,
+    0x64, 0xd0, 0x55, 0x60, 0x93, 0xfd, 0x95, 0x2a, 0x8f, 0x12, 0x6f, 0x0a, 0xd2, 0xf9, 0x28, 0xb4,
+    0xa5, 0x0e, 0xc6, 0x82, 0x53, 0x39, 0xc9, 0xd1, 0xbd, 0xb1, 0xa1, 0x73, 0xb7, 0xe2, 0x6c, 0x01,
+    0xf0, 0x36, 0x64, 0xbe, 0xd0, 0xd8, 0x12, 0x5f, 0x9a, 0xa4, 0x02, 0xc6, 0xb4, 0xdb, 0x0c, 0x02,
+    0xa3, 0x5e, 0xc4, 0xca, 0xa8, 0x3e, 0xea, 0x19, 0xb4, 0xc1, 0xc6, 0x3e, 0x6a, 0x05, 0x85, 0x7f,
+    0x4e, 0xa2, 0x67, 0x60, 0x93, 0xaf, 0x2f, 0x5f, 0xe8, 0x94, 0x31, 0xaf, 0x54, 0xa0, 0x23, 0x2a,
+    0x0e, 0x1a, 0x0d, 0x55, 0x8b, 0x25, 0x6a, 0xd6, 0x27, 0x0d, 0xf2, 0x58, 0x6a, 0x99, 0x85, 0x27,
+    0xe4, 0x2d, 0xd2, 0x48, 0xdb, 0x7c, 0x0d, 0xed, 0xf1, 0x4d, 0x59, 0xa1, 0x73, 0x99, 0x79, 0x41,
+    0xc6, 0x68, 0x4c, 0x5f, 0x64, 0x55, 0xba, 0x09, 0x1b, 0x10, 0xf3, 0xd0, 0xaf, 0x21, 0x56, 0x69,
+    0x98, 0xca, 0x9d, 0xcf, 0xbc, 0xba, 0x90, 0xa3, 0x60, 0x8a, 0x8e, 0x2b, 0x99, 0xa9, 0x7c, 0xdd,
+    0xb7, 0x98, 0xec, 0x81, 0x8c, 0xe3, 0x46, 0xf4, 0x6a, 0x77, 0x15, 0x93, 0x30, 0x50, 0x9e, 0xaa,
+    0xbb, 0x01, 0x38, 0xed, 0x22, 0xe4, 0xd8, 0x0b, 0xc6, 0x68, 0x2f, 0x2b, 0x23, 0x88, 0xf2, 0x55,
+    0x33, 0x37, 0x52, 0xab, 0xff, 0x97, 0x16, 0x0a, 0x5e, 0x26, 0xe6, 0x83, 0x62, 0x82, 0x16, 0x28,
+    0x50, 0x10, 0x27, 0xbe, 0xa3, 0xaa, 0x31, 0x03, 0xd0, 0x37, 0xff, 0xd6, 0x86, 0x90, 0x53, 0xb5,
+    0xcd, 0xd4, 0x57, 0x4b, 0x77, 0x81, 0x11, 0xc0, 0x80, 0x4b, 0x59, 0x62, 0x65, 0x2a, 0xac, 0xbc,
+    0x24, 0x55, 0xae, 0x25, 0x1b, 0x62, 0xb0, 0x8f, 0xbd, 0x4e, 0xf1, 0x20, 0x4f, 0x8d, 0xab, 0x66,
+    0x1e, 0x00, 0xec, 0x16, 0x01, 0x8a, 0xcb, 0x41, 0x3e, 0x76, 0x27, 0xf3, 0x31, 0x55, 0xda, 0xe5,
+    0x91, 0x89, 0x05, 0x9e, 0xda, 0xde, 0x29, 0xc1, 0x02, 0xb9, 0x2d, 0xd2, 0x91, 0xff, 0xc1, 0xb2,
+    0x2d, 0x44, 0xdd, 0xac, 0xc7, 0xfd, 0x73, 0x26, 0xe2, 0x16, 0x05, 0xc6, 0xf4, 0x07, 0x3a, 0xdd,
+    0x81, 0x41, 0x64, 0x29, 0x66, 0x91, 0xb0, 0x18, 0x48, 0xe4, 0x3c, 0x79, 0x65, 0xd4, 0x2e, 0xa5,
+    0xe6, 0x3b, 0x6a, 0x6a, 0x8a, 0x46, 0xe6, 0x0e, 0xf5, 0x34, 0x9d, 0xaa, 0x52, 0x15, 0xf9, 0xdb,
+    0x35, 0x47, 0xae, 0x80, 0x42, 0x17, 0x38, 0x59, 0x59, 0x9f, 0x6a, 0x16, 0x1d, 0xb9, 0x3e, 0xd4,
+    0x69, 0x31, 0xd5, 0x63, 0x9c, 0x98, 0xce, 0x7b, 0x26, 0xa7, 0x19, 0x48, 0xc5, 0xc6, 0x4c, 0x5a,
+    0xb5, 0x14, 0x22, 0x16, 0x62, 0x8f, 0xcd, 0x84, 0x2f, 0x28, 0x0f, 0x90, 0x8b, 0x5a, 0xaa, 0xcc,
+    0xbd, 0x31, 0x13, 0xf6, 0xd4, 0x68, 0xb4, 0x95, 0x93, 0x81, 0x6c, 0xad, 0x6c, 0x4e, 0x50, 0x2a,
+    0x4c, 0x39, 0x7a, 0xdd, 0x8b, 0x57, 0x57, 0xd7, 0x8d, 0x56, 0x39, 0xc3, 0x90, 0x5a, 0x1d, 0xf5,
+    0x2b, 0x2c, 0xb1, 0x11, 0xbb, 0x26, 0xf3, 0x7a, 0x19, 0xb0, 0x06, 0xa0, 0xc1, 0xeb, 0x3e, 0xae,
+    0x4d, 0x51, 0x93, 0xdb, 0x1c, 0x34, 0x5f, 0x98, 0x91, 0x00, 0x93, 0x98, 0x69, 0x50, 0xcb, 0xf9,
+    0xdf, 0x99, 0x52, 0x92, 0xe6, 0xe9, 0xe5, 0x29, 0x4c, 0xb7, 0x43, 0xbb, 0x7b, 0x60, 0xac, 0x38,
+    0xd7, 0xb4, 0x04, 0xbf, 0x12, 0xc8, 0x60, 0xa3, 0x7b, 0xd0, 0xb4, 0x02, 0x0a, 0x3c, 0xa4, 0xa1,
+    0x30, 0xf6, 0x20, 0x2e, 0x74, 0x1a, 0xcd, 0xb2, 0x31, 0x97, 0x57, 0xc1, 0x3e, 0x62, 0x3f, 0x23,
+    0x8c, 0xbc, 0x09, 0xe7, 0x51, 0x58, 0x20, 0x16, 0xdf, 0x00, 0x0d, 0x0f, 0x40, 0x82, 0x0c, 0xfd,
+    0x4f, 0xf2, 0x5d, 0xba, 0x61, 0xa3, 0x59, 0x01, 0x0e, 0xae, 0x41, 0xef, 0xac, 0xb2, 0x71, 0xee,
+    0xcf, 0xff, 0xf9, 0x93, 0x8c, 0x6d, 0x0a, 0x1e, 0x36, 0x10, 0x1f, 0xeb, 0x35, 0x34, 0x4e, 0xa9,
+    0x58, 0xd2, 0x1f, 0xd5, 0x52, 0x0d, 0xec, 0x06, 0x31, 0xab, 0x83, 0xb9, 0x0d, 0xc8, 0xf8, 0x03,
+    0x39, 0x43, 0x50, 0x15, 0x69, 0xe5, 0x2c, 0x6b, 0x06, 0x74, 0x80, 0x14, 0x80, 0x28, 0xf9, 0xdc,
+    0x28, 0x2d, 0x58, 0xeb, 0xba, 0xd0, 0x5c, 0x2e, 0x4f, 0xcd, 0xd3, 0xd3, 0xf3, 0xeb, 0x6b, 0x62,
+    0x74, 0x16, 0xdd, 0x4e, 0xaf, 0x9b, 0xde, 0x59, 0x23, 0x9d, 0xc5, 0x73, 0xf8, 0x34, 0x5b, 0x04,
+    0x0a, 0x47, 0x7b, 0xca, 0xec, 0x1b, 0x48, 0x4b, 0x46, 0x4b, 0x02, 0xbc, 0x83, 0x30, 0x1f, 0xce,
+    0xee, 0x68, 0xc8, 0xca, 0x4e, 0x30, 0x56, 0x84, 0xa5, 0x60, 0x51, 0xd1, 0xf7, 0xc9, 0x82, 0x52,
+    0x7a, 0x67, 0x85, 0xb9, 0xd8, 0xce, 0x0f, 0x89, 0x81, 0x20, 0x2e, 0x02, 0x1c, 0xc1, 0x9f, 0x01,
+    0x91, 0x68, 0xe2, 0x2a, 0x00, 0xde, 0x3c, 0x7e, 0xac, 0x4b, 0xa5, 0x11, 0xe5, 0xaf, 0x86, 0x0a,
+    0xf6, 0xad, 0xfb, 0x8e, 0x0c, 0x06, 0xe4, 0xb0, 0x2c, 0x98, 0x14, 0xfd, 0x07, 0x85, 0xfe, 0x03,
+    0x41, 0x30, 0xf2, 0x41, 0x8f, 0x33, 0xc1, 0x0b, 0xd1, 0x0c, 0xff, 0x3c, 0x04, 0x8a, 0x0f, 0x3b,
+    0x60, 0xe9, 0xe4, 0x6b, 0x62, 0xc8, 0x37, 0xb0, 0x48, 0xb7, 0x49, 0x7e, 0x45, 0x14, 0xcf, 0x9a,
+    0x12, 0x02, 0xf7, 0x44, 0xfa, 0x24, 0x33, 0xfe, 0x50, 0xbb, 0xd3, 0xbc, 0x30, 0xca, 0x4f, 0x2a,
+    0xaf, 0xc1, 0xf5, 0x37, 0x8b, 0x3b, 0x35, 0x2e, 0x2a, 0xbe, 0x85, 0xa8, 0xa2, 0x85, 0x26, 0x16,
+    0x65, 0x9c, 0xe5, 0x24, 0xa4, 0x4b, 0x79, 0x4b, 0x11, 0x85, 0x1b, 0x09, 0x8d, 0x5f, 0x44, 0x88,
+    0x24, 0xb9, 0x00, 0xb7, 0x24, 0x76, 0x7b, 0x27, 0x21, 0xbc, 0x32, 0x54, 0xac, 0x7a, 0x94, 0xac,
+    0xb2, 0x5e, 0xac, 0xf9, 0x09, 0xd5, 0x82, 0x55, 0x49, 0x0d, 0xe6, 0x6d, 0xb0, 0x99, 0xb7, 0x2e,
+    0xcc, 0xd8, 0x7b, 0x77, 0x54, 0x01, 0x36, 0xc9, 0x81, 0x81, 0x7d, 0x74, 0x2b, 0x41, 0x47, 0x45,
+    0xd0, 0x9e, 0x06, 0x14, 0x37, 0x8b, 0xda, 0x34, 0x04, 0x02, 0x1e, 0xe1, 0xf9, 0xf2, 0x57, 0x5f,
+    0x01, 0xe4, 0x44, 0x7e, 0xdf, 0x3f, 0x7c, 0x02, 0xdf, 0x47, 0xf2, 0x7b, 0xb7, 0xbb, 0x77, 0x54,
+    0x23, 0xcb, 0x22, 0xc3, 0x4f, 0xc0, 0xcb, 0x2e, 0x37, 0x8c, 0x46, 0x29, 0xeb, 0x96, 0x8a, 0x75,
+    0x4b, 0x60, 0x5d, 0xc2, 0xb2, 0xa5, 0x9e, 0x65, 0xe9, 0x94, 0x85, 0x9a, 0xb2, 0x48, 0xb8, 0x0d,
+    0x5f, 0x6b, 0x34, 0x5d, 0xc5, 0x6a, 0x07, 0x27, 0x2d, 0x61, 0x57, 0x4a, 0x3e, 0x8f, 0xc9, 0xe2,
+    0xa8, 0x06, 0x9c, 0x7b, 0xce, 0x85, 0xbb, 0x60, 0x98, 0x56, 0x2b, 0x5e, 0x39, 0x8b, 0x77, 0x75,
+    0xf0, 0xa0, 0x36, 0x09, 0x7c, 0x3a, 0x15, 0x8c, 0xa4, 0x77, 0x08, 0x36, 0xd5, 0x01, 0xb3, 0xe9,
+    0xed, 0xef, 0xd7, 0x4d, 0x8f, 0x9d, 0xe4, 0x6a, 0xae, 0x99, 0x62, 0xd4, 0x4f, 0x4b, 0x89, 0x52,
+    0x2a, 0x5b, 0x03, 0x59, 0x95, 0xa9, 0x3e, 0x73, 0x21, 0x02, 0xba, 0xa3, 0xb9, 0x60, 0x6a, 0x75,
+    0x2d, 0x1c, 0xd6, 0x25, 0x0b, 0x54, 0xb7, 0x84, 0xd3, 0x55, 0x4c, 0xce, 0xd2, 0x24, 0xd5, 0x93,
+    0x3c, 0x1e, 0xc6, 0xbb, 0x7a, 0x44, 0x9e, 0x90, 0x36, 0xe9, 0x1e, 0xe8, 0xc9, 0xfb, 0x58, 0xb3,
+    0xae, 0x09, 0xeb, 0x1e, 0x83, 0xa4, 0xc9, 0xc3, 0x87, 0x20, 0x39, 0x45, 0x85, 0xde, 0xd8, 0x2b,
+    0xc8, 0x50, 0xa2, 0x36, 0x0b, 0xe4, 0xec, 0xde, 0x8b, 0x9c, 0xfb, 0x13, 0x90, 0x5b, 0x7c, 0xff,
+    0x9e, 0xbc, 0xc8, 0xc8, 0xe0, 0x13, 0xd9, 0x51, 0x94, 0x4e, 0x77, 0x2b, 0x8a, 0x3e, 0x6e, 0xe1,
+    0x0e, 0x2e, 0xf0, 0x24, 0xc5, 0xf5, 0xf1, 0x50, 0x05, 0xc3, 0x17, 0x31, 0xba, 0x04, 0x53, 0x56,
+    0x3c, 0x1b, 0x09, 0x50, 0x61, 0x21, 0x43, 0x1e, 0xca, 0xe3, 0x96, 0x16, 0xe9, 0x0e, 0x65, 0x0f,
+    0xb9, 0xa9, 0x71, 0xcc, 0x01, 0x95, 0xb1, 0x59, 0xb9, 0xe6, 0xd7, 0x80, 0xee, 0x50, 0xe7, 0x98,
+    0x61, 0x13, 0x87, 0x9f, 0xdb, 0x39, 0x23, 0xd5, 0xe7, 0xd2, 0x6f, 0xbc, 0xa4, 0x62, 0x6a, 0x41,
+    0x24, 0xe2, 0xa1, 0xe1, 0x6a, 0x56, 0xca, 0x66, 0xd7, 0x42, 0xcd, 0x78, 0x02, 0x6a, 0x07, 0xb0,
+    0x5f, 0x6a, 0x61, 0x51, 0xa4, 0x89, 0x0b, 0x96, 0x5e, 0xa2, 0x4a, 0x80, 0x6a, 0xef, 0x6f, 0x63,
+    0x42, 0xde, 0x91, 0x87, 0x43, 0xf2, 0x2f, 0xc0, 0x45, 0x88, 0xbf, 0x6a, 0x21, 0x5d, 0xe1, 0x48,
+    0x98, 0x07, 0x49, 0xe2, 0x66, 0xf8, 0x7e, 0x1c, 0x92, 0x75, 0xe8, 0x36, 0x95, 0x77, 0x1c, 0xd7,
+    0xd5, 0x0a, 0x9b, 0x85, 0xf6, 0xfc, 0x19, 0x62, 0xf1, 0x92, 0x6b, 0x5c, 0x24, 0x48, 0x20, 0xac,
+    0x11, 0xf2, 0x25, 0xc1, 0xdf, 0x6b, 0x8a, 0x7c, 0x9f, 0xbe, 0x1a, 0xde, 0xd2, 0x68, 0x6c, 0x81,
+    0xaa, 0xa2, 0xa5, 0x26, 0xc2, 0xb9, 0xa6, 0xa3, 0x56, 0x7b, 0x78, 0xf2, 0x77, 0x9a, 0xb6, 0x7f,
+    0x13, 0x1f, 0xbe, 0xf5, 0xf1, 0x14, 0x16, 0xc8, 0xc6, 0xa4, 0x1c, 0x8a, 0x2c, 0xe2, 0x46, 0x60,
+    0xb8, 0x9e, 0xd3, 0x42, 0xb3, 0x1e, 0x83, 0x20, 0x42, 0x34, 0xe2, 0x16, 0xa4, 0xde, 0x34, 0x62,
+    0x4d, 0x22, 0x0f, 0x3f, 0x23, 0x32, 0xe1, 0x59, 0x54, 0x7c, 0x0e, 0xc1, 0x1c, 0xeb, 0xd2, 0xf6,
+    0x5d, 0xd4, 0x96, 0x67, 0x69, 0x84, 0x0a, 0xf2, 0xcd, 0xab, 0xef, 0xdf, 0x5f, 0x9e, 0x5c, 0x9f,
+    0xbd, 0xff, 0xc5, 0x3f, 0x5a, 0xe4, 0x8c, 0xda, 0x53, 0x35, 0x19, 0x24, 0x0c, 0x4e, 0x26, 0x22,
+    0x14, 0xf7, 0x18, 0x8a, 0x2c, 0x1e, 0xb9, 0x46, 0x8b, 0x44, 0x1c, 0x13, 0x7d, 0x79, 0xaa, 0x35,
+    0xe1, 0x2d, 0xd0, 0x60, 0x2e, 0x7b, 0x5e, 0x48, 0xa0, 0xa0, 0x23, 0xbc, 0xd9, 0x10, 0xbf, 0x79,
+    0xe3, 0x3e, 0x77, 0xe5, 0x41, 0x60, 0x84, 0x83, 0x59, 0x4c, 0xa1, 0xbc, 0x24, 0x82, 0x75, 0xbb,
+    0xeb, 0x4b, 0x42, 0x5e, 0x9c, 0x9d, 0x5c, 0x9d, 0xbd, 0x7f, 0x79, 0x65, 0x15, 0xce, 0x93, 0x32,
+    0x44, 0xca, 0x5e, 0xc9, 0x91, 0x66, 0x3c, 0x99, 0x0b, 0x00, 0xbd, 0xfd, 0x12, 0x44, 0x7a, 0x17,
+    0xad, 0xa6, 0x39, 0x98, 0xc0, 0x64, 0xa5, 0x94, 0x9f, 0x8d, 0x47, 0xa0, 0x9b, 0x60, 0x40, 0xb8,
+    0xe2, 0x11, 0x9b, 0xe4, 0xf8, 0x15, 0x07, 0x9f, 0x20, 0xb4, 0x27, 0x77, 0x30, 0xf7, 0x3b, 0xf4,
+    0xce, 0x2d, 0xfc, 0xf6, 0xbd, 0xf4, 0xd3, 0xc5, 0xf1, 0x6b, 0x77, 0xa6, 0xda, 0x7e, 0xb9, 0xc9,
+    0x1a, 0x6f, 0xa2, 0x4e, 0x44, 0x5f, 0xae, 0x56, 0x34, 0xf4, 0x67, 0x1c, 0x51, 0x4a, 0x0e, 0x04,
+    0x94, 0x37, 0x6c, 0x14, 0x03, 0x37, 0xee, 0xa2, 0x7e, 0xbb, 0x8d, 0x5a, 0xec, 0x71, 0xd5, 0x29,
+    0xb0, 0xa6, 0x1c, 0xc0, 0x1f, 0x93, 0x46, 0xaa, 0x3b, 0xa5, 0x1e, 0xaa, 0x9c, 0x6a, 0xa9, 0x32,
+    0x1e, 0x7b, 0x0d, 0x68, 0xce, 0x14, 0xc3, 0x93, 0x3a, 0x37, 0x6f, 0x68, 0xc1, 0xb9, 0xcf, 0x03,
+    0xe6, 0xd7, 0x34, 0x13, 0xf3, 0x5c, 0x53, 0xb3, 0xb6, 0xf0, 0x0f, 0xe9, 0x91, 0x31, 0xf8, 0x87,
+    0x42, 0x9f, 0x56, 0x73, 0x84, 0xcc, 0x9c, 0x46, 0x6d, 0x03, 0x31, 0x25, 0x1a, 0x95, 0x9d, 0x6d,
+    0x4c, 0x75, 0xd9, 0xd1, 0x7c, 0x0e, 0x9a, 0x43, 0x96, 0x3b, 0xf8, 0x6e, 0xe8, 0xfc, 0x9d, 0x40,
+    0x8d, 0x01, 0xbb, 0x37, 0xca, 0x1a, 0xd1, 0xc2, 0x4b, 0x78, 0xc5, 0x96, 0xd6, 0xc7, 0xcd, 0xa2,
+    0x15, 0xb6, 0xb5, 0x24, 0x2a, 0x79, 0x31, 0x42, 0xe3, 0x81, 0x5e, 0x46, 0xda, 0xb6, 0x7e, 0x86,
+    0x2d, 0xfa, 0xae, 0x3e, 0x16, 0x4e, 0xd8, 0x1e, 0xc7, 0xe2, 0x54, 0x7a, 0x21, 0x70, 0x73, 0x77,
+    0x3c, 0x8c, 0xd0, 0xef, 0x51, 0x1f, 0x9d, 0xd1, 0x8d, 0x1b, 0x04, 0xe0, 0xe2, 0x21, 0x4c, 0xf4,
+    0x41, 0x69, 0xd1, 0x9b, 0xfd, 0xf3, 0x9c, 0xcd, 0x19, 0x19, 0x31, 0xf0, 0x21, 0x0e, 0x42, 0x78,
+    0xfc, 0x4e, 0x72, 0xa8, 0xb4, 0x7c, 0x66, 0x75, 0x4b, 0xe9, 0x24, 0x73, 0x4e, 0x66, 0x7c, 0x0e,
+    0xac, 0x3d, 0x56, 0x99, 0x75, 0x4c, 0xbb, 0x3a, 0x87, 0xd4, 0xd1, 0x17, 0x9f, 0x0c, 0x86, 0xea,
+    0x84, 0x00, 0x8d, 0x06, 0x1b, 0x56, 0xbf, 0xc4, 0x0e, 0x10, 0x3e, 0xc8, 0x6c, 0x4c, 0xdd, 0x4a,
+    0x31, 0x0e, 0x9a, 0xc5, 0x1c, 0x0c, 0x67, 0x59, 0x20, 0x93, 0x73, 0x5f, 0x74, 0x0f, 0xb0, 0x29,
+    0xaa, 0xf8, 0x86, 0xb1, 0xaa, 0x1e, 0xb4, 0x97, 0x32, 0xb7, 0x0e, 0x16, 0xf3, 0x41, 0x00, 0xde,
+    0x4b, 0x45, 0xa0, 0x05, 0xcf, 0x32, 0x01, 0xc5, 0x68, 0xa8, 0xf9, 0x8a, 0x1f, 0x6b, 0xa3, 0xd1,
+    0x49, 0x68, 0x53, 0x87, 0x91, 0x99, 0xbb, 0xe8, 0x93, 0x79, 0xd0, 0x76, 0xf8, 0x9d, 0x4f, 0x9c,
+    0xd0, 0xbd, 0x65, 0x91, 0xda, 0x4d, 0x5b, 0xd2, 0x49, 0x90, 0x71, 0x91, 0x5e, 0x6d, 0x92, 0x78,
+    0x56, 0xe1, 0x90, 0x6c, 0x8f, 0xce, 0x02, 0x34, 0xac, 0x5b, 0x69, 0x59, 0x32, 0xd9, 0x9c, 0xd1,
+    0x85, 0x61, 0xca, 0x4b, 0xd0, 0xea, 0xd1, 0xf5, 0x8d, 0xd5, 0x93, 0xbc, 0xac, 0x63, 0xdc, 0x42,
+    0x1e, 0x0b, 0xef, 0x9a, 0x45, 0x9e, 0x17, 0x14, 0x55, 0x62, 0x37, 0xa4, 0x7b, 0x7d, 0x2c, 0xfd,
+    0x6d, 0xb3, 0x45, 0x32, 0xef, 0xcc, 0xe4, 0x5d, 0x36, 0x9c, 0x6c, 0x78, 0x26, 0x80, 0x27, 0xe3,
+    0xe9, 0xde, 0x98, 0x7e, 0x73, 0x60, 0xb1, 0x68, 0xc5, 0x49, 0x90, 0x40, 0xc3, 0x7f, 0x8a, 0xe4,
+    0x83, 0x01, 0x9f, 0x7a, 0x2e, 0x98, 0xf8, 0x25, 0x1e, 0x49, 0x6b, 0xfb, 0xe3, 0xea, 0x92, 0x2a,
+    0x36, 0x29, 0x00, 0x24, 0x3e, 0x34, 0x68, 0x93, 0xde, 0x51, 0xa9, 0xef, 0x26, 0x33, 0x6e, 0x83,
+    0xe1, 0x75, 0x46, 0x40, 0xf8, 0x1d, 0xec, 0x49, 0xce, 0x40, 0xe1, 0xe0, 0x77, 0x89, 0xa6, 0x09,
+    0x53, 0xd5, 0x37, 0xcd, 0xfc, 0x65, 0x76, 0xfe, 0xf7, 0xc9, 0x7c, 0xbc, 0x7d, 0xba, 0x6e, 0x7a,
+    0xdc, 0xc9, 0x87, 0x62, 0x3a, 0x29, 0x13, 0xa6, 0xcb, 0x80, 0x0b, 0xc3, 0x59, 0xb4, 0x00, 0x6d,
+    0xb3, 0x7c, 0x66, 0x2e, 0x41, 0x8f, 0xb1, 0x7f, 0x56, 0xf6, 0xa0, 0xb0, 0x8f, 0xf6, 0x50, 0x22,
+    0xd3, 0x78, 0xce, 0xa5, 0x7e, 0x2c, 0x9f, 0x92, 0xc7, 0xf1, 0xd4, 0x29, 0x34, 0x37, 0xe2, 0xe0,
+    0x6a, 0x3a, 0x4b, 0x1d, 0xf5, 0x37, 0x2a, 0xc0, 0x67, 0xe3, 0xb8, 0xc5, 0xc7, 0x63, 0x30, 0xaf,
+    0x37, 0x7a, 0x9e, 0xe7, 0x20, 0x55, 0x3a, 0x2b, 0x79, 0x0d, 0x4c, 0x8c, 0x65, 0xf6, 0x18, 0xf7,
+    0xf2, 0x28, 0x7d, 0x34, 0xe5, 0x1a, 0xcd, 0xf4, 0x2f, 0xc4, 0xd4, 0x60, 0xd1, 0x58, 0x8b, 0x14,
+    0x05, 0x90, 0xc3, 0xb9, 0xdc, 0x02, 0x67, 0x9d, 0xe2, 0x86, 0x4c, 0xba, 0x8b, 0x6a, 0xbb, 0xc4,
+    0xa2, 0xe3, 0x1c, 0x2f, 0x40, 0xdf, 0x52, 0xcf, 0x48, 0x92, 0x90, 0x66, 0x89, 0x60, 0x7d, 0x6e,
+    0x92, 0x11, 0x44, 0x39, 0xab, 0xa9, 0xe7, 0x5f, 0x25, 0x13, 0x1a, 0x8d, 0x5a, 0x23, 0x57, 0xa7,
+    0x4d, 0x9d, 0x7a, 0xbb, 0x4d, 0x6d, 0xb0, 0x7c, 0x6d, 0x26, 0xbe, 0xee, 0x8d, 0xbe, 0xad, 0xea,
+    0xf6, 0x4c, 0x3a, 0x1b, 0xf4, 0xe2, 0x42, 0x81, 0x9f, 0xd2, 0x00, 0xbc, 0x1e, 0x03, 0xcb, 0x89,
+    0xe7, 0x9f, 0x3b, 0x25, 0xcf, 0x9b, 0xf3, 0x10, 0xe5, 0x3d, 0xac, 0x44, 0x50, 0xc9, 0x5c, 0x15,
+    0x12, 0x94, 0x28, 0xb2, 0x53, 0x54, 0x30, 0x07, 0xed, 0xcc, 0x24, 0xca, 0x15, 0x77, 0x87, 0xd6,
+    0xef, 0x1c, 0x09, 0xad, 0xda, 0x39, 0x9a, 0x6d, 0xaa, 0x03, 0xd5, 0x5b, 0xda, 0x6e, 0xc1, 0x39,
+    0x5e, 0x53, 0x2a, 0xe8, 0xe1, 0x56, 0x08, 0x6c, 0xea, 0xdb, 0xcc, 0xab, 0x45, 0xa2, 0x89, 0x46,
+    0x99, 0xbb, 0x88, 0x85, 0x5d, 0x96, 0x6c, 0xe2, 0x48, 0x5b, 0x8f, 0xcb, 0x58, 0xfa, 0xb5, 0x3d,
+    0x73, 0x86, 0x88, 0x6b, 0x7d, 0x61, 0xbe, 0xb6, 0x9c, 0x44, 0x1f, 0xc4, 0x41, 0xcf, 0x25, 0x88,
+    0x11, 0x67, 0x7b, 0xf2, 0xa1, 0x0f, 0xd8, 0xe5, 0x97, 0xed, 0x0a, 0x48, 0x5d, 0x21, 0xa0, 0xbf,
+    0xcd, 0xa7, 0xee, 0xeb, 0xe3, 0xcd, 0x04, 0xa8, 0x2f, 0xe7, 0xf2, 0x57, 0xd4, 0x85, 0x23, 0xa0,
+    0x23, 0xd2, 0x23, 0xbf, 0xf8, 0x01, 0x33, 0xb2, 0xc0, 0x03, 0x21, 0x2c, 0x65, 0x53, 0x09, 0xcf,
+    0xd2, 0xb3, 0xed, 0xec, 0x62, 0x09, 0x72, 0x9d, 0xdc, 0x75, 0xfc, 0xac, 0x05, 0x48, 0x7a, 0x83,
+    0xf2, 0xeb, 0xe9, 0x0f, 0xc3, 0x5e, 0x45, 0x25, 0xc2, 0xfd, 0xb8, 0xf8, 0x5e, 0x7f, 0xf3, 0x01,
+    0x09, 0xf8, 0xe6, 0xea, 0xd5, 0xb7, 0x56, 0x80, 0xff, 0x18, 0x84, 0xa1, 0x6e, 0xae, 0x55, 0x36,
+    0xb6, 0x56, 0xed, 0x0a, 0x91, 0xb4, 0x2e, 0x20, 0x7f, 0x8a, 0x96, 0xda, 0x36, 0xd3, 0xd7, 0x19,
+    0x20, 0xf0, 0x5e, 0x8f, 0x89, 0xb1, 0x7a, 0x0e, 0x42, 0x3e, 0x09, 0xf1, 0x8a, 0xc4, 0x17, 0x43,
+    0xe5, 0x37, 0x01, 0xba, 0x21, 0x9b, 0x07, 0x1a, 0x18, 0xd8, 0xfa, 0x97, 0x0d, 0x02, 0xaa, 0xa5,
+    0x39, 0x54, 0xc5, 0x0f, 0x8c, 0xb8, 0x8e, 0x07, 0x75, 0xb9, 0x47, 0x65, 0xaa, 0x21, 0x8f, 0x27,
+    0x0b, 0xc8, 0x70, 0xe8, 0x7d, 0x3c, 0xf4, 0x7e, 0x26, 0x71, 0x92, 0x59, 0xb4, 0x4d, 0xbf, 0x25,
+    0xe5, 0x7c, 0xb1, 0x36, 0xd1, 0x9f, 0x1d, 0x2b, 0xfb, 0xea, 0xc7, 0x64, 0x48, 0x7b, 0x51, 0xee,
+    0x1d, 0x57, 0x6e, 0xe7, 0x5e, 0xab, 0xcc, 0x51, 0xf2, 0x27, 0x7e, 0x31, 0xf7, 0x7d, 0x6c, 0x1f,
+    0x20, 0x4f, 0x8c, 0xf8, 0xa1, 0x19, 0x73, 0x00, 0xe7, 0xff, 0x93, 0x0f, 0xd3, 0xf5, 0xcb, 0x3e,
+    0xa5, 0x02, 0xbc, 0xc2, 0x52, 0xad, 0x0b, 0x08, 0x47, 0xea, 0xf9, 0xfd, 0xec, 0x36, 0xcb, 0xea,
+    0xfc, 0x40, 0x5b, 0xd5, 0x43, 0x10, 0x63, 0x9e, 0xbb, 0x0b, 0xe6, 0x18, 0x3d, 0xb9, 0x08, 0xf9,
+    0xa5, 0x5c, 0xd1, 0x6f, 0xd3, 0xb5, 0x8b, 0x3e, 0x4b, 0xee, 0x92, 0xe3, 0xa2, 0x89, 0x8e, 0xd4,
+    0x4f, 0xc1, 0x22, 0x8f, 0x18, 0x8a, 0x0b, 0x58, 0xb2, 0x58, 0xf2, 0x77, 0xcf, 0xf8, 0x13, 0x0f,
+    0x9c, 0xd8, 0x4c, 0xf8, 0x26, 0x87, 0xe2, 0x96, 0x0e, 0xd2, 0xa4, 0xbe, 0xb6, 0xb2, 0xa3, 0xd2,
+    0x37, 0xa8, 0x51, 0xf5, 0xf5, 0x5e, 0x85, 0x6c, 0xb9, 0x60, 0x4c, 0xed, 0x17, 0x7f, 0x9c, 0xda,
+    0xe9, 0x6c, 0xe4, 0x6d, 0x32, 0x36, 0xaf, 0xf7, 0x35, 0xd7, 0xd3, 0xa4, 0xbc, 0x53, 0x65, 0x07,
+    0x9e, 0x3b, 0x67, 0x3d, 0x0d, 0x99, 0x72, 0xcf, 0x89, 0x88, 0x2b, 0x2c, 0x72, 0xe2, 0x93, 0x79,
+    0xfc, 0xab, 0x12, 0x47, 0xcd, 0xc9, 0xf5, 0x8f, 0x18, 0x04, 0x42, 0x17, 0x8c, 0x15, 0x18, 0x23,
+    0x38, 0x14, 0x7f, 0xbb, 0x9d, 0xbd, 0xf8, 0x0a, 0xcc, 0x3c, 0x62, 0x0a, 0xa9, 0x4d, 0x6d, 0x74,
+    0x66, 0xea, 0x2a, 0x96, 0x2e, 0xfd, 0xc9, 0x9f, 0xe3, 0x57, 0xb4, 0x5e, 0x93, 0x96, 0x25, 0xf8,
+    0x78, 0x89, 0x10, 0x75, 0x82, 0x9b, 0xf2, 0xeb, 0x16, 0xfd, 0xd7, 0x91, 0xc7, 0x47, 0xfa, 0xfe,
+    0x2b, 0x8e, 0xac, 0xbf, 0x9b, 0x55, 0xfd, 0x43, 0xa6, 0xcc, 0x8f, 0x1d, 0x1a, 0x15, 0x5d, 0xf6,
+    0xf8, 0xce, 0x54, 0x93, 0xbc, 0xbe, 0x7c, 0x61, 0x01, 0x28, 0xbf, 0x61, 0xaf, 0x46, 0x1f, 0x40,
+    0x5e, 0x78, 0x0b, 0x2a, 0x19, 0xac, 0xbb, 0x6a, 0x85, 0xf3, 0xd4, 0x65, 0xf2, 0xd5, 0x3c, 0xa4,
+    0xfb, 0x53, 0xef, 0x3e, 0x14, 0xa2, 0x5e, 0xbc, 0x8d, 0x4f, 0x8a, 0x7b, 0xd5, 0xb7, 0x33, 0x34,
+    0x79, 0xc0, 0xaa, 0x87, 0x9b, 0x76, 0x6b, 0xf1, 0x57, 0x4f, 0x15, 0x01, 0xeb, 0xaf, 0x73, 0xc9,
+    0x50, 0x9a, 0x32, 0x2c, 0xba, 0xd1, 0x15, 0xc3, 0x98, 0xcc, 0xcf, 0x76, 0xa9, 0x10, 0xb5, 0x43,
+    0xc8, 0x8e, 0xdd, 0x70, 0xb8, 0xea, 0xe8, 0x93, 0x1f, 0x7f, 0x24, 0xab, 0xb7, 0x71, 0xfb, 0x5a,
+    0xd7, 0x03, 0x5f, 0x39, 0x8d, 0xba, 0x1b, 0x81, 0xd5, 0xf4, 0x55, 0xf4, 0xfc, 0x3f, 0xb6, 0xc8,
+    0xbe, 0xa6, 0x43, 0x55, 0xfe, 0x59, 0x62, 0xfc, 0x33, 0x89, 0x41, 0x5b, 0xfd, 0x20, 0x71, 0xd0,
+    0x56, 0xff, 0xd4, 0xd3, 0xff, 0x01, 0xc0, 0xb5, 0x7a, 0x47, 0x03, 0x4a, 0x00, 0x00,
+};
+
+#endif // WEB_ASSETS_H
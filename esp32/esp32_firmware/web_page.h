@@ -0,0 +1,543 @@
+#ifndef WEB_PAGE_H
+#define WEB_PAGE_H
+
+// Source of the web UI. Not compiled into the firmware: after editing,
+// regenerate web_assets.h, which holds it gzip-compressed, from the repo root:
+//   python esp32/tools/embed_assets.py esp32/esp32_firmware/web_assets.h \
+//       esp32/esp32_firmware/web_page.h:HTML_PAGE
+const char HTML_PAGE[] = R"rawliteral(
+<!DOCTYPE html>
+<html>
+<head>
+    <meta charset="UTF-8">
+    <meta name="viewport" content="width=device-width, initial-scale=1.0">
+    <title>Spherical Robot - E-Paper Control</title>
+    <style>
+        * { margin: 0; padding: 0; box-sizing: border-box; }
+        body {
+            font-family: -apple-system, BlinkMacSystemFont, 'Segoe UI', Roboto, sans-serif;
+            background: #1a1a2e;
+            color: #fff;
+            padding: 20px;
+            max-width: 600px;
+            margin: 0 auto;
+        }
+        h1 {
+            text-align: center;
+            color: #00d4ff;
+            margin-bottom: 30px;
+            font-size: 24px;
+        }
+        .card {
+            background: #16213e;
+            border-radius: 10px;
+            padding: 20px;
+            margin-bottom: 20px;
+            border: 1px solid #0f3460;
+        }
+        h2 {
+            color: #e94560;
+            margin-bottom: 15px;
+            font-size: 18px;
+        }
+        .upload-area {
+            border: 2px dashed #0f3460;
+            border-radius: 10px;
+            padding: 40px;
+            text-align: center;
+            cursor: pointer;
+            transition: all 0.3s;
+            margin-bottom: 15px;
+        }
+        .upload-area:hover {
+            border-color: #00d4ff;
+            background: rgba(0, 212, 255, 0.05);
+        }
+        .upload-area.dragover {
+            border-color: #00d4ff;
+            background: rgba(0, 212, 255, 0.1);
+        }
+        .upload-icon {
+            font-size: 48px;
+            margin-bottom: 10px;
+        }
+        .upload-text {
+            color: #888;
+            font-size: 14px;
+        }
+        input[type="file"] {
+            display: none;
+        }
+        .btn {
+            background: #0f3460;
+            color: #fff;
+            border: none;
+            padding: 12px 24px;
+            border-radius: 5px;
+            cursor: pointer;
+            font-size: 14px;
+            width: 100%;
+            transition: background 0.3s;
+        }
+        .btn:hover {
+            background: #1a5490;
+        }
+        .btn:disabled {
+            background: #333;
+            cursor: not-allowed;
+        }
+        .btn-primary {
+            background: #00d4ff;
+            color: #000;
+        }
+        .btn-primary:hover {
+            background: #33ddff;
+        }
+        .btn-danger {
+            background: #e94560;
+        }
+        .btn-danger:hover {
+            background: #ff6b6b;
+        }
+        .status {
+            padding: 10px;
+            border-radius: 5px;
+            margin-top: 10px;
+            font-size: 14px;
+            display: none;
+        }
+        .status.success {
+            display: block;
+            background: rgba(46, 204, 113, 0.2);
+            color: #2ecc71;
+        }
+        .status.error {
+            display: block;
+            background: rgba(231, 76, 60, 0.2);
+            color: #e74c3c;
+        }
+        .status.uploading {
+            display: block;
+            background: rgba(0, 212, 255, 0.2);
+            color: #00d4ff;
+        }
+        .preview {
+            max-width: 100%;
+            border-radius: 5px;
+            margin-top: 15px;
+            display: none;
+        }
+        .info {
+            background: rgba(0, 212, 255, 0.1);
+            border-left: 3px solid #00d4ff;
+            padding: 10px;
+            margin-top: 15px;
+            font-size: 12px;
+            color: #888;
+        }
+        .joystick {
+            position: relative;
+            width: 200px;
+            height: 200px;
+            margin: 15px auto;
+            border-radius: 50%;
+            background: #0f3460;
+            touch-action: none;
+        }
+        .joystick-knob {
+            position: absolute;
+            left: 65px;
+            top: 65px;
+            width: 70px;
+            height: 70px;
+            border-radius: 50%;
+            background: #00d4ff;
+            pointer-events: none;
+        }
+        .motor-btn {
+            width: 100%;
+            padding: 20px;
+            font-size: 24px;
+            background: #0f3460;
+            border: none;
+            border-radius: 5px;
+            cursor: pointer;
+            color: #fff;
+        }
+        .motor-btn:hover {
+            background: #1a5490;
+        }
+        .motor-btn.stop {
+            background: #e94560;
+        }
+        .motor-btn.stop:hover {
+            background: #ff6b6b;
+        }
+    </style>
+</head>
+<body>
+    <h1>🤖 Spherical Robot Control</h1>
+    
+    <div class="card">
+        <h2>📷 Image Upload</h2>
+        <div class="upload-area" id="uploadArea" onclick="document.getElementById('fileInput').click()">
+            <div class="upload-icon">📁</div>
+            <div class="upload-text">
+                Click or drag image here<br>
+                <small>Supports JPG, PNG, BMP (will be converted to 400x300 B&W)</small>
+            </div>
+        </div>
+        <input type="file" id="fileInput" accept="image/*" onchange="handleFileSelect(event)">
+        <img id="preview" class="preview">
+        <button class="btn btn-primary" id="uploadBtn" onclick="uploadImage()" disabled>📤 Upload to Display</button>
+        <button class="btn btn-danger" onclick="clearDisplay()">🗑 Clear Display</button>
+        <div id="status" class="status"></div>
+        <div class="info">
+            <strong>Tip:</strong> Images will be automatically resized to 400x300 and converted to black & white using Floyd-Steinberg dithering for best results on E-Paper display.
+        </div>
+    </div>
+    
+    <div class="card">
+        <h2>🖼 Frame Buffer</h2>
+        <img id="framePreview" class="preview" style="display: block; background: #fff" alt="Frame buffer">
+        <button class="btn btn-primary" onclick="refreshPreview()">🔄 Refresh</button>
+    </div>
+    
+    <div class="card">
+        <h2>🎮 Motor Control</h2>
+        <div class="joystick" id="joystick"><div class="joystick-knob" id="joystickKnob"></div></div>
+        <button class="motor-btn stop" onclick="stopMotors()">⏹ Stop</button>
+        <div class="info" id="motorLink">Motor link: connecting...</div>
+    </div>
+    
+    <div class="card">
+        <h2>📊 Live Status</h2>
+        <div class="info" id="telemetry" style="white-space: pre-line">Waiting for telemetry...</div>
+    </div>
+    
+    <script>
+        let selectedFile = null;
+        let canvas = document.createElement('canvas');
+        let ctx = canvas.getContext('2d');
+        
+        // Drag and drop
+        const uploadArea = document.getElementById('uploadArea');
+        
+        uploadArea.addEventListener('dragover', (e) => {
+            e.preventDefault();
+            uploadArea.classList.add('dragover');
+        });
+        
+        uploadArea.addEventListener('dragleave', () => {
+            uploadArea.classList.remove('dragover');
+        });
+        
+        uploadArea.addEventListener('drop', (e) => {
+            e.preventDefault();
+            uploadArea.classList.remove('dragover');
+            const files = e.dataTransfer.files;
+            if (files.length > 0) {
+                handleFile(files[0]);
+            }
+        });
+        
+        function handleFileSelect(event) {
+            const file = event.target.files[0];
+            if (file) {
+                handleFile(file);
+            }
+        }
+        
+        function handleFile(file) {
+            selectedFile = file;
+            
+            // Show preview
+            const reader = new FileReader();
+            reader.onload = (e) => {
+                const img = new Image();
+                img.onload = () => {
+                    document.getElementById('preview').src = e.target.result;
+                    document.getElementById('preview').style.display = 'block';
+                    document.getElementById('uploadBtn').disabled = false;
+                };
+                img.src = e.target.result;
+            };
+            reader.readAsDataURL(file);
+            
+            showStatus('Image selected: ' + file.name, 'uploading');
+        }
+        
+        function uploadImage() {
+            if (!selectedFile) return;
+            
+            const statusEl = document.getElementById('status');
+            statusEl.className = 'status uploading';
+            statusEl.textContent = 'Processing image...';
+            statusEl.style.display = 'block';
+            
+            const reader = new FileReader();
+            reader.onload = (e) => {
+                const img = new Image();
+                img.onload = () => {
+                    // Process image
+                    processAndUpload(img);
+                };
+                img.src = e.target.result;
+            };
+            reader.readAsDataURL(selectedFile);
+        }
+        
+        function processAndUpload(img) {
+            // Resize to 400x300
+            canvas.width = 400;
+            canvas.height = 300;
+            
+            // Draw and resize
+            ctx.drawImage(img, 0, 0, 400, 300);
+            
+            // Get image data
+            const imageData = ctx.getImageData(0, 0, 400, 300);
+            const data = imageData.data;
+            
+            // Convert to 1-bit with Floyd-Steinberg dithering
+            const binaryData = floydSteinbergDither(data, 400, 300);
+            
+            // Upload to server - send raw binary data
+            fetch('/upload', {
+                method: 'POST',
+                headers: {
+                    'Content-Type': 'application/octet-stream',
+                    'X-Image-CRC': crc16(binaryData).toString(16).padStart(4, '0')
+                },
+                body: binaryData
+            })
+            .then(response => response.text())
+            .then(result => {
+                showStatus('✓ ' + result, 'success');
+                refreshPreview();
+            })
+            .catch(error => {
+                showStatus('✗ Error: ' + error.message, 'error');
+            });
+        }
+        
+        // CRC-CCITT (0x1021, initial 0xFFFF), as checked by the firmware
+        function crc16(bytes) {
+            let crc = 0xFFFF;
+            for (let i = 0; i < bytes.length; i++) {
+                crc ^= bytes[i] << 8;
+                for (let j = 0; j < 8; j++) {
+                    crc = (crc & 0x8000) ? ((crc << 1) ^ 0x1021) & 0xFFFF : (crc << 1) & 0xFFFF;
+                }
+            }
+            return crc;
+        }
+        
+        function floydSteinbergDither(data, width, height) {
+            // Convert to grayscale first
+            const gray = new Float32Array(width * height);
+            for (let i = 0; i < width * height; i++) {
+                const r = data[i * 4];
+                const g = data[i * 4 + 1];
+                const b = data[i * 4 + 2];
+                gray[i] = r * 0.299 + g * 0.587 + b * 0.114;
+            }
+            
+            // Apply Floyd-Steinberg dithering
+            for (let y = 0; y < height; y++) {
+                for (let x = 0; x < width; x++) {
+                    const idx = y * width + x;
+                    const oldPixel = gray[idx];
+                    const newPixel = oldPixel < 128 ? 0 : 255;
+                    const error = oldPixel - newPixel;
+                    gray[idx] = newPixel;
+                    
+                    // Distribute error
+                    if (x + 1 < width) {
+                        gray[idx + 1] += error * 7 / 16;
+                    }
+                    if (x - 1 >= 0 && y + 1 < height) {
+                        gray[idx + width - 1] += error * 3 / 16;
+                    }
+                    if (y + 1 < height) {
+                        gray[idx + width] += error * 5 / 16;
+                    }
+                    if (x + 1 < width && y + 1 < height) {
+                        gray[idx + width + 1] += error * 1 / 16;
+                    }
+                }
+            }
+            
+            // Pack into bytes (1 bit per pixel, 0=black, 1=white)
+            const packed = new Uint8Array(width * height / 8);
+            for (let i = 0; i < width * height; i++) {
+                const byteIdx = Math.floor(i / 8);
+                const bitIdx = 7 - (i % 8);
+                if (gray[i] < 128) {
+                    packed[byteIdx] &= ~(1 << bitIdx);
+                } else {
+                    packed[byteIdx] |= (1 << bitIdx);
+                }
+            }
+            
+            return packed;
+        }
+        
+        function clearDisplay() {
+            fetch('/clear', {method: 'POST'})
+            .then(response => response.text())
+            .then(result => {
+                showStatus('✓ ' + result, 'success');
+                document.getElementById('preview').style.display = 'none';
+                document.getElementById('uploadBtn').disabled = true;
+                selectedFile = null;
+            })
+            .catch(error => {
+                showStatus('✗ Error: ' + error.message, 'error');
+            });
+        }
+        
+        // Joystick: while the pad is held, (left, right, lease) frames go
+        // out over /ws/motor at JOY_RATE_HZ. Each frame renews a short
+        // lease, so letting go, closing the tab or losing WiFi stops the
+        // robot within JOY_LEASE_MS.
+        const JOY_RATE_HZ = 40;
+        const JOY_LEASE_MS = 250;
+        const joystick = document.getElementById('joystick');
+        const joystickKnob = document.getElementById('joystickKnob');
+        let motorSocket = null;
+        let joyX = 0, joyY = 0;
+        let joyTimer = null;
+        
+        function connectMotorSocket() {
+            const socket = new WebSocket('ws://' + location.host + '/ws/motor');
+            socket.binaryType = 'arraybuffer';
+            socket.onopen = () => {
+                motorSocket = socket;
+                document.getElementById('motorLink').textContent = 'Motor link: connected';
+            };
+            socket.onclose = () => {
+                motorSocket = null;
+                document.getElementById('motorLink').textContent = 'Motor link: reconnecting...';
+                setTimeout(connectMotorSocket, 1000);
+            };
+        }
+        
+        function sendMotorFrame(left, right, leaseMs) {
+            if (!motorSocket) return;
+            // A stale frame is worse than a skipped one: never queue behind a slow link
+            if (motorSocket.bufferedAmount > 0 && leaseMs > 0) return;
+            const frame = new DataView(new ArrayBuffer(6));
+            frame.setInt16(0, left, true);
+            frame.setInt16(2, right, true);
+            frame.setUint16(4, leaseMs, true);
+            motorSocket.send(frame.buffer);
+        }
+        
+        // Arcade mix: up/down drives, left/right turns
+        function sendJoystick() {
+            const clamp = (v) => Math.max(-255, Math.min(255, Math.round(v * 255)));
+            sendMotorFrame(clamp(joyY + joyX), clamp(joyY - joyX), JOY_LEASE_MS);
+        }
+        
+        function moveJoystick(e) {
+            const rect = joystick.getBoundingClientRect();
+            const radius = rect.width / 2;
+            let dx = (e.clientX - rect.left - radius) / radius;
+            let dy = (e.clientY - rect.top - radius) / radius;
+            const dist = Math.hypot(dx, dy);
+            if (dist > 1) {
+                dx /= dist;
+                dy /= dist;
+            }
+            joyX = dx;
+            joyY = -dy;
+            const knob = joystickKnob.offsetWidth / 2;
+            joystickKnob.style.left = (radius + dx * (radius - knob) - knob) + 'px';
+            joystickKnob.style.top = (radius + dy * (radius - knob) - knob) + 'px';
+        }
+        
+        function releaseJoystick() {
+            clearInterval(joyTimer);
+            joyTimer = null;
+            joyX = joyY = 0;
+            joystickKnob.style.left = joystickKnob.style.top = '';
+            sendMotorFrame(0, 0, 0);
+        }
+        
+        joystick.addEventListener('pointerdown', (e) => {
+            joystick.setPointerCapture(e.pointerId);
+            moveJoystick(e);
+            sendJoystick();
+            joyTimer = setInterval(sendJoystick, 1000 / JOY_RATE_HZ);
+        });
+        joystick.addEventListener('pointermove', (e) => {
+            if (joyTimer) moveJoystick(e);
+        });
+        joystick.addEventListener('pointerup', releaseJoystick);
+        joystick.addEventListener('pointercancel', releaseJoystick);
+        
+        function stopMotors() {
+            releaseJoystick();
+            fetch('/motor?cmd=stop', {method: 'POST'})
+            .catch(error => {
+                console.error('Motor error:', error);
+            });
+        }
+        
+        connectMotorSocket();
+        
+        // Robot state pushed by the firmware; 2 Hz is plenty for reading
+        function connectTelemetry() {
+            const socket = new WebSocket('ws://' + location.host + '/ws/telemetry?hz=2');
+            socket.onmessage = (e) => {
+                const t = JSON.parse(e.data);
+                const display = t.display.busy
+                    ? t.display.op + (t.display.progress !== null ? ' ' + t.display.progress + '%' : '')
+                    : 'idle, last refresh ' + t.display.last_refresh_ms + ' ms';
+                document.getElementById('telemetry').textContent =
+                    'Motors: ' + t.motor.left + ' / ' + t.motor.right + (t.motor.running ? ' (running)' : '') + '\n' +
+                    'Battery: ' + (t.battery_mv !== null ? (t.battery_mv / 1000).toFixed(2) + ' V' : 'n/a') + '\n' +
+                    'Display: ' + display + '\n' +
+                    'Link (' + t.link.transport + '): ' + t.link.frames + ' frames, ' + t.link.errors + ' errors';
+            };
+            socket.onclose = () => setTimeout(connectTelemetry, 2000);
+        }
+        
+        connectTelemetry();
+        
+        // The frame buffer as the firmware holds it. An unchanged frame
+        // revalidates to a 304 and reuses the cached image.
+        function refreshPreview() {
+            fetch('/preview', {cache: 'no-cache'})
+            .then(response => response.blob())
+            .then(blob => {
+                const img = document.getElementById('framePreview');
+                if (img.src) URL.revokeObjectURL(img.src);
+                img.src = URL.createObjectURL(blob);
+            })
+            .catch(error => {
+                console.error('Preview error:', error);
+            });
+        }
+        
+        refreshPreview();
+        
+        function showStatus(message, type) {
+            const statusEl = document.getElementById('status');
+            statusEl.className = 'status ' + type;
+            statusEl.textContent = message;
+            statusEl.style.display = 'block';
+            
+            if (type === 'success' || type === 'error') {
+                setTimeout(() => {
+                    statusEl.style.display = 'none';
+                }, 5000);
+            }
+        }
+    </script>
+</body>
+</html>
+)rawliteral";
+
+#endif // WEB_PAGE_H
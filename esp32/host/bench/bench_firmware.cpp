@@ -0,0 +1,66 @@
+/*
+ * Benchmarks of the firmware's serial hot paths, run on the firmware's own
+ * code: esp32_firmware.ino as the host simulator builds it, with no tasks
+ * started and the serial output discarded. See esp32/README.md, "Host
+ * Benchmarks".
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <benchmark/benchmark.h>
+
+#include "bench_frames.h"
+#include "sim.h"
+
+// From esp32_firmware.ino
+uint16_t calculateCRC(const uint8_t* data, int length);
+void parseByte(char c);
+void logInit();
+
+// Nothing here restarts; ESP.restart() would mean a command went wrong
+void simRestart() {
+    fprintf(stderr, "bench: unexpected restart\n");
+    abort();
+}
+
+static void perByte(benchmark::State& state, size_t bytes) {
+    state.SetBytesProcessed((int64_t)(state.iterations() * bytes));
+    state.counters["per_byte"] = benchmark::Counter(
+        (double)bytes, benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+}
+
+// CRC-16/CCITT over a command payload: a MVEL-sized one and a full DIMG frame
+static void BM_CalculateCRC(benchmark::State& state) {
+    std::vector<uint8_t> frame = benchFrame();
+    int length = (int)state.range(0);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(calculateCRC(frame.data(), length));
+    }
+    perByte(state, length);
+}
+BENCHMARK(BM_CalculateCRC)->Arg(6)->Arg(64)->Arg(BENCH_FRAME_SIZE);
+
+// One <CMD><LEN>\n<DATA>\n<CRC>\n frame, with a valid CRC
+static std::string frameFor(const char* cmd, const uint8_t* data, size_t length) {
+    char header[32];
+    snprintf(header, sizeof(header), "%s%u\n", cmd, (unsigned)length);
+    char crc[8];
+    snprintf(crc, sizeof(crc), "%04X\n", calculateCRC(data, (int)length));
+    return header + std::string((const char*)data, length) + "\n" + crc;
+}
+
+// The frame parser byte by byte, through CRC check and dispatch to a
+// handler that answers: SPING frames carrying a payload of the given
+// size (0 as a bare command, 6 as MVEL's, a whole frame as DIMG's)
+static void BM_ParseFrame(benchmark::State& state) {
+    static bool logReady = (logInit(), true);
+    (void)logReady;
+    std::vector<uint8_t> payload = benchFrame();
+    std::string frame = frameFor("SPING", payload.data(), (size_t)state.range(0));
+    for (auto _ : state) {
+        for (char c : frame) parseByte(c);
+    }
+    perByte(state, frame.size());
+    state.counters["frames"] = benchmark::Counter(1, benchmark::Counter::kIsIterationInvariantRate);
+}
+BENCHMARK(BM_ParseFrame)->Arg(0)->Arg(6)->Arg(BENCH_FRAME_SIZE);
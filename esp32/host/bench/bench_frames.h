@@ -0,0 +1,74 @@
+#ifndef BENCH_FRAMES_H
+#define BENCH_FRAMES_H
+
+/*
+ * Realistic inputs for the firmware benchmarks: a 400x300 1-bit frame as
+ * the web portal sends it (a photo dithered down, with a block of solid
+ * black and solid white), and the upload encodings of it.
+ */
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#define BENCH_WIDTH       400
+#define BENCH_HEIGHT      300
+#define BENCH_FRAME_SIZE  (BENCH_WIDTH * BENCH_HEIGHT / 8)
+
+// MSB first, 1 = white: a diagonal gradient through a 4x4 Bayer matrix in
+// the top two thirds, a black band, and white below
+static inline std::vector<uint8_t> benchFrame() {
+    static const uint8_t bayer[4][4] = {{0, 8, 2, 10}, {12, 4, 14, 6}, {3, 11, 1, 9}, {15, 7, 13, 5}};
+    std::vector<uint8_t> frame(BENCH_FRAME_SIZE, 0xFF);
+    for (int y = 0; y < BENCH_HEIGHT; y++) {
+        for (int x = 0; x < BENCH_WIDTH; x++) {
+            bool white;
+            if (y < BENCH_HEIGHT * 2 / 3) {
+                int level = (x + y) * 16 / (BENCH_WIDTH + BENCH_HEIGHT * 2 / 3);
+                white = level > bayer[y % 4][x % 4];
+            } else {
+                white = y >= BENCH_HEIGHT * 5 / 6;
+            }
+            if (!white) frame[(y * BENCH_WIDTH + x) / 8] &= ~(0x80 >> (x % 8));
+        }
+    }
+    return frame;
+}
+
+// Nibble upload format: low nibble + 'a', then high nibble + 'a'
+static inline std::string benchNibbleEncode(const std::vector<uint8_t>& data) {
+    std::string text;
+    text.reserve(data.size() * 2);
+    for (uint8_t b : data) {
+        text += (char)('a' + (b & 0x0F));
+        text += (char)('a' + (b >> 4));
+    }
+    return text;
+}
+
+// PackBits as the portal's packBits() (legacy web_js.h) encodes it
+static inline std::vector<uint8_t> benchPackBits(const std::vector<uint8_t>& data) {
+    std::vector<uint8_t> out;
+    size_t i = 0;
+    while (i < data.size()) {
+        size_t run = 1;
+        while (i + run < data.size() && run < 128 && data[i + run] == data[i]) run++;
+        if (run >= 2) {
+            out.push_back((uint8_t)(257 - run));
+            out.push_back(data[i]);
+            i += run;
+            continue;
+        }
+        // Literal span, ended by a run of three or more
+        size_t start = i;
+        while (i < data.size() && i - start < 128 &&
+               !(i + 2 < data.size() && data[i] == data[i + 1] && data[i] == data[i + 2])) {
+            i++;
+        }
+        out.push_back((uint8_t)(i - start - 1));
+        out.insert(out.end(), data.begin() + start, data.begin() + i);
+    }
+    return out;
+}
+
+#endif // BENCH_FRAMES_H
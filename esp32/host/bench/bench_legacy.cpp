@@ -0,0 +1,98 @@
+/*
+ * Benchmarks of the legacy portal's upload decoding and drawing
+ * (legacy/EPaper_AP_Portal), built from its headers as they are. The
+ * portal is its own sketch with its own globals, so it goes in a
+ * namespace to share the binary with esp32_firmware.ino.
+ */
+
+#include <string.h>
+#include <benchmark/benchmark.h>
+
+#include "Arduino.h"
+#include "IPAddress.h"
+#include "bench_frames.h"
+
+// config.h and log.h come in with them, from the portal's own directory
+namespace legacy {
+#include "image_buffer.h"
+#include "upload_decode.h"
+}
+
+using namespace legacy;
+
+// WebServer's HTTP_RAW_BUFLEN: the piece size upload bodies arrive in
+#define BENCH_HTTP_PIECE 1436
+
+// A fresh append upload of the whole frame, as handleApiUploadBody starts one
+static void uploadBegin(UploadFormat format) {
+    ImageBuffer_Clear();
+    memset(&upload, 0, sizeof(upload));
+    upload.format = format;
+    upload.crc = 0xFFFF;
+    upload.lowNibble = -1;
+}
+
+static void uploadBody(const uint8_t* body, size_t length, void (*decode)(const uint8_t*, size_t)) {
+    for (size_t at = 0; at < length; at += BENCH_HTTP_PIECE) {
+        decode(body + at, std::min((size_t)BENCH_HTTP_PIECE, length - at));
+    }
+}
+
+// Nibble format (decodeNibble per character): ns per body byte
+static void BM_UploadDecodeNibbles(benchmark::State& state) {
+    std::string body = benchNibbleEncode(benchFrame());
+    for (auto _ : state) {
+        uploadBegin(UPLOAD_NIBBLE);
+        uploadBody((const uint8_t*)body.data(), body.size(), uploadDecodeNibbles);
+        benchmark::DoNotOptimize(upload.crc);
+    }
+    if (upload.received != IMAGE_BUFFER_SIZE) state.SkipWithError("frame not decoded");
+    state.SetBytesProcessed((int64_t)(state.iterations() * body.size()));
+    state.counters["per_byte"] = benchmark::Counter(
+        (double)body.size(), benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+}
+BENCHMARK(BM_UploadDecodeNibbles);
+
+static void BM_UploadDecodePackBits(benchmark::State& state) {
+    std::vector<uint8_t> body = benchPackBits(benchFrame());
+    for (auto _ : state) {
+        uploadBegin(UPLOAD_PACKBITS);
+        uploadBody(body.data(), body.size(), uploadDecodePackBits);
+        benchmark::DoNotOptimize(upload.crc);
+    }
+    if (upload.received != IMAGE_BUFFER_SIZE) state.SkipWithError("frame not decoded");
+    state.SetBytesProcessed((int64_t)(state.iterations() * body.size()));
+    state.counters["per_byte"] = benchmark::Counter(
+        (double)body.size(), benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+}
+BENCHMARK(BM_UploadDecodePackBits);
+
+static void perPixel(benchmark::State& state, size_t pixels) {
+    state.counters["pixels"] = benchmark::Counter((double)pixels, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// Every pixel of the frame drawn once, in row order
+static void BM_ImageBufferSetPixel(benchmark::State& state) {
+    std::vector<uint8_t> frame = benchFrame();
+    for (auto _ : state) {
+        for (uint16_t y = 0; y < EPD_HEIGHT; y++) {
+            for (uint16_t x = 0; x < EPD_WIDTH; x++) {
+                bool white = frame[(y * EPD_WIDTH + x) / 8] & (0x80 >> (x % 8));
+                ImageBuffer_SetPixel(x, y, white);
+            }
+        }
+        benchmark::ClobberMemory();
+    }
+    if (memcmp(imageBuffer, frame.data(), IMAGE_BUFFER_SIZE) != 0) state.SkipWithError("frame mismatch");
+    perPixel(state, EPD_WIDTH * EPD_HEIGHT);
+}
+BENCHMARK(BM_ImageBufferSetPixel);
+
+static void BM_ImageBufferTestPattern(benchmark::State& state) {
+    for (auto _ : state) {
+        ImageBuffer_TestPattern();
+        benchmark::ClobberMemory();
+    }
+    perPixel(state, EPD_WIDTH * EPD_HEIGHT);
+}
+BENCHMARK(BM_ImageBufferTestPattern);
@@ -0,0 +1,99 @@
+#ifndef LOADGEN_FRAME_CODEC_H
+#define LOADGEN_FRAME_CODEC_H
+
+/*
+ * The serial protocol from the host side (esp32/README.md, "Protocol
+ * Format" and "Response Format"):
+ *   command:  <CMD><LEN>\n<DATA>\n<CRC>\n
+ *   response: <STATUS><LEN>\n<MESSAGE>\n     STATUS = OK, ERR or PENDING
+ *   log:      LOG<LEN>\n<L> <ms> <text>\n
+ */
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+// CRC-16/CCITT as the firmware's calculateCRC(): polynomial 0x1021, initial 0xFFFF
+static inline uint16_t frameCrc(const uint8_t* data, size_t length) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = crc & 0x8000 ? (uint16_t)((crc << 1) ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+static inline std::vector<uint8_t> encodeFrame(const std::string& cmd, const std::vector<uint8_t>& data) {
+    char header[32];
+    int headerLength = snprintf(header, sizeof(header), "%s%u\n", cmd.c_str(), (unsigned)data.size());
+    char crc[8];
+    snprintf(crc, sizeof(crc), "\n%04X\n", frameCrc(data.data(), data.size()));
+    std::vector<uint8_t> frame(header, header + headerLength);
+    frame.insert(frame.end(), data.begin(), data.end());
+    frame.insert(frame.end(), crc, crc + 6);
+    return frame;
+}
+
+struct FrameEvent {
+    enum Kind { RESPONSE, LOG, STRAY } kind;
+    std::string status;   // RESPONSE: OK, ERR or PENDING
+    std::string text;     // The message, the log line, or the stray line
+};
+
+// Splits the bytes from the board into frames. A line that starts neither
+// a response nor a log (boot ROM output, line noise) comes back as STRAY.
+class FrameReader {
+public:
+    void feed(const uint8_t* data, size_t length, std::vector<FrameEvent>& events) {
+        for (size_t i = 0; i < length; i++) {
+            char c = (char)data[i];
+            if (_bodyLeft > 0) {
+                // Message bytes, then the newline that ends the frame
+                if (--_bodyLeft > 0) {
+                    _frame.text += c;
+                } else {
+                    events.push_back(_frame);
+                }
+                continue;
+            }
+            if (c != '\n') {
+                _line += c;
+                continue;
+            }
+            startFrame(events);
+            _line.clear();
+        }
+    }
+
+private:
+    // A status or LOG line: the body (length + newline) follows
+    void startFrame(std::vector<FrameEvent>& events) {
+        static const char* const tags[] = {"OK", "ERR", "PENDING", "LOG"};
+        if (!_line.empty() && _line.back() == '\r') _line.pop_back();
+        for (const char* tag : tags) {
+            size_t tagLength = strlen(tag);
+            if (_line.compare(0, tagLength, tag) != 0 || _line.size() == tagLength) continue;
+            const char* digits = _line.c_str() + tagLength;
+            bool numeric = true;
+            for (const char* p = digits; *p; p++) numeric = numeric && isdigit((unsigned char)*p);
+            if (!numeric) continue;
+            bool log = strcmp(tag, "LOG") == 0;
+            _frame = FrameEvent{log ? FrameEvent::LOG : FrameEvent::RESPONSE, log ? "" : tag, ""};
+            _bodyLeft = strtol(digits, nullptr, 10) + 1;
+            return;
+        }
+        if (!_line.empty()) events.push_back(FrameEvent{FrameEvent::STRAY, "", _line});
+    }
+
+    std::string _line;
+    FrameEvent _frame;
+    long _bodyLeft = 0;   // Message bytes plus the final newline still to come
+};
+
+#endif // LOADGEN_FRAME_CODEC_H
@@ -0,0 +1,246 @@
+/*
+ * serial_loadgen results: percentiles, the JSON file and run comparison
+ */
+
+#include <ctype.h>
+#include <errno.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+
+#include "report.h"
+
+LatencySummary summarize(std::vector<double>& samples) {
+    LatencySummary s = {samples.size(), 0, 0, 0, 0, 0, 0};
+    if (samples.empty()) return s;
+    std::sort(samples.begin(), samples.end());
+    double sum = 0;
+    for (double v : samples) sum += v;
+    auto rank = [&samples](double q) {
+        size_t i = (size_t)ceil(q * samples.size());
+        return samples[i ? i - 1 : 0];
+    };
+    s.mean = sum / samples.size();
+    s.p50 = rank(0.50);
+    s.p90 = rank(0.90);
+    s.p99 = rank(0.99);
+    s.p999 = rank(0.999);
+    s.max = samples.back();
+    return s;
+}
+
+void Report::addLatency(const std::string& prefix, const LatencySummary& latency) {
+    add(prefix + ".latency_mean_us", latency.mean);
+    add(prefix + ".latency_p50_us", latency.p50);
+    add(prefix + ".latency_p90_us", latency.p90);
+    add(prefix + ".latency_p99_us", latency.p99);
+    add(prefix + ".latency_p999_us", latency.p999);
+    add(prefix + ".latency_max_us", latency.max);
+}
+
+const double* Report::metric(const std::string& key) const {
+    for (const auto& m : metrics) {
+        if (m.first == key) return &m.second;
+    }
+    return nullptr;
+}
+
+const std::string* Report::field(const std::string& key) const {
+    for (const auto& f : info) {
+        if (f.first == key) return &f.second;
+    }
+    return nullptr;
+}
+
+// ---- JSON ----
+static std::string jsonString(const std::string& s) {
+    std::string out = "\"";
+    for (char c : s) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if ((unsigned char)c < 0x20) {
+            char escape[8];
+            snprintf(escape, sizeof(escape), "\\u%04x", (unsigned char)c);
+            out += escape;
+        } else {
+            out += c;
+        }
+    }
+    return out + "\"";
+}
+
+bool reportWrite(const Report& report, const char* path, std::string& error) {
+    FILE* f = fopen(path, "w");
+    if (!f) {
+        error = std::string(path) + ": " + strerror(errno);
+        return false;
+    }
+    fprintf(f, "{\"info\": {");
+    for (size_t i = 0; i < report.info.size(); i++) {
+        fprintf(f, "%s\n  %s: %s", i ? "," : "", jsonString(report.info[i].first).c_str(),
+                jsonString(report.info[i].second).c_str());
+    }
+    fprintf(f, "\n}, \"metrics\": {");
+    for (size_t i = 0; i < report.metrics.size(); i++) {
+        fprintf(f, "%s\n  %s: %.17g", i ? "," : "", jsonString(report.metrics[i].first).c_str(),
+                report.metrics[i].second);
+    }
+    fprintf(f, "\n}}\n");
+    bool ok = fclose(f) == 0;
+    if (!ok) error = std::string(path) + ": " + strerror(errno);
+    return ok;
+}
+
+// Reads the two-level object reportWrite() produces: strings go to info,
+// numbers to metrics, nested keys joined with '.'
+class JsonReader {
+public:
+    JsonReader(const std::string& text, Report& report) : _text(text), _report(report) {}
+
+    bool parse(std::string& error) {
+        if (!object("", true) || (skipSpace(), _at != _text.size())) {
+            error = "invalid JSON at offset " + std::to_string(_at);
+            return false;
+        }
+        return true;
+    }
+
+private:
+    void skipSpace() {
+        while (_at < _text.size() && isspace((unsigned char)_text[_at])) _at++;
+    }
+
+    bool consume(char c) {
+        skipSpace();
+        if (_at >= _text.size() || _text[_at] != c) return false;
+        _at++;
+        return true;
+    }
+
+    bool string(std::string& out) {
+        if (!consume('"')) return false;
+        out.clear();
+        while (_at < _text.size() && _text[_at] != '"') {
+            char c = _text[_at++];
+            if (c != '\\') {
+                out += c;
+                continue;
+            }
+            if (_at >= _text.size()) return false;
+            c = _text[_at++];
+            if (c == 'u') {
+                if (_at + 4 > _text.size()) return false;
+                out += (char)strtol(_text.substr(_at, 4).c_str(), nullptr, 16);
+                _at += 4;
+            } else {
+                out += c == 'n' ? '\n' : c == 't' ? '\t' : c;
+            }
+        }
+        return consume('"');
+    }
+
+    bool object(const std::string& prefix, bool top) {
+        if (!consume('{')) return false;
+        if (consume('}')) return true;
+        do {
+            std::string key;
+            if (!string(key) || !consume(':')) return false;
+            // The top-level "info" and "metrics" only say where a value goes
+            std::string name = prefix.empty() ? key : prefix + "." + key;
+            skipSpace();
+            if (_at >= _text.size()) return false;
+            if (_text[_at] == '{') {
+                if (!object(top ? "" : name, false)) return false;
+            } else if (_text[_at] == '"') {
+                std::string value;
+                if (!string(value)) return false;
+                _report.set(name, value);
+            } else {
+                char* end;
+                double value = strtod(_text.c_str() + _at, &end);
+                if (end == _text.c_str() + _at) return false;
+                _at = end - _text.c_str();
+                _report.add(name, value);
+            }
+        } while (consume(','));
+        return consume('}');
+    }
+
+    const std::string& _text;
+    Report& _report;
+    size_t _at = 0;
+};
+
+bool reportRead(Report& report, const char* path, std::string& error) {
+    FILE* f = fopen(path, "r");
+    if (!f) {
+        error = std::string(path) + ": " + strerror(errno);
+        return false;
+    }
+    std::string text;
+    char chunk[4096];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) text.append(chunk, n);
+    fclose(f);
+    JsonReader reader(text, report);
+    if (!reader.parse(error)) {
+        error = std::string(path) + ": " + error;
+        return false;
+    }
+    return true;
+}
+
+// ---- Comparison ----
+static bool endsWith(const std::string& s, const char* suffix) {
+    size_t n = strlen(suffix);
+    return s.size() >= n && s.compare(s.size() - n, n, suffix) == 0;
+}
+
+// -1: lower is better, 1: higher is better, 0: neither (counts of work done)
+static int metricDirection(const std::string& key) {
+    static const char* const worse[] = {".err", ".timeout", ".shed", ".accepted", ".silent", ".extra",
+                                        ".unsynced", ".stray"};
+    if (key.find(".latency_") != std::string::npos || key.find(".recovery_") != std::string::npos) return -1;
+    for (const char* suffix : worse) {
+        if (endsWith(key, suffix)) return -1;
+    }
+    if (endsWith(key, "_per_s")) return 1;
+    return 0;
+}
+
+std::vector<std::string> reportCompare(const Report& base, const Report& run, double thresholdPercent) {
+    std::vector<std::string> regressions;
+    for (const char* key : {"label", "mode", "mix", "faults", "port"}) {
+        const std::string* a = base.field(key);
+        const std::string* b = run.field(key);
+        if (a || b) printf("%-8s %s -> %s\n", key, a ? a->c_str() : "-", b ? b->c_str() : "-");
+    }
+    printf("\n%-34s %12s %12s %9s\n", "Metric", "Base", "Run", "Change");
+    for (const auto& m : run.metrics) {
+        const double* before = base.metric(m.first);
+        if (!before) {
+            printf("%-34s %12s %12.1f %9s\n", m.first.c_str(), "-", m.second, "new");
+            continue;
+        }
+        int direction = metricDirection(m.first);
+        const char* flag = "";
+        char change[16] = "";
+        if (*before != 0) {
+            double percent = (m.second / *before - 1) * 100;
+            snprintf(change, sizeof(change), "%+.1f%%", percent);
+            if (direction && -direction * percent > thresholdPercent) flag = "  WORSE";
+        } else if (m.second != 0) {
+            snprintf(change, sizeof(change), "from 0");
+            if (direction < 0) flag = "  WORSE";
+        }
+        if (*flag) regressions.push_back(m.first);
+        printf("%-34s %12.1f %12.1f %9s%s\n", m.first.c_str(), *before, m.second, change, flag);
+    }
+    for (const auto& m : base.metrics) {
+        if (!run.metric(m.first)) printf("%-34s %12.1f %12s %9s\n", m.first.c_str(), m.second, "-", "gone");
+    }
+    return regressions;
+}
@@ -0,0 +1,45 @@
+#ifndef LOADGEN_REPORT_H
+#define LOADGEN_REPORT_H
+
+/*
+ * Results of a serial_loadgen run: flat named metrics plus descriptive
+ * fields, saved as JSON so two runs can be compared later.
+ *
+ *   {"info": {"mode": "open", ...}, "metrics": {"MVEL.latency_p99_us": 2350, ...}}
+ */
+
+#include <stdint.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct LatencySummary {
+    size_t count;
+    double mean, p50, p90, p99, p999, max;   // Microseconds
+};
+
+// Exact percentiles (nearest rank) of the samples; sorts them
+LatencySummary summarize(std::vector<double>& samples);
+
+struct Report {
+    std::vector<std::pair<std::string, std::string>> info;
+    std::vector<std::pair<std::string, double>> metrics;
+
+    void set(const std::string& key, const std::string& value) { info.emplace_back(key, value); }
+    void add(const std::string& key, double value) { metrics.emplace_back(key, value); }
+    // <prefix>.latency_{mean,p50,p90,p99,p999,max}_us
+    void addLatency(const std::string& prefix, const LatencySummary& latency);
+
+    const double* metric(const std::string& key) const;
+    const std::string* field(const std::string& key) const;
+};
+
+bool reportWrite(const Report& report, const char* path, std::string& error);
+bool reportRead(Report& report, const char* path, std::string& error);
+
+// Prints every metric of run next to base with the change. Returns the
+// metrics that got worse by more than thresholdPercent, in the direction
+// their name says is bad (latencies, errors and timeouts up, rates down).
+std::vector<std::string> reportCompare(const Report& base, const Report& run, double thresholdPercent);
+
+#endif // LOADGEN_REPORT_H
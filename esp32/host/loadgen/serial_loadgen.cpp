@@ -0,0 +1,765 @@
+/*
+ * Load generator for the serial protocol: drives a board or the host
+ * simulator over any tty with a mix of commands, open- or closed-loop,
+ * optionally corrupting frames, and reports per-command latency
+ * percentiles. See esp32/README.md, "Serial Load Generator".
+ *
+ *   serial_loadgen --port PATH [options]
+ *   serial_loadgen compare BASE.json RUN.json [--threshold PCT]
+ *
+ * Responses come back in command order, so each one answers the oldest
+ * command still waiting. Latency runs from when a command was due (its
+ * arrival time in open loop, its window slot in closed loop) to the last
+ * byte of its response, so a backed-up link shows up in it.
+ */
+
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "frame_codec.h"
+#include "report.h"
+#include "tty.h"
+
+#define DIMG_FRAME_SIZE      15000
+#define MAX_POLL_MS          100
+#define READ_CHUNK           4096
+#define RESYNC_ATTEMPTS      5
+#define SETTLE_MS            100     // Quiet after the pong before the load resumes
+
+using Clock = std::chrono::steady_clock;
+
+static int64_t nowUs() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now().time_since_epoch()).count();
+}
+
+static volatile sig_atomic_t interrupts = 0;
+
+static void onInterrupt(int) {
+    interrupts++;
+}
+
+struct Options {
+    const char* port = nullptr;
+    int baud = 0;
+    bool rtscts = false;
+    bool openLoop = false;
+    int window = 1;              // Closed loop: commands awaiting a response
+    double rate = 0;             // Open loop: commands per second
+    bool poisson = true;         // Open loop: exponential gaps, else fixed
+    size_t backlog = 64;         // Open loop: unsent commands before arrivals are shed
+    std::string mix = "SPING";
+    double durationS = 10;
+    uint64_t count = 0;          // Commands to send, 0 = until the duration ends
+    int timeoutMs = 2000;
+    std::string faults;
+    int faultWaitMs = 6000;      // Longer than the firmware's CMD_TIMEOUT_MS
+    uint32_t seed = 0;
+    bool seedSet = false;
+    int mvelSpeed = 0;
+    int mvelMs = 100;
+    const char* json = nullptr;
+    std::string label;
+};
+
+// One entry of --mix: NAME[/BYTES][:WEIGHT]
+struct CommandSpec {
+    std::string name;
+    double weight;
+    std::vector<uint8_t> frame;
+    uint64_t sent = 0, ok = 0, err = 0, timeout = 0, shed = 0;
+    std::vector<double> latencyUs;
+};
+
+enum FaultKind : uint8_t { FAULT_FLIP, FAULT_TRUNCATE, FAULT_DROP, FAULT_COUNT };
+static const char* const faultNames[] = {"flip", "truncate", "drop"};
+
+// Outcome of the frames corrupted one way: the first reply to each, and
+// how long until a probe SPING got its pong again
+struct FaultStats {
+    double probability = 0;
+    uint64_t injected = 0;
+    uint64_t rejected = 0;   // Answered ERR
+    uint64_t accepted = 0;   // Answered OK: the corruption got through
+    uint64_t silent = 0;     // No reply within --fault-wait
+    uint64_t extra = 0;      // Further replies before the link was back in step
+    uint64_t unsynced = 0;   // Probes ran out before a pong
+    std::vector<double> recoveryUs;
+};
+
+struct Request {
+    CommandSpec* spec;
+    int64_t dueUs;
+    int64_t sentUs;      // Last byte written, 0 while still queued
+    uint64_t endByte;    // Output offset just past the frame
+};
+
+static void usage(const char* argv0) {
+    fprintf(stderr,
+            "usage: %s --port PATH [--baud N] [--rtscts]\n"
+            "           [--closed [--window N] | --open --rate R [--arrival poisson|fixed] [--backlog N]]\n"
+            "           [--mix NAME[/BYTES][:WEIGHT],...] [--duration S] [--count N] [--timeout MS]\n"
+            "           [--faults flip:P,truncate:P,drop:P] [--fault-wait MS] [--seed N]\n"
+            "           [--mvel-speed N] [--mvel-ms MS] [--json PATH] [--label TEXT]\n"
+            "       %s compare BASE.json RUN.json [--threshold PCT]\n",
+            argv0, argv0);
+    exit(2);
+}
+
+static std::vector<uint8_t> randomBytes(std::mt19937& rng, size_t n) {
+    std::vector<uint8_t> bytes(n);
+    for (uint8_t& b : bytes) b = (uint8_t)rng();
+    return bytes;
+}
+
+// The payload a command gets unless --mix gives a size: MVEL's six bytes
+// (both wheels at --mvel-speed for --mvel-ms), a whole DIMG frame, else none
+static std::vector<uint8_t> defaultPayload(const Options& opt, const std::string& name, std::mt19937& rng) {
+    if (name == "MVEL") {
+        int16_t speed = (int16_t)opt.mvelSpeed;
+        uint16_t ms = (uint16_t)opt.mvelMs;
+        return {(uint8_t)speed, (uint8_t)(speed >> 8), (uint8_t)speed, (uint8_t)(speed >> 8),
+                (uint8_t)ms, (uint8_t)(ms >> 8)};
+    }
+    if (name == "DIMG") return randomBytes(rng, DIMG_FRAME_SIZE);
+    return {};
+}
+
+static bool parseMix(const Options& opt, std::mt19937& rng, std::vector<CommandSpec>& specs, std::string& error) {
+    size_t start = 0;
+    while (start <= opt.mix.size()) {
+        size_t end = opt.mix.find(',', start);
+        if (end == std::string::npos) end = opt.mix.size();
+        std::string entry = opt.mix.substr(start, end - start);
+        start = end + 1;
+        if (entry.empty()) continue;
+
+        double weight = 1;
+        size_t colon = entry.find(':');
+        if (colon != std::string::npos) {
+            weight = atof(entry.c_str() + colon + 1);
+            entry.resize(colon);
+        }
+        long bytes = -1;
+        size_t slash = entry.find('/');
+        if (slash != std::string::npos) {
+            bytes = atol(entry.c_str() + slash + 1);
+            entry.resize(slash);
+        }
+        if (entry.empty() || weight <= 0 || entry.size() > 15) {
+            error = "bad --mix entry";
+            return false;
+        }
+        if (entry == "SRESET" || entry == "SHALT") {
+            error = entry + " would restart or stop the board";
+            return false;
+        }
+        std::vector<uint8_t> payload = bytes >= 0 ? randomBytes(rng, bytes) : defaultPayload(opt, entry, rng);
+        CommandSpec spec;
+        spec.name = entry;
+        spec.weight = weight;
+        spec.frame = encodeFrame(entry, payload);
+        specs.push_back(std::move(spec));
+    }
+    if (specs.empty()) {
+        error = "empty --mix";
+        return false;
+    }
+    return true;
+}
+
+static bool parseFaults(const std::string& text, FaultStats* faults, std::string& error) {
+    size_t start = 0;
+    while (start < text.size()) {
+        size_t end = text.find(',', start);
+        if (end == std::string::npos) end = text.size();
+        std::string entry = text.substr(start, end - start);
+        start = end + 1;
+        size_t colon = entry.find(':');
+        std::string name = entry.substr(0, colon);
+        int kind = 0;
+        while (kind < FAULT_COUNT && name != faultNames[kind]) kind++;
+        double p = colon == std::string::npos ? -1 : atof(entry.c_str() + colon + 1);
+        if (kind == FAULT_COUNT || p < 0 || p > 1) {
+            error = "bad --faults entry '" + entry + "' (flip, truncate or drop, with a probability 0-1)";
+            return false;
+        }
+        faults[kind].probability = p;
+    }
+    return true;
+}
+
+static void corrupt(FaultKind kind, std::vector<uint8_t>& frame, std::mt19937& rng) {
+    size_t at = std::uniform_int_distribution<size_t>(0, frame.size() - 1)(rng);
+    switch (kind) {
+        case FAULT_FLIP:
+            frame[at] ^= (uint8_t)(1 << std::uniform_int_distribution<int>(0, 7)(rng));
+            break;
+        case FAULT_TRUNCATE:
+            frame.resize(std::max<size_t>(at, 1));
+            break;
+        case FAULT_DROP:
+            frame.erase(frame.begin() + at);
+            break;
+        default:
+            break;
+    }
+}
+
+// ---- The run ----
+class LoadRun {
+public:
+    LoadRun(const Options& opt, int fd, std::vector<CommandSpec>& specs, FaultStats* faults)
+        : _opt(opt), _fd(fd), _specs(specs), _faults(faults),
+          _rng(opt.seed), _gap(opt.rate > 0 ? opt.rate : 1) {
+        for (const CommandSpec& spec : specs) _totalWeight += spec.weight;
+    }
+
+    // Returns false if the port failed
+    bool run();
+
+    double elapsedS() const { return (_endUs - _startUs) / 1e6; }
+    double faultPauseS() const { return _faultPauseUs / 1e6; }
+    uint64_t txBytes() const { return _written; }
+    uint64_t rxBytes() const { return _rxBytes; }
+    uint64_t logs() const { return _logs; }
+    uint64_t stray() const { return _stray; }
+    const std::map<std::string, uint64_t>& errors() const { return _errors; }
+
+private:
+    // A fault waits for the commands in flight, sends the corrupted frame,
+    // waits for its reply, probes until a pong, then for the line to go quiet
+    enum Phase { RUNNING, FAULT_DRAIN, FAULT_WAIT, RESYNC, SETTLE };
+
+    CommandSpec& pickSpec() {
+        double pick = std::uniform_real_distribution<double>(0, _totalWeight)(_rng);
+        for (CommandSpec& spec : _specs) {
+            if ((pick -= spec.weight) < 0) return spec;
+        }
+        return _specs.back();
+    }
+
+    uint64_t enqueue(const std::vector<uint8_t>& bytes) {
+        _out.insert(_out.end(), bytes.begin(), bytes.end());
+        _queued += bytes.size();
+        return _queued;
+    }
+
+    size_t unsent() const {
+        size_t n = 0;
+        for (auto it = _inflight.rbegin(); it != _inflight.rend() && !it->sentUs; ++it) n++;
+        return n;
+    }
+
+    // Queues the next command due at dueUs, or holds it back as the next
+    // fault. Returns false once a fault is pending.
+    bool generate(int64_t dueUs) {
+        CommandSpec& spec = pickSpec();
+        _generated++;
+        for (int kind = 0; kind < FAULT_COUNT; kind++) {
+            if (_faults[kind].probability <= 0) continue;
+            if (std::uniform_real_distribution<double>(0, 1)(_rng) >= _faults[kind].probability) continue;
+            _faultKind = (FaultKind)kind;
+            _faultFrame = spec.frame;
+            corrupt(_faultKind, _faultFrame, _rng);
+            _faults[kind].injected++;
+            _phase = FAULT_DRAIN;
+            return false;
+        }
+        spec.sent++;
+        _inflight.push_back(Request{&spec, dueUs, 0, enqueue(spec.frame)});
+        return true;
+    }
+
+    // A newline ends a stray header line; the probe's pong says the
+    // firmware's parser is back at the start of a frame
+    void sendProbe() {
+        static const std::vector<uint8_t> probe = [] {
+            std::vector<uint8_t> bytes = {'\n'};
+            std::vector<uint8_t> ping = encodeFrame("SPING", {});
+            bytes.insert(bytes.end(), ping.begin(), ping.end());
+            return bytes;
+        }();
+        _probeEndByte = enqueue(probe);
+        _probeDeadlineUs = 0;
+        _probes++;
+    }
+
+    void endFault(int64_t now) {
+        _faultPauseUs += now - _faultStartUs;
+        _phase = RUNNING;
+        _nextDueUs = now;   // Arrivals missed during the fault are not made up
+    }
+
+    void onResponse(const FrameEvent& event, int64_t now) {
+        if (_phase == FAULT_WAIT) {
+            FaultStats& f = _faults[_faultKind];
+            if (event.status == "ERR") {
+                f.rejected++;
+            } else {
+                f.accepted++;
+            }
+            _phase = RESYNC;
+            _probes = 0;
+            sendProbe();
+            return;
+        }
+        if (_phase == RESYNC && event.status == "OK" && event.text == "pong") {
+            _faults[_faultKind].recoveryUs.push_back((double)(now - _faultStartUs));
+            _phase = SETTLE;
+            _settleUntilUs = now + SETTLE_MS * 1000;
+            return;
+        }
+        if (_phase == RESYNC || _phase == SETTLE) {
+            _faults[_faultKind].extra++;
+            if (_phase == SETTLE) {
+                _settleUntilUs = now + SETTLE_MS * 1000;
+            } else if (_written >= _probeEndByte && _probes < RESYNC_ATTEMPTS) {
+                sendProbe();   // The probe may have been what this answered
+            }
+            return;
+        }
+        if (_inflight.empty()) {
+            _stray++;   // After a timeout, or noise that parsed as a reply
+            return;
+        }
+        Request request = _inflight.front();
+        _inflight.pop_front();
+        CommandSpec& spec = *request.spec;
+        spec.latencyUs.push_back((double)(now - request.dueUs));
+        if (event.status == "ERR") {
+            spec.err++;
+            _errors[spec.name + ": " + event.text]++;
+        } else {
+            spec.ok++;
+        }
+    }
+
+    // Timers of the current phase: fault waits, probe deadlines, timeouts
+    void checkDeadlines(int64_t now) {
+        if (_phase == FAULT_DRAIN && _inflight.empty()) {
+            _faultStartUs = now;
+            _faultEndByte = enqueue(_faultFrame);
+            _faultDeadlineUs = 0;
+            _phase = FAULT_WAIT;
+        }
+        if (_phase == FAULT_WAIT) {
+            if (!_faultDeadlineUs && _written >= _faultEndByte) {
+                _faultDeadlineUs = now + _opt.faultWaitMs * 1000LL;
+            }
+            if (_faultDeadlineUs && now >= _faultDeadlineUs) {
+                _faults[_faultKind].silent++;
+                _phase = RESYNC;
+                _probes = 0;
+                sendProbe();
+            }
+        }
+        if (_phase == RESYNC) {
+            if (!_probeDeadlineUs && _written >= _probeEndByte) {
+                _probeDeadlineUs = now + _opt.faultWaitMs * 1000LL;
+            }
+            if (_probeDeadlineUs && now >= _probeDeadlineUs) {
+                if (_probes >= RESYNC_ATTEMPTS) {
+                    _faults[_faultKind].unsynced++;
+                    endFault(now);
+                } else {
+                    sendProbe();
+                }
+            }
+        }
+        if (_phase == SETTLE && now >= _settleUntilUs) endFault(now);
+        while (!_inflight.empty() && _inflight.front().sentUs &&
+               now - _inflight.front().sentUs > _opt.timeoutMs * 1000LL) {
+            _inflight.front().spec->timeout++;
+            _inflight.pop_front();
+        }
+    }
+
+    bool generating(int64_t now) const {
+        return !interrupts && now < _stopUs && (!_opt.count || _generated < _opt.count);
+    }
+
+    int pollTimeoutMs(int64_t now) const {
+        int64_t next = now + MAX_POLL_MS * 1000;
+        auto sooner = [&next](int64_t at) {
+            if (at) next = std::min(next, at);
+        };
+        if (_phase == RUNNING && _opt.openLoop && generating(now)) sooner(_nextDueUs);
+        if (!_inflight.empty() && _inflight.front().sentUs) {
+            sooner(_inflight.front().sentUs + _opt.timeoutMs * 1000LL + 1);
+        }
+        if (_phase == FAULT_WAIT) sooner(_faultDeadlineUs);
+        if (_phase == RESYNC) sooner(_probeDeadlineUs);
+        if (_phase == SETTLE) sooner(_settleUntilUs);
+        if (generating(now)) sooner(_stopUs);
+        return next <= now ? 0 : (int)((next - now + 999) / 1000);
+    }
+
+    bool writeSome(int64_t now) {
+        ssize_t n = write(_fd, _out.data() + _outHead, _out.size() - _outHead);
+        if (n < 0) return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+        _outHead += n;
+        _written += n;
+        if (_outHead == _out.size()) {
+            _out.clear();
+            _outHead = 0;
+        }
+        for (Request& request : _inflight) {
+            if (request.sentUs) continue;
+            if (request.endByte > _written) break;
+            request.sentUs = now;
+        }
+        return true;
+    }
+
+    bool readSome(int64_t now) {
+        uint8_t chunk[READ_CHUNK];
+        for (;;) {
+            ssize_t n = read(_fd, chunk, sizeof(chunk));
+            if (n < 0) return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+            if (n == 0) return false;
+            _rxBytes += n;
+            _events.clear();
+            _reader.feed(chunk, n, _events);
+            for (const FrameEvent& event : _events) {
+                if (event.kind == FrameEvent::LOG) {
+                    _logs++;
+                } else if (event.kind == FrameEvent::STRAY) {
+                    _stray++;
+                } else {
+                    onResponse(event, now);
+                }
+            }
+        }
+    }
+
+    const Options& _opt;
+    int _fd;
+    std::vector<CommandSpec>& _specs;
+    FaultStats* _faults;
+    std::mt19937 _rng;
+    std::exponential_distribution<double> _gap;
+    double _totalWeight = 0;
+
+    Phase _phase = RUNNING;
+    std::deque<Request> _inflight;   // In send order
+    std::vector<uint8_t> _out;
+    size_t _outHead = 0;
+    uint64_t _queued = 0, _written = 0, _rxBytes = 0;
+    uint64_t _generated = 0, _logs = 0, _stray = 0;
+    FrameReader _reader;
+    std::vector<FrameEvent> _events;
+    std::map<std::string, uint64_t> _errors;   // "<command>: <message>" -> count
+
+    int64_t _startUs = 0, _stopUs = 0, _endUs = 0, _nextDueUs = 0;
+    FaultKind _faultKind = FAULT_FLIP;
+    std::vector<uint8_t> _faultFrame;
+    int64_t _faultStartUs = 0, _faultDeadlineUs = 0, _faultPauseUs = 0;
+    uint64_t _faultEndByte = 0, _probeEndByte = 0;
+    int64_t _probeDeadlineUs = 0, _settleUntilUs = 0;
+    int _probes = 0;
+};
+
+bool LoadRun::run() {
+    _startUs = nowUs();
+    _stopUs = _startUs + (int64_t)(_opt.durationS * 1e6);
+    _nextDueUs = _startUs;
+    bool ok = true;
+    for (;;) {
+        int64_t now = nowUs();
+        if (_phase == RUNNING && generating(now)) {
+            if (!_opt.openLoop) {
+                while (_inflight.size() < (size_t)_opt.window && generating(now) && generate(now)) {}
+            } else {
+                while (_phase == RUNNING && _nextDueUs <= now && generating(now)) {
+                    if (unsent() >= _opt.backlog) {
+                        pickSpec().shed++;
+                        _generated++;
+                    } else {
+                        generate(_nextDueUs);
+                    }
+                    _nextDueUs += _opt.poisson ? (int64_t)(_gap(_rng) * 1e6) : (int64_t)(1e6 / _opt.rate);
+                }
+            }
+        }
+        checkDeadlines(now);
+        if (interrupts > 1 || (!generating(now) && _phase == RUNNING && _inflight.empty() && _out.empty())) {
+            break;
+        }
+
+        struct pollfd pfd = {_fd, (short)(POLLIN | (_out.empty() ? 0 : POLLOUT)), 0};
+        if (poll(&pfd, 1, pollTimeoutMs(now)) < 0 && errno != EINTR) {
+            perror("poll");
+            ok = false;
+            break;
+        }
+        now = nowUs();
+        if ((pfd.revents & POLLOUT) && !writeSome(now)) {
+            perror("write");
+            ok = false;
+            break;
+        }
+        if ((pfd.revents & (POLLIN | POLLHUP | POLLERR)) && !readSome(now)) {
+            fprintf(stderr, "serial_loadgen: port closed\n");
+            ok = false;
+            break;
+        }
+    }
+    _endUs = nowUs();
+    return ok;
+}
+
+// ---- Reporting ----
+static void addCommand(Report& report, const std::string& prefix, uint64_t sent, uint64_t ok, uint64_t err,
+                       uint64_t timeout, uint64_t shed, std::vector<double>& latencyUs, double activeS) {
+    report.add(prefix + ".sent", (double)sent);
+    report.add(prefix + ".ok", (double)ok);
+    report.add(prefix + ".err", (double)err);
+    report.add(prefix + ".timeout", (double)timeout);
+    report.add(prefix + ".shed", (double)shed);
+    report.add(prefix + ".replies_per_s", activeS > 0 ? (ok + err) / activeS : 0);
+    report.addLatency(prefix, summarize(latencyUs));
+}
+
+static void printCommands(const Report& report, const std::vector<std::string>& prefixes) {
+    printf("%-10s %8s %8s %6s %8s %6s %10s %10s %10s %10s %10s\n", "Command", "Sent", "OK", "ERR",
+           "Timeout", "Shed", "p50 us", "p90 us", "p99 us", "p99.9 us", "max us");
+    for (const std::string& p : prefixes) {
+        auto m = [&](const char* key) {
+            const double* v = report.metric(p + key);
+            return v ? *v : 0;
+        };
+        printf("%-10s %8.0f %8.0f %6.0f %8.0f %6.0f %10.0f %10.0f %10.0f %10.0f %10.0f\n", p.c_str(),
+               m(".sent"), m(".ok"), m(".err"), m(".timeout"), m(".shed"), m(".latency_p50_us"),
+               m(".latency_p90_us"), m(".latency_p99_us"), m(".latency_p999_us"), m(".latency_max_us"));
+    }
+}
+
+static Report buildReport(const Options& opt, const LoadRun& run, std::vector<CommandSpec>& specs,
+                          FaultStats* faults) {
+    Report report;
+    char text[64];
+    time_t now = time(nullptr);
+    strftime(text, sizeof(text), "%Y-%m-%dT%H:%M:%S%z", localtime(&now));
+    report.set("time", text);
+    if (!opt.label.empty()) report.set("label", opt.label);
+    report.set("port", opt.port);
+    if (opt.openLoop) {
+        snprintf(text, sizeof(text), "open rate=%g/s %s backlog=%zu", opt.rate,
+                 opt.poisson ? "poisson" : "fixed", opt.backlog);
+    } else {
+        snprintf(text, sizeof(text), "closed window=%d", opt.window);
+    }
+    report.set("mode", text);
+    report.set("mix", opt.mix);
+    if (!opt.faults.empty()) report.set("faults", opt.faults);
+    report.set("seed", std::to_string(opt.seed));
+
+    double activeS = run.elapsedS() - run.faultPauseS();
+    report.add("run.elapsed_s", run.elapsedS());
+    report.add("run.fault_pause_s", run.faultPauseS());
+    report.add("run.tx_bytes_per_s", run.elapsedS() > 0 ? run.txBytes() / run.elapsedS() : 0);
+    report.add("run.rx_bytes_per_s", run.elapsedS() > 0 ? run.rxBytes() / run.elapsedS() : 0);
+    report.add("run.logs", (double)run.logs());
+    report.add("run.stray", (double)run.stray());
+
+    uint64_t sent = 0, ok = 0, err = 0, timeout = 0, shed = 0;
+    std::vector<double> all;
+    for (CommandSpec& spec : specs) {
+        sent += spec.sent;
+        ok += spec.ok;
+        err += spec.err;
+        timeout += spec.timeout;
+        shed += spec.shed;
+        all.insert(all.end(), spec.latencyUs.begin(), spec.latencyUs.end());
+    }
+    addCommand(report, "total", sent, ok, err, timeout, shed, all, activeS);
+    for (CommandSpec& spec : specs) {
+        addCommand(report, spec.name, spec.sent, spec.ok, spec.err, spec.timeout, spec.shed, spec.latencyUs, activeS);
+    }
+
+    for (int kind = 0; kind < FAULT_COUNT; kind++) {
+        FaultStats& f = faults[kind];
+        if (f.probability <= 0) continue;
+        std::string prefix = std::string("fault.") + faultNames[kind];
+        report.add(prefix + ".injected", (double)f.injected);
+        report.add(prefix + ".rejected", (double)f.rejected);
+        report.add(prefix + ".accepted", (double)f.accepted);
+        report.add(prefix + ".silent", (double)f.silent);
+        report.add(prefix + ".extra", (double)f.extra);
+        report.add(prefix + ".unsynced", (double)f.unsynced);
+        LatencySummary recovery = summarize(f.recoveryUs);
+        report.add(prefix + ".recovery_p50_us", recovery.p50);
+        report.add(prefix + ".recovery_max_us", recovery.max);
+    }
+    return report;
+}
+
+static void printReport(const Report& report, const LoadRun& run, const std::vector<CommandSpec>& specs) {
+    printf("%s, mix %s, %s\n", report.field("mode")->c_str(), report.field("mix")->c_str(),
+           report.field("port")->c_str());
+    std::vector<std::string> prefixes;
+    for (const CommandSpec& spec : specs) prefixes.push_back(spec.name);
+    if (specs.size() > 1) prefixes.push_back("total");
+    printf("\n");
+    printCommands(report, prefixes);
+    printf("\n%.1f s (%.1f s in faults): %.1f replies/s, TX %.1f KiB/s, RX %.1f KiB/s, %.0f logs, %.0f stray\n",
+           run.elapsedS(), run.faultPauseS(), *report.metric("total.replies_per_s"),
+           *report.metric("run.tx_bytes_per_s") / 1024, *report.metric("run.rx_bytes_per_s") / 1024,
+           *report.metric("run.logs"), *report.metric("run.stray"));
+
+    if (!run.errors().empty()) {
+        std::vector<std::pair<uint64_t, std::string>> errors;
+        for (const auto& e : run.errors()) errors.emplace_back(e.second, e.first);
+        std::sort(errors.rbegin(), errors.rend());
+        printf("\nErrors:\n");
+        for (size_t i = 0; i < errors.size() && i < 8; i++) {
+            printf("  %6llu  %s\n", (unsigned long long)errors[i].first, errors[i].second.c_str());
+        }
+    }
+
+    if (report.field("faults")) {
+        printf("\n%-10s %8s %8s %8s %8s %6s %8s %14s %14s\n", "Fault", "Injected", "Rejected", "Accepted",
+               "Silent", "Extra", "Unsynced", "Recovery p50", "Recovery max");
+        for (int kind = 0; kind < FAULT_COUNT; kind++) {
+            std::string prefix = std::string("fault.") + faultNames[kind];
+            if (!report.metric(prefix + ".injected")) continue;
+            auto m = [&](const char* key) { return *report.metric(prefix + key); };
+            printf("%-10s %8.0f %8.0f %8.0f %8.0f %6.0f %8.0f %11.1f ms %11.1f ms\n", faultNames[kind],
+                   m(".injected"), m(".rejected"), m(".accepted"), m(".silent"), m(".extra"), m(".unsynced"),
+                   m(".recovery_p50_us") / 1000, m(".recovery_max_us") / 1000);
+        }
+    }
+}
+
+static int compareMain(int argc, char** argv) {
+    const char* paths[2] = {nullptr, nullptr};
+    int n = 0;
+    double threshold = 10;
+    for (int i = 2; i < argc; i++) {
+        if (strcmp(argv[i], "--threshold") == 0 && i + 1 < argc) {
+            threshold = atof(argv[++i]);
+        } else if (n < 2) {
+            paths[n++] = argv[i];
+        } else {
+            usage(argv[0]);
+        }
+    }
+    if (n != 2) usage(argv[0]);
+    Report base, run;
+    std::string error;
+    if (!reportRead(base, paths[0], error) || !reportRead(run, paths[1], error)) {
+        fprintf(stderr, "serial_loadgen: %s\n", error.c_str());
+        return 2;
+    }
+    std::vector<std::string> worse = reportCompare(base, run, threshold);
+    if (!worse.empty()) {
+        printf("\n%zu metric(s) worse by more than %g%%\n", worse.size(), threshold);
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    if (argc > 1 && strcmp(argv[1], "compare") == 0) return compareMain(argc, argv);
+
+    Options opt;
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        bool takesValue = true;
+        if (strcmp(arg, "--rtscts") == 0) {
+            opt.rtscts = true;
+            takesValue = false;
+        } else if (strcmp(arg, "--closed") == 0) {
+            opt.openLoop = false;
+            takesValue = false;
+        } else if (strcmp(arg, "--open") == 0) {
+            opt.openLoop = true;
+            takesValue = false;
+        } else if (!value) {
+            usage(argv[0]);
+        } else if (strcmp(arg, "--port") == 0) {
+            opt.port = value;
+        } else if (strcmp(arg, "--baud") == 0) {
+            opt.baud = atoi(value);
+        } else if (strcmp(arg, "--window") == 0) {
+            opt.window = std::max(1, atoi(value));
+        } else if (strcmp(arg, "--rate") == 0) {
+            opt.rate = atof(value);
+        } else if (strcmp(arg, "--arrival") == 0) {
+            if (strcmp(value, "poisson") != 0 && strcmp(value, "fixed") != 0) usage(argv[0]);
+            opt.poisson = strcmp(value, "poisson") == 0;
+        } else if (strcmp(arg, "--backlog") == 0) {
+            opt.backlog = (size_t)std::max(1, atoi(value));
+        } else if (strcmp(arg, "--mix") == 0) {
+            opt.mix = value;
+        } else if (strcmp(arg, "--duration") == 0) {
+            opt.durationS = atof(value);
+        } else if (strcmp(arg, "--count") == 0) {
+            opt.count = strtoull(value, nullptr, 10);
+        } else if (strcmp(arg, "--timeout") == 0) {
+            opt.timeoutMs = atoi(value);
+        } else if (strcmp(arg, "--faults") == 0) {
+            opt.faults = value;
+        } else if (strcmp(arg, "--fault-wait") == 0) {
+            opt.faultWaitMs = atoi(value);
+        } else if (strcmp(arg, "--seed") == 0) {
+            opt.seed = (uint32_t)strtoul(value, nullptr, 10);
+            opt.seedSet = true;
+        } else if (strcmp(arg, "--mvel-speed") == 0) {
+            opt.mvelSpeed = std::max(-255, std::min(255, atoi(value)));
+        } else if (strcmp(arg, "--mvel-ms") == 0) {
+            opt.mvelMs = atoi(value);
+        } else if (strcmp(arg, "--json") == 0) {
+            opt.json = value;
+        } else if (strcmp(arg, "--label") == 0) {
+            opt.label = value;
+        } else {
+            usage(argv[0]);
+        }
+        if (takesValue) i++;
+    }
+    if (!opt.port || (opt.openLoop && opt.rate <= 0) || opt.durationS <= 0) usage(argv[0]);
+    if (!opt.seedSet) opt.seed = (uint32_t)std::random_device{}();
+
+    std::mt19937 rng(opt.seed);
+    std::vector<CommandSpec> specs;
+    FaultStats faults[FAULT_COUNT];
+    std::string error;
+    if (!parseMix(opt, rng, specs, error) || !parseFaults(opt.faults, faults, error)) {
+        fprintf(stderr, "serial_loadgen: %s\n", error.c_str());
+        return 2;
+    }
+    int fd = ttyOpen(opt.port, opt.baud, opt.rtscts, error);
+    if (fd < 0) {
+        fprintf(stderr, "serial_loadgen: %s\n", error.c_str());
+        return 2;
+    }
+
+    // First ^C stops sending and waits for the replies, a second gives up
+    signal(SIGINT, onInterrupt);
+    LoadRun run(opt, fd, specs, faults);
+    bool ok = run.run();
+    close(fd);
+
+    Report report = buildReport(opt, run, specs, faults);
+    printReport(report, run, specs);
+    if (opt.json && !reportWrite(report, opt.json, error)) {
+        fprintf(stderr, "serial_loadgen: %s\n", error.c_str());
+        return 2;
+    }
+    return ok ? 0 : 1;
+}
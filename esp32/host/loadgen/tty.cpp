@@ -0,0 +1,71 @@
+/*
+ * Serial port setup for serial_loadgen
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "tty.h"
+
+static bool baudConstant(int baud, speed_t& speed) {
+    static const struct { int baud; speed_t speed; } rates[] = {
+        {9600, B9600}, {19200, B19200}, {38400, B38400}, {57600, B57600}, {115200, B115200},
+        {230400, B230400},
+#ifdef B460800
+        {460800, B460800}, {921600, B921600}, {1000000, B1000000}, {1500000, B1500000},
+        {2000000, B2000000}, {3000000, B3000000}, {4000000, B4000000},
+#endif
+    };
+    for (const auto& rate : rates) {
+        if (rate.baud == baud) {
+            speed = rate.speed;
+            return true;
+        }
+    }
+    return false;
+}
+
+int ttyOpen(const char* path, int baud, bool rtscts, std::string& error) {
+    int fd = open(path, O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (fd < 0) {
+        error = std::string(path) + ": " + strerror(errno);
+        return -1;
+    }
+    struct termios tio;
+    if (tcgetattr(fd, &tio) != 0) {
+        error = std::string(path) + ": not a terminal";
+        close(fd);
+        return -1;
+    }
+    cfmakeraw(&tio);
+    tio.c_cflag |= CLOCAL | CREAD;
+    tio.c_cflag &= ~(CSTOPB | PARENB);
+#ifdef CRTSCTS
+    if (rtscts) {
+        tio.c_cflag |= CRTSCTS;
+    } else {
+        tio.c_cflag &= ~CRTSCTS;
+    }
+#endif
+    if (baud > 0) {
+        speed_t speed;
+        if (!baudConstant(baud, speed)) {
+            error = "unsupported baud rate " + std::to_string(baud);
+            close(fd);
+            return -1;
+        }
+        cfsetispeed(&tio, speed);
+        cfsetospeed(&tio, speed);
+    }
+    if (tcsetattr(fd, TCSANOW, &tio) != 0) {
+        error = std::string(path) + ": " + strerror(errno);
+        close(fd);
+        return -1;
+    }
+    // Whatever the board sent before we were listening
+    tcflush(fd, TCIOFLUSH);
+    return fd;
+}
@@ -0,0 +1,12 @@
+#ifndef LOADGEN_TTY_H
+#define LOADGEN_TTY_H
+
+#include <string>
+
+// Opens a serial port or pseudo-terminal raw (8N1, no echo, no line
+// processing) and non-blocking. baud 0 keeps the current speed, as for a
+// pty or USB CDC where it means nothing. Returns the fd, or -1 with the
+// reason in error.
+int ttyOpen(const char* path, int baud, bool rtscts, std::string& error);
+
+#endif // LOADGEN_TTY_H
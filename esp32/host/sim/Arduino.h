@@ -0,0 +1,158 @@
+#ifndef SIM_ARDUINO_H
+#define SIM_ARDUINO_H
+
+/*
+ * Arduino-ESP32 core for the host simulator: the subset the firmware
+ * uses. Time comes from the virtual clock, GPIO and PWM land in the
+ * simulated devices, and Serial is a pseudo-terminal (see sim.h).
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <algorithm>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "driver/uart.h"   // Via HardwareSerial, as in the core
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define PROGMEM
+
+#define LOW     0
+#define HIGH    1
+#define INPUT   0x01
+#define OUTPUT  0x03
+#define INPUT_PULLUP 0x05
+
+#define RISING  0x01
+#define FALLING 0x02
+#define CHANGE  0x03
+#define digitalPinToInterrupt(pin) (pin)
+
+#define SERIAL_8N1 0x800001c
+
+typedef uint8_t byte;
+
+using std::min;
+using std::max;
+
+template <class T, class L, class H>
+static inline T constrain(T x, L low, H high) {
+    return x < low ? low : (x > high ? high : x);
+}
+
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t level);
+int digitalRead(uint8_t pin);
+void attachInterrupt(uint8_t pin, void (*handler)(), int mode);
+uint32_t analogReadMilliVolts(uint8_t pin);
+
+bool ledcAttach(uint8_t pin, uint32_t freq, uint8_t resolution);
+bool ledcWrite(uint8_t pin, uint32_t duty);
+uint32_t ledcRead(uint8_t pin);
+
+// Hardware timer: runs its handler as an interrupt on its own thread
+struct hw_timer_t;
+hw_timer_t* timerBegin(uint32_t frequency);
+void timerAttachInterrupt(hw_timer_t* timer, void (*handler)());
+void timerAlarm(hw_timer_t* timer, uint64_t alarmValue, bool autoreload, uint64_t reloadCount);
+
+uint32_t getCpuFrequencyMhz();
+bool psramFound();
+void* ps_malloc(size_t size);
+[[noreturn]] void esp_deep_sleep_start();
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) { return write(&c, 1); }
+    virtual size_t write(const uint8_t* data, size_t length) = 0;
+    size_t write(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+
+    size_t print(const char* s) { return write(s); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int n) { return printf("%d", n); }
+    size_t print(unsigned int n) { return printf("%u", n); }
+    size_t print(long n) { return printf("%ld", n); }
+    size_t print(unsigned long n) { return printf("%lu", n); }
+    size_t println(const char* s = "") { return print(s) + print("\r\n"); }
+
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+        char buf[256];
+        va_list args;
+        va_start(args, format);
+        int n = vsnprintf(buf, sizeof(buf), format, args);
+        va_end(args);
+        if (n <= 0) return 0;
+        return write((const uint8_t*)buf, std::min((size_t)n, sizeof(buf) - 1));
+    }
+};
+
+// UART: Serial is the pseudo-terminal the host connects to; Serial1 and
+// Serial2 only write to the simulator's stdout
+class HardwareSerial : public Print {
+public:
+    explicit HardwareSerial(int uart) : _uart(uart) {}
+
+    void begin(unsigned long baud, uint32_t config = SERIAL_8N1, int8_t rxPin = -1, int8_t txPin = -1) {}
+    bool setPins(int8_t rxPin, int8_t txPin, int8_t ctsPin = -1, int8_t rtsPin = -1) { return true; }
+    bool setHwFlowCtrlMode(int mode, uint8_t threshold = 64) { return true; }
+    bool setRxFIFOFull(uint8_t bytes) { return true; }
+    bool setRxTimeout(uint8_t symbols) { return true; }
+    size_t setRxBufferSize(size_t size);
+    size_t setTxBufferSize(size_t size) { return size; }
+    void onReceive(void (*callback)());
+
+    int available();
+    int read();
+    size_t readBytes(uint8_t* buffer, size_t length);
+    void flush() {}
+
+    using Print::write;
+    size_t write(const uint8_t* data, size_t length) override;
+
+private:
+    int _uart;
+};
+
+extern HardwareSerial Serial;
+extern HardwareSerial Serial1;
+extern HardwareSerial Serial2;
+
+class EspClass {
+public:
+    [[noreturn]] void restart();
+    uint32_t getFreeHeap();
+    uint32_t getHeapSize();
+    uint32_t getMinFreeHeap();
+    uint32_t getMaxAllocHeap();
+    uint32_t getCpuFreqMHz() { return getCpuFrequencyMhz(); }
+};
+
+extern EspClass ESP;
+
+class IPAddress {
+public:
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : _bytes{a, b, c, d} {}
+    uint8_t operator[](int i) const { return _bytes[i]; }
+
+private:
+    uint8_t _bytes[4];
+};
+
+#endif // SIM_ARDUINO_H
@@ -0,0 +1,7 @@
+#ifndef SIM_IPADDRESS_H
+#define SIM_IPADDRESS_H
+
+// IPAddress lives in Arduino.h here, as in the core it is pulled in by it
+#include "Arduino.h"
+
+#endif // SIM_IPADDRESS_H
@@ -0,0 +1,21 @@
+#ifndef SIM_WIFI_H
+#define SIM_WIFI_H
+
+#include "Arduino.h"
+
+#define WIFI_AP 2
+
+// No radio: the access point "starts" and no station ever joins
+class WiFiClass {
+public:
+    bool mode(int mode) { return true; }
+    bool softAPConfig(IPAddress local, IPAddress gateway, IPAddress subnet) { return true; }
+    bool softAP(const char* ssid, const char* password, int channel = 1, int hidden = 0, int maxConnections = 4) {
+        return true;
+    }
+    uint8_t softAPgetStationNum() { return 0; }
+};
+
+extern WiFiClass WiFi;
+
+#endif // SIM_WIFI_H
@@ -0,0 +1,48 @@
+#ifndef SIM_DRIVER_UART_H
+#define SIM_DRIVER_UART_H
+
+/*
+ * ESP-IDF UART driver for the host simulator, as far as SBENCH uses it:
+ * a port with no pins, whose loopback moves each write into its own RX
+ * buffer after the bytes' time on the wire at the configured baud rate.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+
+typedef int uart_port_t;
+#define UART_NUM_0   0
+#define UART_NUM_1   1
+#define UART_NUM_2   2
+#define UART_NUM_MAX 3
+
+// Values as in ESP-IDF (hal/uart_types.h)
+typedef enum { UART_DATA_5_BITS, UART_DATA_6_BITS, UART_DATA_7_BITS, UART_DATA_8_BITS } uart_word_length_t;
+typedef enum { UART_PARITY_DISABLE = 0, UART_PARITY_EVEN = 2, UART_PARITY_ODD = 3 } uart_parity_t;
+typedef enum { UART_STOP_BITS_1 = 1, UART_STOP_BITS_1_5 = 2, UART_STOP_BITS_2 = 3 } uart_stop_bits_t;
+typedef enum { UART_SCLK_DEFAULT } uart_sclk_t;
+#define UART_HW_FLOWCTRL_DISABLE 0
+#define UART_HW_FLOWCTRL_CTS_RTS 3
+
+typedef struct {
+    int baud_rate;
+    uart_word_length_t data_bits;
+    uart_parity_t parity;
+    uart_stop_bits_t stop_bits;
+    int flow_ctrl;
+    uint8_t rx_flow_ctrl_thresh;
+    uart_sclk_t source_clk;
+} uart_config_t;
+
+esp_err_t uart_driver_install(uart_port_t port, int rxBufferSize, int txBufferSize, int queueSize,
+                              QueueHandle_t* queue, int intrAllocFlags);
+esp_err_t uart_driver_delete(uart_port_t port);
+esp_err_t uart_param_config(uart_port_t port, const uart_config_t* config);
+esp_err_t uart_set_loop_back(uart_port_t port, bool enable);
+int uart_write_bytes(uart_port_t port, const void* src, size_t size);
+int uart_read_bytes(uart_port_t port, void* buf, uint32_t length, TickType_t ticks);
+
+#endif // SIM_DRIVER_UART_H
@@ -0,0 +1,9 @@
+#ifndef SIM_ESP_CPU_H
+#define SIM_ESP_CPU_H
+
+#include <stdint.h>
+
+// CPU cycles at the nominal clock, derived from the virtual clock
+uint32_t esp_cpu_get_cycle_count();
+
+#endif // SIM_ESP_CPU_H
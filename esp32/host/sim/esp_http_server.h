@@ -0,0 +1,134 @@
+#ifndef SIM_ESP_HTTP_SERVER_H
+#define SIM_ESP_HTTP_SERVER_H
+
+/*
+ * esp_http_server for the host simulator: the API the firmware uses, with
+ * no server behind it. httpd_start() succeeds and routes register, but no
+ * request ever arrives, so the web side stays idle; the simulator is for
+ * the serial link.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#include "esp_err.h"
+
+#define ESP_ERR_HTTPD_RESULT_TRUNC  0xb004
+
+#define CONFIG_HTTPD_WS_SUPPORT 1
+
+#define HTTPD_RESP_USE_STRLEN   -1
+#define HTTPD_SOCK_ERR_FAIL     -1
+#define HTTPD_SOCK_ERR_INVALID  -2
+#define HTTPD_SOCK_ERR_TIMEOUT  -3
+
+typedef void* httpd_handle_t;
+
+enum http_method {
+    HTTP_DELETE = 0,
+    HTTP_GET = 1,
+    HTTP_HEAD = 2,
+    HTTP_POST = 3,
+    HTTP_PUT = 4,
+};
+typedef enum http_method httpd_method_t;
+
+typedef enum {
+    HTTPD_400_BAD_REQUEST,
+    HTTPD_404_NOT_FOUND,
+    HTTPD_408_REQ_TIMEOUT,
+    HTTPD_500_INTERNAL_SERVER_ERROR,
+} httpd_err_code_t;
+
+typedef struct httpd_req {
+    httpd_handle_t handle;
+    int method;
+    const char uri[513];
+    size_t content_len;
+    void* aux;
+    void* user_ctx;
+} httpd_req_t;
+
+typedef struct httpd_uri {
+    const char* uri;
+    httpd_method_t method;
+    esp_err_t (*handler)(httpd_req_t* r);
+    void* user_ctx;
+    bool is_websocket;
+    bool handle_ws_control_frames;
+    const char* supported_subprotocol;
+} httpd_uri_t;
+
+typedef void (*httpd_close_func_t)(httpd_handle_t hd, int sockfd);
+
+typedef struct httpd_config {
+    unsigned task_priority;
+    size_t stack_size;
+    int core_id;
+    uint16_t server_port;
+    uint16_t max_open_sockets;
+    uint16_t max_uri_handlers;
+    uint16_t max_resp_headers;
+    bool lru_purge_enable;
+    uint16_t recv_wait_timeout;
+    uint16_t send_wait_timeout;
+    httpd_close_func_t close_fn;
+} httpd_config_t;
+
+#define HTTPD_DEFAULT_CONFIG() {  \
+    .task_priority = 5,           \
+    .stack_size = 4096,           \
+    .core_id = 0x7FFFFFFF,        \
+    .server_port = 80,            \
+    .max_open_sockets = 7,        \
+    .max_uri_handlers = 8,        \
+    .max_resp_headers = 8,        \
+    .lru_purge_enable = false,    \
+    .recv_wait_timeout = 5,       \
+    .send_wait_timeout = 5,       \
+    .close_fn = NULL,             \
+}
+
+typedef enum {
+    HTTPD_WS_TYPE_CONTINUE = 0x0,
+    HTTPD_WS_TYPE_TEXT = 0x1,
+    HTTPD_WS_TYPE_BINARY = 0x2,
+    HTTPD_WS_TYPE_CLOSE = 0x8,
+    HTTPD_WS_TYPE_PING = 0x9,
+    HTTPD_WS_TYPE_PONG = 0xA,
+} httpd_ws_type_t;
+
+typedef struct httpd_ws_frame {
+    bool final;
+    bool fragmented;
+    httpd_ws_type_t type;
+    uint8_t* payload;
+    size_t len;
+} httpd_ws_frame_t;
+
+typedef void (*httpd_work_fn_t)(void* arg);
+
+esp_err_t httpd_start(httpd_handle_t* handle, const httpd_config_t* config);
+esp_err_t httpd_register_uri_handler(httpd_handle_t handle, const httpd_uri_t* uri_handler);
+esp_err_t httpd_queue_work(httpd_handle_t handle, httpd_work_fn_t work, void* arg);
+esp_err_t httpd_sess_trigger_close(httpd_handle_t handle, int sockfd);
+
+int httpd_req_to_sockfd(httpd_req_t* r);
+int httpd_req_recv(httpd_req_t* r, char* buf, size_t buf_len);
+esp_err_t httpd_req_get_hdr_value_str(httpd_req_t* r, const char* field, char* val, size_t val_size);
+esp_err_t httpd_req_get_url_query_str(httpd_req_t* r, char* buf, size_t buf_len);
+esp_err_t httpd_query_key_value(const char* qry, const char* key, char* val, size_t val_size);
+
+esp_err_t httpd_resp_set_status(httpd_req_t* r, const char* status);
+esp_err_t httpd_resp_set_type(httpd_req_t* r, const char* type);
+esp_err_t httpd_resp_set_hdr(httpd_req_t* r, const char* field, const char* value);
+esp_err_t httpd_resp_send(httpd_req_t* r, const char* buf, ssize_t buf_len);
+esp_err_t httpd_resp_send_chunk(httpd_req_t* r, const char* buf, ssize_t buf_len);
+esp_err_t httpd_resp_sendstr(httpd_req_t* r, const char* str);
+esp_err_t httpd_resp_send_err(httpd_req_t* req, httpd_err_code_t error, const char* msg);
+
+esp_err_t httpd_ws_recv_frame(httpd_req_t* req, httpd_ws_frame_t* pkt, size_t max_len);
+esp_err_t httpd_ws_send_frame_async(httpd_handle_t hd, int fd, httpd_ws_frame_t* frame);
+
+#endif // SIM_ESP_HTTP_SERVER_H
@@ -0,0 +1,8 @@
+// The unmodified sketch, compiled as C++ against the shims in this directory
+#include "esp32_firmware.ino"
+
+#include "sim_epd.h"
+
+const SimEpdPins simFirmwareEpdPins = {
+    PIN_SPI_SCK, PIN_SPI_DIN, PIN_SPI_CS, PIN_SPI_DC, PIN_SPI_RST, PIN_SPI_BUSY, PIN_SPI_PWR,
+};
@@ -0,0 +1,54 @@
+#ifndef SIM_FREERTOS_H
+#define SIM_FREERTOS_H
+
+/*
+ * FreeRTOS for the host simulator: the subset the firmware uses, on
+ * threads and the virtual clock (see sim.h). One tick is 1 ms, as in the
+ * Arduino-ESP32 build.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <mutex>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define pdTRUE   1
+#define pdFALSE  0
+#define pdPASS   pdTRUE
+#define pdFAIL   pdFALSE
+
+#define configTICK_RATE_HZ       1000
+#define portTICK_PERIOD_MS       (1000 / configTICK_RATE_HZ)
+#define portMAX_DELAY            ((TickType_t)0xFFFFFFFF)
+#define pdMS_TO_TICKS(ms)        ((TickType_t)(((uint64_t)(ms) * configTICK_RATE_HZ) / 1000))
+#define configGENERATE_RUN_TIME_STATS 0
+
+struct SimTask;
+struct SimQueue;
+typedef SimTask* TaskHandle_t;
+typedef SimQueue* QueueHandle_t;
+typedef SimQueue* SemaphoreHandle_t;
+
+// Spinlock of a critical section; nests on the owning thread as on the chip
+struct portMUX_TYPE {
+    std::recursive_mutex mutex;
+};
+#define portMUX_INITIALIZER_UNLOCKED  portMUX_TYPE{}
+
+#define portENTER_CRITICAL(mux)       (mux)->mutex.lock()
+#define portEXIT_CRITICAL(mux)        (mux)->mutex.unlock()
+#define portENTER_CRITICAL_ISR(mux)   portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL_ISR(mux)    portEXIT_CRITICAL(mux)
+#define portENTER_CRITICAL_SAFE(mux)  portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL_SAFE(mux)   portEXIT_CRITICAL(mux)
+
+// Woken tasks run as soon as their thread is scheduled
+#define portYIELD_FROM_ISR(...)       ((void)0)
+
+BaseType_t xPortInIsrContext();
+BaseType_t xPortGetCoreID();
+
+#endif // SIM_FREERTOS_H
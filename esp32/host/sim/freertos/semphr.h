@@ -0,0 +1,13 @@
+#ifndef SIM_FREERTOS_SEMPHR_H
+#define SIM_FREERTOS_SEMPHR_H
+
+#include "queue.h"
+
+// A mutex is a queue of one empty item that starts full, as in FreeRTOS
+SemaphoreHandle_t xSemaphoreCreateMutex();
+// A binary semaphore is the same queue starting empty
+SemaphoreHandle_t xSemaphoreCreateBinary();
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore);
+
+#endif // SIM_FREERTOS_SEMPHR_H
@@ -0,0 +1,21 @@
+#ifndef SIM_LWIP_SOCKETS_H
+#define SIM_LWIP_SOCKETS_H
+
+/*
+ * lwIP sockets for the host simulator: the host's own BSD sockets.
+ * As lwIP's compat macros do, bind() goes through lwip_bind(), which
+ * moves privileged ports (the captive DNS on 53) up by the simulator's
+ * port offset so it runs without root.
+ */
+
+#include <errno.h>
+#include <unistd.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+
+int lwip_bind(int s, const struct sockaddr* name, socklen_t namelen);
+#define bind(s, name, namelen) lwip_bind(s, name, namelen)
+
+#endif // SIM_LWIP_SOCKETS_H
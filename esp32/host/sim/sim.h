@@ -0,0 +1,107 @@
+#ifndef SIM_H
+#define SIM_H
+
+/*
+ * Host simulator internals, shared by the HAL shims and the simulated
+ * devices. The firmware never includes this; it sees only the Arduino,
+ * FreeRTOS and ESP-IDF headers next to it.
+ *
+ * Virtual clock: every firmware time source (millis, micros,
+ * esp_timer_get_time, FreeRTOS ticks, the hardware timer) reads
+ *     now = offset + (real time since the last rebase) * speed
+ * so speed 10 runs a 4 s EPD refresh in 0.4 s, speed 0 freezes time
+ * until simAdvanceUs() steps it. Every timed wait in the shims is a wait
+ * on simCond with a virtual deadline, so a speed change or a step wakes
+ * it to recompute.
+ *
+ * Threads stand in for the two cores: each FreeRTOS task, the UART event
+ * task and the hardware timer run truly in parallel, as on the chip.
+ */
+
+#include <stdint.h>
+#include <condition_variable>
+#include <mutex>
+
+// ---- Virtual clock (sim_clock.cpp) ----
+int64_t simNowUs();
+double simSpeed();
+void simSetSpeed(double speed);
+void simAdvanceUs(int64_t us);
+
+// Lock and condition behind every blocking shim call
+extern std::mutex simLock;
+extern std::condition_variable simCond;
+
+// With simLock held: waits until pred() holds or the virtual clock
+// reaches deadlineUs (-1 = no deadline). Returns pred().
+template <class Pred>
+bool simWaitUntil(std::unique_lock<std::mutex>& lock, int64_t deadlineUs, Pred pred);
+bool simWaitUntil(std::unique_lock<std::mutex>& lock, int64_t deadlineUs);
+
+// ---- Tasks and interrupts (sim_rtos.cpp) ----
+// True on a thread running an interrupt handler
+bool simInIsr();
+
+// Runs an interrupt handler on the calling thread
+void simRunIsr(void (*handler)());
+
+// Starts a thread that is not a FreeRTOS task but may block in the shims
+// (UART event task, hardware timer)
+void simStartThread(const char* name, void (*fn)(void*), void* arg);
+
+// ---- GPIO (sim_arduino.cpp) ----
+// A simulated part on the pins: notified of every level the firmware
+// writes, and asked for the level of every pin the firmware reads
+struct SimDevice {
+    virtual ~SimDevice() {}
+    virtual void pinWritten(int pin, int level) = 0;
+    virtual bool drivesPin(int pin) const = 0;
+    virtual int pinLevel(int pin) = 0;
+};
+
+void simAttachDevice(SimDevice* device);
+
+// Called by a device when a pin it drives changes; fires the pin's
+// interrupt on the calling thread if the edge matches
+void simPinChanged(int pin, int level);
+
+// Last ledcWrite() duty per pin, -1 if the pin has no PWM channel
+int simPwmDuty(int pin);
+
+// ---- Serial link (sim_arduino.cpp) ----
+// Opens a new pseudo-terminal for Serial, or adopts masterFd (>= 0) kept
+// open across a simulated restart. Returns the master fd, -1 on failure.
+int simSerialOpen(int masterFd);
+const char* simSerialPath();
+
+// ---- Process (each program: sim_main.cpp, the benchmarks) ----
+// ESP.restart(): the simulator re-executes itself, keeping the pseudo-terminal
+[[noreturn]] void simRestart();
+
+// ---- Network (sim_net.cpp) ----
+// Privileged ports the firmware binds are moved up by this much
+extern int simPortOffset;
+
+// ---- Template definitions ----
+int64_t simRealWaitUs(int64_t virtualUs);
+
+template <class Pred>
+bool simWaitUntil(std::unique_lock<std::mutex>& lock, int64_t deadlineUs, Pred pred) {
+    while (!pred()) {
+        if (deadlineUs < 0) {
+            simCond.wait(lock);
+            continue;
+        }
+        int64_t now = simNowUs();
+        if (now >= deadlineUs) return pred();
+        int64_t realUs = simRealWaitUs(deadlineUs - now);
+        if (realUs < 0) {
+            simCond.wait(lock);   // Clock frozen: only a step or a speed change moves it
+        } else {
+            simCond.wait_for(lock, std::chrono::microseconds(realUs));
+        }
+    }
+    return true;
+}
+
+#endif // SIM_H
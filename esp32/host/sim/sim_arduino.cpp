@@ -0,0 +1,431 @@
+/*
+ * Arduino-ESP32 core on the host: time, GPIO, PWM, the hardware timer,
+ * the UARTs (Serial objects and the ESP-IDF driver) and the ESP object
+ * (see Arduino.h)
+ */
+
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+#include <atomic>
+#include <deque>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Arduino.h"
+#include "WiFi.h"
+#include "esp_cpu.h"
+#include "esp_heap_caps.h"
+#include "sim.h"
+
+#define SIM_PIN_COUNT       49
+#define SIM_CPU_MHZ         240
+#define SIM_HEAP_SIZE       327680
+#define SIM_HEAP_FREE       262144
+#define SIM_SERIAL_RX_SIZE  256      // Arduino default until setRxBufferSize()
+#define SIM_SERIAL_POLL_MS  20       // Real time between checks for a host
+
+HardwareSerial Serial(0);
+HardwareSerial Serial1(1);
+HardwareSerial Serial2(2);
+EspClass ESP;
+WiFiClass WiFi;
+
+// ---- Time ----
+int64_t esp_timer_get_time() {
+    return simNowUs();
+}
+
+unsigned long millis() {
+    return (unsigned long)(simNowUs() / 1000);
+}
+
+unsigned long micros() {
+    return (unsigned long)simNowUs();
+}
+
+void delay(uint32_t ms) {
+    vTaskDelay(pdMS_TO_TICKS(ms));
+}
+
+void yield() {
+    std::this_thread::yield();
+}
+
+uint32_t esp_cpu_get_cycle_count() {
+    return (uint32_t)(simNowUs() * SIM_CPU_MHZ);
+}
+
+uint32_t getCpuFrequencyMhz() {
+    return SIM_CPU_MHZ;
+}
+
+// ---- GPIO and PWM ----
+struct PinState {
+    std::atomic<int> level{LOW};      // Written by the firmware, or driven by a device
+    std::atomic<int> pwmDuty{-1};     // -1: no PWM channel
+    void (*isr)() = nullptr;
+    int isrMode = 0;
+};
+
+static PinState pins[SIM_PIN_COUNT];
+static std::vector<SimDevice*> devices;   // Attached before the firmware starts
+
+void simAttachDevice(SimDevice* device) {
+    devices.push_back(device);
+}
+
+void pinMode(uint8_t pin, uint8_t mode) {
+}
+
+void digitalWrite(uint8_t pin, uint8_t level) {
+    if (pin >= SIM_PIN_COUNT) return;
+    pins[pin].level = level ? HIGH : LOW;
+    for (SimDevice* device : devices) device->pinWritten(pin, level ? HIGH : LOW);
+}
+
+int digitalRead(uint8_t pin) {
+    if (pin >= SIM_PIN_COUNT) return LOW;
+    for (SimDevice* device : devices) {
+        if (device->drivesPin(pin)) return device->pinLevel(pin);
+    }
+    return pins[pin].level;
+}
+
+void attachInterrupt(uint8_t pin, void (*handler)(), int mode) {
+    if (pin >= SIM_PIN_COUNT) return;
+    pins[pin].isr = handler;
+    pins[pin].isrMode = mode;
+}
+
+void simPinChanged(int pin, int level) {
+    if (pin < 0 || pin >= SIM_PIN_COUNT) return;
+    int previous = pins[pin].level.exchange(level);
+    PinState& p = pins[pin];
+    if (!p.isr || previous == level) return;
+    bool rising = level == HIGH;
+    if (p.isrMode == CHANGE || (p.isrMode == RISING && rising) || (p.isrMode == FALLING && !rising)) {
+        simRunIsr(p.isr);
+    }
+}
+
+uint32_t analogReadMilliVolts(uint8_t pin) {
+    return 0;
+}
+
+bool ledcAttach(uint8_t pin, uint32_t freq, uint8_t resolution) {
+    if (pin >= SIM_PIN_COUNT) return false;
+    pins[pin].pwmDuty = 0;
+    return true;
+}
+
+bool ledcWrite(uint8_t pin, uint32_t duty) {
+    if (pin >= SIM_PIN_COUNT || pins[pin].pwmDuty < 0) return false;
+    pins[pin].pwmDuty = (int)duty;
+    return true;
+}
+
+uint32_t ledcRead(uint8_t pin) {
+    if (pin >= SIM_PIN_COUNT || pins[pin].pwmDuty < 0) return 0;
+    return (uint32_t)pins[pin].pwmDuty.load();
+}
+
+int simPwmDuty(int pin) {
+    return pin >= 0 && pin < SIM_PIN_COUNT ? pins[pin].pwmDuty.load() : -1;
+}
+
+// ---- Hardware timer ----
+struct hw_timer_t {
+    uint32_t frequency;
+    void (*handler)();
+    int64_t periodUs;
+    bool autoreload;
+};
+
+hw_timer_t* timerBegin(uint32_t frequency) {
+    return new hw_timer_t{frequency, nullptr, 0, false};
+}
+
+void timerAttachInterrupt(hw_timer_t* timer, void (*handler)()) {
+    timer->handler = handler;
+}
+
+// Alarms are due on the virtual clock; after a step the missed ones fire
+// back to back, so every tick still happens once
+static void timerThread(void* arg) {
+    hw_timer_t* timer = (hw_timer_t*)arg;
+    int64_t due = simNowUs() + timer->periodUs;
+    do {
+        {
+            std::unique_lock<std::mutex> lock(simLock);
+            simWaitUntil(lock, due);
+        }
+        if (timer->handler) simRunIsr(timer->handler);
+        due += timer->periodUs;
+    } while (timer->autoreload);
+    vTaskSuspend(nullptr);
+}
+
+void timerAlarm(hw_timer_t* timer, uint64_t alarmValue, bool autoreload, uint64_t reloadCount) {
+    timer->periodUs = (int64_t)(alarmValue * 1000000 / timer->frequency);
+    timer->autoreload = autoreload;
+    if (timer->periodUs < 1) timer->periodUs = 1;
+    simStartThread("timer", timerThread, timer);
+}
+
+// ---- Serial: a pseudo-terminal in raw mode ----
+// The reader thread stands in for the UART event task. It stops reading
+// while the RX buffer is full, so the host is held up rather than bytes
+// dropped. Output written while no host has the terminal open is
+// discarded, as bytes on an unconnected UART line are.
+static int serialFd = -1;
+static std::string serialPath;
+static std::mutex serialRxLock;
+static std::deque<uint8_t> serialRx;
+static size_t serialRxSize = SIM_SERIAL_RX_SIZE;
+static std::atomic<void (*)()> serialRxCallback{nullptr};
+
+static bool serialHostConnected() {
+    struct pollfd p = {serialFd, 0, 0};
+    return poll(&p, 1, 0) >= 0 && !(p.revents & POLLHUP);
+}
+
+static void serialReaderThread(void* arg) {
+    uint8_t chunk[256];
+    for (;;) {
+        size_t pending;
+        {
+            std::lock_guard<std::mutex> lock(serialRxLock);
+            pending = serialRx.size();
+        }
+        size_t space = serialRxSize > pending ? serialRxSize - pending : 0;
+        void (*callback)() = serialRxCallback;
+        if (space == 0) {
+            // The firmware left bytes behind; offer them again, as the next UART event would
+            if (callback) callback();
+            usleep(1000);
+            continue;
+        }
+        struct pollfd p = {serialFd, POLLIN, 0};
+        if (poll(&p, 1, SIM_SERIAL_POLL_MS) <= 0) {
+            // Bytes that arrived before onReceive() was set are not lost
+            if (pending && callback) callback();
+            continue;
+        }
+        if (p.revents & POLLHUP) {
+            usleep(SIM_SERIAL_POLL_MS * 1000);   // No host has the terminal open
+            continue;
+        }
+        ssize_t n = read(serialFd, chunk, std::min(space, sizeof(chunk)));
+        if (n <= 0) continue;
+        {
+            std::lock_guard<std::mutex> lock(serialRxLock);
+            serialRx.insert(serialRx.end(), chunk, chunk + n);
+        }
+        callback = serialRxCallback;
+        if (callback) callback();
+    }
+}
+
+int simSerialOpen(int masterFd) {
+    if (masterFd < 0) {
+        masterFd = posix_openpt(O_RDWR | O_NOCTTY);
+        if (masterFd < 0 || grantpt(masterFd) != 0 || unlockpt(masterFd) != 0) return -1;
+        // Raw from the start, so nothing is echoed or translated before the host opens it
+        int slave = open(ptsname(masterFd), O_RDWR | O_NOCTTY);
+        if (slave < 0) return -1;
+        struct termios tio;
+        tcgetattr(slave, &tio);
+        cfmakeraw(&tio);
+        tcsetattr(slave, TCSANOW, &tio);
+        close(slave);
+    }
+    fcntl(masterFd, F_SETFL, fcntl(masterFd, F_GETFL) | O_NONBLOCK);
+    serialFd = masterFd;
+    serialPath = ptsname(masterFd);
+    simStartThread("uart_event_task", serialReaderThread, nullptr);
+    return masterFd;
+}
+
+const char* simSerialPath() {
+    return serialPath.c_str();
+}
+
+size_t HardwareSerial::setRxBufferSize(size_t size) {
+    if (_uart == 0) {
+        std::lock_guard<std::mutex> lock(serialRxLock);
+        serialRxSize = size;
+    }
+    return size;
+}
+
+void HardwareSerial::onReceive(void (*callback)()) {
+    if (_uart == 0) serialRxCallback = callback;
+}
+
+int HardwareSerial::available() {
+    if (_uart != 0) return 0;
+    std::lock_guard<std::mutex> lock(serialRxLock);
+    return (int)serialRx.size();
+}
+
+int HardwareSerial::read() {
+    uint8_t c;
+    return readBytes(&c, 1) == 1 ? c : -1;
+}
+
+size_t HardwareSerial::readBytes(uint8_t* buffer, size_t length) {
+    if (_uart != 0) return 0;
+    std::lock_guard<std::mutex> lock(serialRxLock);
+    size_t n = std::min(length, serialRx.size());
+    std::copy(serialRx.begin(), serialRx.begin() + n, buffer);
+    serialRx.erase(serialRx.begin(), serialRx.begin() + n);
+    return n;
+}
+
+size_t HardwareSerial::write(const uint8_t* data, size_t length) {
+    if (_uart != 0) {
+        fwrite(data, 1, length, stdout);
+        fflush(stdout);
+        return length;
+    }
+    if (serialFd < 0) return length;   // No terminal (host benchmarks): discarded
+    size_t sent = 0;
+    while (sent < length) {
+        ssize_t n = ::write(serialFd, data + sent, length - sent);
+        if (n > 0) {
+            sent += n;
+            continue;
+        }
+        if (!serialHostConnected()) break;
+        struct pollfd p = {serialFd, POLLOUT, 0};
+        poll(&p, 1, SIM_SERIAL_POLL_MS);
+    }
+    return length;
+}
+
+// ---- ESP-IDF UART driver: loopback only ----
+struct SimUart {
+    bool installed;
+    bool loopback;
+    int baud;
+    size_t rxSize;
+    std::deque<uint8_t> rx;   // Guarded by simLock
+};
+
+static SimUart uarts[UART_NUM_MAX];
+
+esp_err_t uart_driver_install(uart_port_t port, int rxBufferSize, int txBufferSize, int queueSize,
+                              QueueHandle_t* queue, int intrAllocFlags) {
+    if (port < 0 || port >= UART_NUM_MAX || rxBufferSize <= 0) return ESP_ERR_INVALID_ARG;
+    std::lock_guard<std::mutex> lock(simLock);
+    if (uarts[port].installed) return ESP_FAIL;
+    uarts[port] = SimUart{true, false, 115200, (size_t)rxBufferSize, {}};
+    return ESP_OK;
+}
+
+esp_err_t uart_driver_delete(uart_port_t port) {
+    if (port < 0 || port >= UART_NUM_MAX) return ESP_ERR_INVALID_ARG;
+    std::lock_guard<std::mutex> lock(simLock);
+    uarts[port] = SimUart{};
+    return ESP_OK;
+}
+
+esp_err_t uart_param_config(uart_port_t port, const uart_config_t* config) {
+    if (port < 0 || port >= UART_NUM_MAX || config->baud_rate <= 0) return ESP_ERR_INVALID_ARG;
+    std::lock_guard<std::mutex> lock(simLock);
+    uarts[port].baud = config->baud_rate;
+    return ESP_OK;
+}
+
+esp_err_t uart_set_loop_back(uart_port_t port, bool enable) {
+    if (port < 0 || port >= UART_NUM_MAX) return ESP_ERR_INVALID_ARG;
+    std::lock_guard<std::mutex> lock(simLock);
+    uarts[port].loopback = enable;
+    return ESP_OK;
+}
+
+// Returns once the bytes are on the wire, 10 bits each; without loopback
+// they go nowhere
+int uart_write_bytes(uart_port_t port, const void* src, size_t size) {
+    if (port < 0 || port >= UART_NUM_MAX) return -1;
+    std::unique_lock<std::mutex> lock(simLock);
+    SimUart& uart = uarts[port];
+    if (!uart.installed) return -1;
+    simWaitUntil(lock, simNowUs() + (int64_t)size * 10 * 1000000 / uart.baud);
+    if (uart.loopback) {
+        const uint8_t* bytes = (const uint8_t*)src;
+        for (size_t i = 0; i < size && uart.rx.size() < uart.rxSize; i++) uart.rx.push_back(bytes[i]);
+        simCond.notify_all();
+    }
+    return (int)size;
+}
+
+int uart_read_bytes(uart_port_t port, void* buf, uint32_t length, TickType_t ticks) {
+    if (port < 0 || port >= UART_NUM_MAX) return -1;
+    std::unique_lock<std::mutex> lock(simLock);
+    SimUart& uart = uarts[port];
+    if (!uart.installed) return -1;
+    int64_t deadline = ticks == portMAX_DELAY ? -1 : simNowUs() + (int64_t)ticks * 1000000 / configTICK_RATE_HZ;
+    simWaitUntil(lock, deadline, [&uart] { return !uart.rx.empty(); });
+    size_t n = std::min((size_t)length, uart.rx.size());
+    std::copy(uart.rx.begin(), uart.rx.begin() + n, (uint8_t*)buf);
+    uart.rx.erase(uart.rx.begin(), uart.rx.begin() + n);
+    return (int)n;
+}
+
+// ---- ESP and heap ----
+void EspClass::restart() {
+    simRestart();
+}
+
+uint32_t EspClass::getFreeHeap() {
+    return SIM_HEAP_FREE;
+}
+
+uint32_t EspClass::getHeapSize() {
+    return SIM_HEAP_SIZE;
+}
+
+uint32_t EspClass::getMinFreeHeap() {
+    return SIM_HEAP_FREE;
+}
+
+uint32_t EspClass::getMaxAllocHeap() {
+    return SIM_HEAP_FREE;
+}
+
+size_t heap_caps_get_free_size(uint32_t caps) {
+    return caps & MALLOC_CAP_SPIRAM ? 0 : SIM_HEAP_FREE;
+}
+
+size_t heap_caps_get_minimum_free_size(uint32_t caps) {
+    return heap_caps_get_free_size(caps);
+}
+
+size_t heap_caps_get_largest_free_block(uint32_t caps) {
+    return heap_caps_get_free_size(caps);
+}
+
+void* heap_caps_malloc(size_t size, uint32_t caps) {
+    return caps & MALLOC_CAP_SPIRAM ? nullptr : malloc(size);
+}
+
+void heap_caps_free(void* ptr) {
+    free(ptr);
+}
+
+bool psramFound() {
+    return false;
+}
+
+void* ps_malloc(size_t size) {
+    return nullptr;
+}
+
+void esp_deep_sleep_start() {
+    fprintf(stderr, "sim: deep sleep\n");
+    _exit(0);
+}
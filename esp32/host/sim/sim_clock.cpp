@@ -0,0 +1,75 @@
+/*
+ * Virtual clock for the host simulator (see sim.h)
+ */
+
+#include <chrono>
+#include <cmath>
+
+#include "sim.h"
+
+using RealClock = std::chrono::steady_clock;
+
+std::mutex simLock;
+std::condition_variable simCond;
+
+// Rebased on every speed change and step, so virtual time never jumps back
+static std::mutex clockLock;
+static RealClock::time_point realBase = RealClock::now();
+static int64_t virtualBaseUs = 0;
+static double clockSpeed = 1.0;
+
+static int64_t nowLocked() {
+    double realUs = std::chrono::duration<double, std::micro>(RealClock::now() - realBase).count();
+    return virtualBaseUs + (int64_t)(realUs * clockSpeed);
+}
+
+static void rebaseLocked() {
+    virtualBaseUs = nowLocked();
+    realBase = RealClock::now();
+}
+
+// Waiters recompute their real timeouts against the new clock
+static void wakeWaiters() {
+    std::lock_guard<std::mutex> lock(simLock);
+    simCond.notify_all();
+}
+
+int64_t simNowUs() {
+    std::lock_guard<std::mutex> lock(clockLock);
+    return nowLocked();
+}
+
+double simSpeed() {
+    std::lock_guard<std::mutex> lock(clockLock);
+    return clockSpeed;
+}
+
+void simSetSpeed(double speed) {
+    {
+        std::lock_guard<std::mutex> lock(clockLock);
+        rebaseLocked();
+        clockSpeed = speed > 0 ? speed : 0;
+    }
+    wakeWaiters();
+}
+
+void simAdvanceUs(int64_t us) {
+    if (us <= 0) return;
+    {
+        std::lock_guard<std::mutex> lock(clockLock);
+        rebaseLocked();
+        virtualBaseUs += us;
+    }
+    wakeWaiters();
+}
+
+// Real time until the clock has moved virtualUs; -1 while it is frozen
+int64_t simRealWaitUs(int64_t virtualUs) {
+    double speed = simSpeed();
+    if (speed <= 0) return -1;
+    return (int64_t)std::ceil(virtualUs / speed);
+}
+
+bool simWaitUntil(std::unique_lock<std::mutex>& lock, int64_t deadlineUs) {
+    return simWaitUntil(lock, deadlineUs, [] { return false; });
+}
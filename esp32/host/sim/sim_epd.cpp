@@ -0,0 +1,308 @@
+/*
+ * SSD1683 e-paper controller on the simulated pins (see sim_epd.h)
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "frame_preview.h"
+#include "sim_epd.h"
+
+// BUSY durations, typical for the 4.2" V2 panel at room temperature
+#define EPD_HW_RESET_US     2000      // Internal reset after RST rises
+#define EPD_SW_RESET_US     10000     // 0x12
+// 0x20 runs the steps selected by the 0x22 bits, in order
+#define EPD_CLOCK_ON_US     1000      // 0x80
+#define EPD_ANALOG_ON_US    40000     // 0x40: booster soft start
+#define EPD_LOAD_TEMP_US    5000      // 0x20
+#define EPD_LOAD_LUT_US     20000     // 0x10
+#define EPD_DISPLAY_1_US    3400000   // 0x04: full waveform
+#define EPD_DISPLAY_2_US    600000    // 0x0C: fast / partial waveform
+#define EPD_ANALOG_OFF_US   10000     // 0x02
+
+#define EPD_PLANE_SIZE      (SIM_EPD_STRIDE * SIM_EPD_HEIGHT)
+
+SimEpd::SimEpd(const SimEpdPins& pins, const std::string& outDir)
+    : _pins(pins), _outDir(outDir) {
+    memset(_bw, 0, sizeof(_bw));
+    memset(_red, 0, sizeof(_red));
+    memset(_visible, 0xFF, sizeof(_visible));   // A blank (white) panel
+    // Number after the frames of a previous run, so a restart keeps them
+    while (!_outDir.empty()) {
+        char path[32];
+        snprintf(path, sizeof(path), "/epd-%04u.png", (unsigned)_nextIndex);
+        if (access((_outDir + path).c_str(), F_OK) != 0) break;
+        _nextIndex++;
+    }
+    simStartThread("epd_busy", busyThread, this);
+}
+
+SimEpdStats SimEpd::stats() {
+    std::lock_guard<std::mutex> lock(_panelLock);
+    return _stats;
+}
+
+// ---- Pins ----
+void SimEpd::pinWritten(int pin, int level) {
+    if (pin == _pins.sck) {
+        if (level && !_sck && !_cs) {
+            _shift = (uint8_t)(_shift << 1 | _din);
+            if (++_bits == 8) {
+                _bits = 0;
+                received(_shift, _dc);
+            }
+        }
+        _sck = level;
+    } else if (pin == _pins.din) {
+        _din = level;
+    } else if (pin == _pins.dc) {
+        _dc = level;
+    } else if (pin == _pins.cs) {
+        _cs = level;
+        if (level) _bits = 0;   // A byte cut short is dropped
+    } else if (pin == _pins.rst) {
+        if (!level) {
+            _inReset = true;
+        } else if (_inReset) {
+            _inReset = false;
+            if (_powered) hardwareReset();
+        }
+    } else if (pin == _pins.pwr) {
+        if (level && !_powered) {
+            powerOn();
+        } else if (!level && _powered) {
+            _powered = false;
+            if (_busyLevel) startBusy(0, false);   // BUSY falls with the supply
+        }
+    }
+}
+
+// ---- Controller ----
+void SimEpd::powerOn() {
+    _powered = true;
+    // RAM content is undefined at power-up; black, so an unwritten area shows
+    memset(_bw, 0, sizeof(_bw));
+    memset(_red, 0, sizeof(_red));
+    softwareReset();
+}
+
+void SimEpd::hardwareReset() {
+    softwareReset();
+    startBusy(EPD_HW_RESET_US, false);
+}
+
+// Registers to their defaults; RAM is kept
+void SimEpd::softwareReset() {
+    _sleeping = false;
+    _cmd = 0;
+    _dataIndex = 0;
+    _entryMode = 0x03;
+    _updateControl[0] = _updateControl[1] = 0x00;
+    _sequence = 0xFF;
+    _xStart = 0;
+    _xEnd = SIM_EPD_STRIDE - 1;
+    _yStart = 0;
+    _yEnd = SIM_EPD_HEIGHT - 1;
+    _x = _y = 0;
+}
+
+void SimEpd::received(uint8_t byte, bool data) {
+    if (!_powered || _inReset || _sleeping) return;   // Only a hardware reset wakes it
+    if (_busyLevel) {
+        fprintf(stderr, "sim: epd %s 0x%02X while BUSY\n", data ? "data" : "command", byte);
+    }
+    if (data) {
+        commandData(byte);
+        _dataIndex++;
+    } else {
+        _cmd = byte;
+        _dataIndex = 0;
+        command(byte);
+    }
+}
+
+void SimEpd::command(uint8_t cmd) {
+    switch (cmd) {
+        case 0x12:
+            softwareReset();
+            startBusy(EPD_SW_RESET_US, false);
+            break;
+        case 0x20:
+            activate();
+            break;
+        default:
+            break;
+    }
+}
+
+void SimEpd::commandData(uint8_t byte) {
+    switch (_cmd) {
+        case 0x10:   // Deep sleep: mode 1 (0x01) or 2 (0x03); 0x00 is normal mode
+            if (byte & 0x03) _sleeping = true;
+            break;
+        case 0x11:
+            _entryMode = byte & 0x07;
+            break;
+        case 0x21:
+            if (_dataIndex < 2) _updateControl[_dataIndex] = byte;
+            break;
+        case 0x22:
+            _sequence = byte;
+            break;
+        case 0x24:
+        case 0x26:
+            writeRam(byte);
+            break;
+        case 0x44:   // X window in bytes: start, end
+            if (_dataIndex == 0) _xStart = byte & 0x3F;
+            if (_dataIndex == 1) _xEnd = byte & 0x3F;
+            break;
+        case 0x45:   // Y window in lines: start, end, 9 bits little-endian each
+            if (_dataIndex == 0) _yStart = (_yStart & 0x100) | byte;
+            if (_dataIndex == 1) _yStart = (_yStart & 0xFF) | (byte & 0x01) << 8;
+            if (_dataIndex == 2) _yEnd = (_yEnd & 0x100) | byte;
+            if (_dataIndex == 3) _yEnd = (_yEnd & 0xFF) | (byte & 0x01) << 8;
+            break;
+        case 0x4E:
+            if (_dataIndex == 0) _x = byte & 0x3F;
+            break;
+        case 0x4F:
+            if (_dataIndex == 0) _y = (_y & 0x100) | byte;
+            if (_dataIndex == 1) _y = (_y & 0xFF) | (byte & 0x01) << 8;
+            break;
+        default:
+            break;
+    }
+}
+
+void SimEpd::writeRam(uint8_t byte) {
+    if (_x < SIM_EPD_STRIDE && _y < SIM_EPD_HEIGHT) {
+        (_cmd == 0x24 ? _bw : _red)[_y * SIM_EPD_STRIDE + _x] = byte;
+    }
+    stepCounters();
+}
+
+// Data entry mode (0x11): bit 0 X increments, bit 1 Y increments, bit 2
+// Y moves first. A counter leaving the window wraps to its start and
+// steps the other one.
+void SimEpd::stepCounters() {
+    auto step = [](int& v, int start, int end, bool inc) {
+        if (inc ? v >= end : v <= end) {
+            v = start;
+            return true;
+        }
+        v += inc ? 1 : -1;
+        return false;
+    };
+    bool xInc = _entryMode & 0x01, yInc = _entryMode & 0x02;
+    if (_entryMode & 0x04) {
+        if (step(_y, _yStart, _yEnd, yInc)) step(_x, _xStart, _xEnd, xInc);
+    } else {
+        if (step(_x, _xStart, _xEnd, xInc)) step(_y, _yStart, _yEnd, yInc);
+    }
+}
+
+// Master activation: run the 0x22 sequence, with BUSY high throughout
+void SimEpd::activate() {
+    uint32_t us = 0;
+    if (_sequence & 0x80) us += EPD_CLOCK_ON_US;
+    if (_sequence & 0x40) us += EPD_ANALOG_ON_US;
+    if (_sequence & 0x20) us += EPD_LOAD_TEMP_US;
+    if (_sequence & 0x10) us += EPD_LOAD_LUT_US;
+    bool display = _sequence & 0x04;
+    if (display) us += _sequence & 0x08 ? EPD_DISPLAY_2_US : EPD_DISPLAY_1_US;
+    if (_sequence & 0x02) us += EPD_ANALOG_OFF_US;
+
+    if (display) {
+        // B/W panel: the glass shows the B/W plane through the 0x21 option
+        // (low nibble: 0 normal, 4 bypass as 0, 8 inverse); the red plane only
+        // feeds the waveform, so it does not show
+        uint8_t option = _updateControl[0] & 0x0F;
+        std::lock_guard<std::mutex> lock(_panelLock);
+        _refreshSequence = _sequence;
+        for (int i = 0; i < EPD_PLANE_SIZE; i++) {
+            _visible[i] = option == 0x04 ? 0x00 : option == 0x08 ? (uint8_t)~_bw[i] : _bw[i];
+        }
+    }
+    startBusy(us, display);
+}
+
+// ---- BUSY ----
+// Raises BUSY for us of virtual time; 0 drops it at once. Replaces any
+// operation still running.
+void SimEpd::startBusy(uint32_t us, bool refresh) {
+    bool level = us > 0;
+    {
+        std::lock_guard<std::mutex> lock(simLock);
+        _busy = level;
+        _busyRefresh = refresh;
+        _busyStartUs = simNowUs();
+        _busyUntilUs = _busyStartUs + us;
+        _busyGen++;
+        _busyLevel = level;
+        simCond.notify_all();
+    }
+    simPinChanged(_pins.busy, level ? 1 : 0);
+}
+
+void SimEpd::busyThread(void* arg) {
+    SimEpd* epd = (SimEpd*)arg;
+    std::unique_lock<std::mutex> lock(simLock);
+    for (;;) {
+        simWaitUntil(lock, -1, [&] { return epd->_busy; });
+        uint32_t gen = epd->_busyGen;
+        if (simWaitUntil(lock, epd->_busyUntilUs, [&] { return epd->_busyGen != gen; })) {
+            continue;   // Replaced by a reset or a power-off
+        }
+        uint32_t busyMs = (uint32_t)((epd->_busyUntilUs - epd->_busyStartUs) / 1000);
+        if (epd->_busyRefresh) {
+            // The image is out before BUSY falls, so the firmware never sees
+            // an idle panel without its frame
+            lock.unlock();
+            epd->refreshDone(busyMs);
+            lock.lock();
+            if (epd->_busyGen != gen) continue;
+        }
+        epd->_busy = false;
+        epd->_busyLevel = false;
+        lock.unlock();
+        simPinChanged(epd->_pins.busy, 0);
+        lock.lock();
+    }
+}
+
+static void fileSink(void* ctx, const uint8_t* data, size_t length) {
+    fwrite(data, 1, length, (FILE*)ctx);
+}
+
+void SimEpd::refreshDone(uint32_t busyMs) {
+    std::lock_guard<std::mutex> lock(_panelLock);
+    _stats.refreshes++;
+    _stats.lastSequence = _refreshSequence;
+    _stats.lastBusyMs = busyMs;
+    std::string written;
+    if (!_outDir.empty()) {
+        char name[32];
+        snprintf(name, sizeof(name), "/epd-%04u.png", (unsigned)_nextIndex++);
+        std::string path = _outDir + name;
+        std::string partial = path + ".part";
+        FILE* f = fopen(partial.c_str(), "wb");
+        if (f) {
+            FramePreview preview(PREVIEW_PNG, SIM_EPD_WIDTH, SIM_EPD_HEIGHT, fileSink, f);
+            preview.begin();
+            for (uint16_t i = 0; i < SIM_EPD_HEIGHT; i++) {
+                preview.row(_visible + preview.rowAt(i) * SIM_EPD_STRIDE);
+            }
+            preview.end();
+        }
+        // Renamed complete, so a reader never sees half an image
+        if (f && fclose(f) == 0 && rename(partial.c_str(), path.c_str()) == 0) {
+            _stats.lastPng = written = path;
+        } else {
+            fprintf(stderr, "sim: cannot write %s\n", path.c_str());
+        }
+    }
+    fprintf(stderr, "sim: epd refresh 0x%02X %u ms%s%s\n", _stats.lastSequence, (unsigned)busyMs,
+            written.empty() ? "" : " -> ", written.c_str());
+}
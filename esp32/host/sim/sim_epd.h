@@ -0,0 +1,107 @@
+#ifndef SIM_EPD_H
+#define SIM_EPD_H
+
+/*
+ * The 4.2" V2 e-paper panel (SSD1683 controller) as a simulated device.
+ *
+ * It decodes the bit-banged SPI the firmware produces (CS, DC, SCK, DIN;
+ * MSB first, one byte per CS pulse), keeps the controller's two RAM
+ * planes with their address window, counters and data entry mode, and
+ * drives BUSY for as long as each operation takes on the virtual clock.
+ * After every refresh the visible panel is written out as a PNG.
+ *
+ * Commands: 0x10 deep sleep, 0x11 data entry mode, 0x12 SW reset,
+ * 0x20 master activation, 0x21 display update control 1, 0x22 display
+ * update sequence, 0x24/0x26 write B/W and red RAM, 0x44/0x45 RAM window,
+ * 0x4E/0x4F RAM counters. Others are accepted and their data ignored.
+ */
+
+#include <stdint.h>
+#include <atomic>
+#include <mutex>
+#include <string>
+
+#include "sim.h"
+
+#define SIM_EPD_WIDTH   400
+#define SIM_EPD_HEIGHT  300
+#define SIM_EPD_STRIDE  (SIM_EPD_WIDTH / 8)
+
+struct SimEpdPins {
+    int sck, din, cs, dc, rst, busy, pwr;
+};
+
+// The firmware's EPD pins, defined next to the sketch (firmware.cpp)
+extern const SimEpdPins simFirmwareEpdPins;
+
+// What the last refreshes looked like, for the control channel
+struct SimEpdStats {
+    uint32_t refreshes;
+    uint8_t lastSequence;       // 0x22 value of the last refresh
+    uint32_t lastBusyMs;        // Virtual time BUSY was high for it
+    std::string lastPng;        // Empty without an output directory
+};
+
+class SimEpd : public SimDevice {
+public:
+    // outDir: where epd-NNNN.png files go; empty for none
+    SimEpd(const SimEpdPins& pins, const std::string& outDir);
+
+    void pinWritten(int pin, int level) override;
+    bool drivesPin(int pin) const override { return pin == _pins.busy; }
+    int pinLevel(int pin) override { return _busyLevel ? 1 : 0; }
+
+    SimEpdStats stats();
+
+private:
+    void powerOn();
+    void hardwareReset();
+    void softwareReset();
+    void received(uint8_t byte, bool data);
+    void command(uint8_t cmd);
+    void commandData(uint8_t byte);
+    void writeRam(uint8_t byte);
+    void stepCounters();
+    void activate();
+    void startBusy(uint32_t us, bool refresh);
+    static void busyThread(void* arg);
+    void refreshDone(uint32_t busyMs);
+
+    const SimEpdPins _pins;
+    const std::string _outDir;
+    uint32_t _nextIndex = 0;
+
+    // Pin levels and the byte being shifted in (firmware threads only)
+    bool _powered = false, _inReset = false;
+    int _din = 0, _dc = 0, _cs = 1, _sck = 0;
+    uint8_t _shift = 0;
+    int _bits = 0;
+
+    // Controller state (firmware threads only)
+    bool _sleeping = false;
+    uint8_t _cmd = 0;
+    int _dataIndex = 0;
+    uint8_t _entryMode = 0x03;      // Y increment, X increment, X first
+    uint8_t _updateControl[2] = {0x00, 0x00};
+    uint8_t _sequence = 0xFF;
+    int _xStart = 0, _xEnd = SIM_EPD_STRIDE - 1;
+    int _yStart = 0, _yEnd = SIM_EPD_HEIGHT - 1;
+    int _x = 0, _y = 0;
+    uint8_t _bw[SIM_EPD_STRIDE * SIM_EPD_HEIGHT];
+    uint8_t _red[SIM_EPD_STRIDE * SIM_EPD_HEIGHT];
+
+    // BUSY, under simLock; the level alone is read lock-free by digitalRead()
+    std::atomic<bool> _busyLevel{false};
+    bool _busy = false;
+    bool _busyRefresh = false;
+    int64_t _busyStartUs = 0, _busyUntilUs = 0;
+    uint32_t _busyGen = 0;
+
+    // The image a refresh puts on the glass, and the statistics
+    std::mutex _panelLock;
+    uint8_t _visible[SIM_EPD_STRIDE * SIM_EPD_HEIGHT];
+    uint8_t _refreshSequence = 0;
+    SimEpdStats _stats = {};
+};
+
+#endif // SIM_EPD_H
@@ -0,0 +1,81 @@
+/*
+ * esp_http_server without a server (see esp_http_server.h). No request
+ * reaches a handler, so the request and response calls only need to exist.
+ */
+
+#include "esp_http_server.h"
+
+static int serverHandle;
+
+esp_err_t httpd_start(httpd_handle_t* handle, const httpd_config_t* config) {
+    *handle = &serverHandle;
+    return ESP_OK;
+}
+
+esp_err_t httpd_register_uri_handler(httpd_handle_t handle, const httpd_uri_t* uri_handler) {
+    return ESP_OK;
+}
+
+esp_err_t httpd_queue_work(httpd_handle_t handle, httpd_work_fn_t work, void* arg) {
+    return ESP_ERR_INVALID_STATE;   // No server task to run it
+}
+
+esp_err_t httpd_sess_trigger_close(httpd_handle_t handle, int sockfd) {
+    return ESP_ERR_NOT_FOUND;
+}
+
+int httpd_req_to_sockfd(httpd_req_t* r) {
+    return -1;
+}
+
+int httpd_req_recv(httpd_req_t* r, char* buf, size_t buf_len) {
+    return HTTPD_SOCK_ERR_FAIL;
+}
+
+esp_err_t httpd_req_get_hdr_value_str(httpd_req_t* r, const char* field, char* val, size_t val_size) {
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t httpd_req_get_url_query_str(httpd_req_t* r, char* buf, size_t buf_len) {
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t httpd_query_key_value(const char* qry, const char* key, char* val, size_t val_size) {
+    return ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t httpd_resp_set_status(httpd_req_t* r, const char* status) {
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_type(httpd_req_t* r, const char* type) {
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_set_hdr(httpd_req_t* r, const char* field, const char* value) {
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_send(httpd_req_t* r, const char* buf, ssize_t buf_len) {
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_send_chunk(httpd_req_t* r, const char* buf, ssize_t buf_len) {
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_sendstr(httpd_req_t* r, const char* str) {
+    return ESP_OK;
+}
+
+esp_err_t httpd_resp_send_err(httpd_req_t* req, httpd_err_code_t error, const char* msg) {
+    return ESP_OK;
+}
+
+esp_err_t httpd_ws_recv_frame(httpd_req_t* req, httpd_ws_frame_t* pkt, size_t max_len) {
+    return ESP_FAIL;
+}
+
+esp_err_t httpd_ws_send_frame_async(httpd_handle_t hd, int fd, httpd_ws_frame_t* frame) {
+    return ESP_FAIL;
+}
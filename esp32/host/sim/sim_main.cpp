@@ -0,0 +1,158 @@
+/*
+ * Host simulator entry point: boots the firmware the way the Arduino core
+ * does (setup() then loop() on loopTask) and takes control commands on
+ * stdin. See esp32/README.md, "Host Simulator".
+ *
+ *   firmware_sim [--speed X] [--link PATH] [--port-offset N] [--epd-dir DIR]
+ *
+ * The first stdout line is "pty <path>", the terminal to open as the
+ * serial port. Commands, one per line, each answered by one line:
+ *   time           -> time <virtual us since boot>
+ *   speed X        -> speed X       (0 freezes the clock)
+ *   advance MS     -> time <us>     (steps the clock, timers fire on the way)
+ *   pwm            -> pwm <pin>=<duty> ...  (every PWM pin)
+ *   epd            -> epd refreshes=N sequence=0xSS busy_ms=MS png=PATH|-
+ *   quit
+ */
+
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+
+#include "Arduino.h"
+#include "sim.h"
+#include "sim_epd.h"
+
+void setup();
+void loop();
+
+static std::vector<std::string> simArgs;   // Without --pty-fd, for simRestart()
+static int ptyFd = -1;
+static SimEpd* epd;
+
+static void usage(const char* argv0) {
+    fprintf(stderr, "usage: %s [--speed X] [--link PATH] [--port-offset N] [--epd-dir DIR]\n", argv0);
+    exit(2);
+}
+
+static void loopTask(void* arg) {
+    setup();
+    for (;;) loop();
+}
+
+void simRestart() {
+    fprintf(stderr, "sim: restart\n");
+    std::vector<std::string> args = simArgs;
+    args.push_back("--speed");
+    args.push_back(std::to_string(simSpeed()));
+    args.push_back("--pty-fd");
+    args.push_back(std::to_string(ptyFd));
+    std::vector<char*> argv;
+    for (std::string& a : args) argv.push_back(&a[0]);
+    argv.push_back(nullptr);
+    fflush(stdout);
+    execv("/proc/self/exe", argv.data());
+    fprintf(stderr, "sim: restart failed: %s\n", strerror(errno));
+    _exit(1);
+}
+
+static void command(char* line) {
+    char* arg = strchr(line, ' ');
+    if (arg) *arg++ = '\0';
+    if (strcmp(line, "time") == 0) {
+        printf("time %lld\n", (long long)simNowUs());
+    } else if (strcmp(line, "speed") == 0 && arg) {
+        simSetSpeed(atof(arg));
+        printf("speed %g\n", simSpeed());
+    } else if (strcmp(line, "advance") == 0 && arg) {
+        simAdvanceUs((int64_t)(atof(arg) * 1000));
+        printf("time %lld\n", (long long)simNowUs());
+    } else if (strcmp(line, "pwm") == 0) {
+        printf("pwm");
+        for (int pin = 0; pin < 64; pin++) {
+            int duty = simPwmDuty(pin);
+            if (duty >= 0) printf(" %d=%d", pin, duty);
+        }
+        printf("\n");
+    } else if (strcmp(line, "epd") == 0) {
+        SimEpdStats stats = epd->stats();
+        printf("epd refreshes=%u sequence=0x%02X busy_ms=%u png=%s\n", (unsigned)stats.refreshes,
+               stats.lastSequence, (unsigned)stats.lastBusyMs,
+               stats.lastPng.empty() ? "-" : stats.lastPng.c_str());
+    } else if (strcmp(line, "quit") == 0) {
+        fflush(stdout);
+        _exit(0);
+    } else {
+        printf("error unknown command\n");
+    }
+    fflush(stdout);
+}
+
+int main(int argc, char** argv) {
+    const char* link = nullptr;
+    const char* epdDir = "";
+    double speed = 1.0;
+    simArgs.push_back(argv[0]);
+    for (int i = 1; i < argc; i++) {
+        const char* a = argv[i];
+        if (i + 1 >= argc) usage(argv[0]);
+        const char* value = argv[++i];
+        if (strcmp(a, "--pty-fd") == 0) {
+            ptyFd = atoi(value);
+            continue;
+        }
+        if (strcmp(a, "--speed") == 0) {
+            speed = atof(value);
+            continue;   // simRestart() passes the current speed
+        }
+        if (strcmp(a, "--link") == 0) {
+            link = value;
+        } else if (strcmp(a, "--port-offset") == 0) {
+            simPortOffset = atoi(value);
+        } else if (strcmp(a, "--epd-dir") == 0) {
+            epdDir = value;
+        } else {
+            usage(argv[0]);
+        }
+        simArgs.push_back(a);
+        simArgs.push_back(value);
+    }
+
+    signal(SIGPIPE, SIG_IGN);
+    setvbuf(stdout, nullptr, _IOLBF, 0);
+    simSetSpeed(speed);
+
+    bool restarted = ptyFd >= 0;
+    ptyFd = simSerialOpen(ptyFd);
+    if (ptyFd < 0) {
+        fprintf(stderr, "sim: cannot open a pseudo-terminal: %s\n", strerror(errno));
+        return 1;
+    }
+    if (link && !restarted) {
+        unlink(link);
+        if (symlink(simSerialPath(), link) != 0) {
+            fprintf(stderr, "sim: cannot link %s: %s\n", link, strerror(errno));
+            return 1;
+        }
+    }
+    printf("pty %s\n", link ? link : simSerialPath());
+
+    epd = new SimEpd(simFirmwareEpdPins, epdDir);
+    simAttachDevice(epd);
+
+    // As the Arduino core does: loopTask on core 1
+    xTaskCreatePinnedToCore(loopTask, "loopTask", 8192, nullptr, 1, nullptr, 1);
+
+    char line[128];
+    while (fgets(line, sizeof(line), stdin)) {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0]) command(line);
+    }
+    // No controller: keep running until killed
+    for (;;) pause();
+}
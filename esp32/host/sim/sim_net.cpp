@@ -0,0 +1,24 @@
+/*
+ * lwIP on the host: the firmware's sockets are host sockets, with
+ * privileged ports moved out of the way (see lwip/sockets.h)
+ */
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include "sim.h"
+
+#define SIM_PORT_OFFSET_DEFAULT 10000   // Captive DNS: 53 -> 10053
+
+int simPortOffset = SIM_PORT_OFFSET_DEFAULT;
+
+// bind() from the firmware
+int lwip_bind(int s, const struct sockaddr* name, socklen_t namelen) {
+    if (name->sa_family == AF_INET && namelen >= sizeof(struct sockaddr_in)) {
+        struct sockaddr_in addr = *(const struct sockaddr_in*)name;
+        uint16_t port = ntohs(addr.sin_port);
+        if (port > 0 && port < 1024) addr.sin_port = htons(port + simPortOffset);
+        return bind(s, (const struct sockaddr*)&addr, sizeof(addr));
+    }
+    return bind(s, name, namelen);
+}
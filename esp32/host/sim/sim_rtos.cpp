@@ -0,0 +1,222 @@
+/*
+ * FreeRTOS tasks, notifications, queues and mutexes on host threads
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <deque>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "sim.h"
+
+struct SimTask {
+    std::string name;
+    uint32_t stackDepth;
+    BaseType_t core;
+    uint32_t notifyValue;   // Guarded by simLock
+};
+
+struct SimQueue {
+    size_t itemSize;
+    size_t length;
+    std::deque<std::vector<uint8_t>> items;   // Guarded by simLock
+};
+
+static std::vector<SimTask*> tasks;   // Guarded by simLock
+static thread_local SimTask* currentTask = nullptr;
+static thread_local bool inIsr = false;
+
+// Virtual deadline of a timed wait, -1 for portMAX_DELAY
+static int64_t deadlineFor(TickType_t ticks) {
+    if (ticks == portMAX_DELAY) return -1;
+    return simNowUs() + (int64_t)ticks * 1000000 / configTICK_RATE_HZ;
+}
+
+static SimTask* startTask(const char* name, uint32_t stackDepth, BaseType_t core,
+                          void (*fn)(void*), void* arg) {
+    SimTask* task = new SimTask{name, stackDepth, core, 0};
+    {
+        std::lock_guard<std::mutex> lock(simLock);
+        tasks.push_back(task);
+    }
+    std::thread([task, fn, arg] {
+        currentTask = task;
+        fn(arg);
+        fprintf(stderr, "sim: task %s returned\n", task->name.c_str());
+        abort();   // FreeRTOS tasks must not return
+    }).detach();
+    return task;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t stackDepth, void* arg,
+                                   UBaseType_t priority, TaskHandle_t* handle, BaseType_t core) {
+    SimTask* task = startTask(name, stackDepth, core, fn, arg);
+    if (handle) *handle = task;
+    return pdPASS;
+}
+
+void simStartThread(const char* name, void (*fn)(void*), void* arg) {
+    startTask(name, 0, 0, fn, arg);
+}
+
+// The thread cannot be stopped from outside, so a task may only delete
+// or suspend itself, which parks its thread for good
+static void parkSelf(TaskHandle_t task, const char* what) {
+    if (task && task != currentTask) {
+        fprintf(stderr, "sim: %s of another task is not simulated\n", what);
+        abort();
+    }
+    std::unique_lock<std::mutex> lock(simLock);
+    simWaitUntil(lock, -1);
+}
+
+void vTaskDelete(TaskHandle_t task) {
+    parkSelf(task, "vTaskDelete");
+}
+
+void vTaskSuspend(TaskHandle_t task) {
+    parkSelf(task, "vTaskSuspend");
+}
+
+void vTaskDelay(TickType_t ticks) {
+    std::unique_lock<std::mutex> lock(simLock);
+    simWaitUntil(lock, deadlineFor(ticks));
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+    return currentTask;
+}
+
+TaskHandle_t xTaskGetHandle(const char* name) {
+    std::lock_guard<std::mutex> lock(simLock);
+    for (SimTask* task : tasks) {
+        if (task->name == name) return task;
+    }
+    return nullptr;
+}
+
+TickType_t xTaskGetTickCount() {
+    return (TickType_t)(simNowUs() * configTICK_RATE_HZ / 1000000);
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) {
+    return task ? task->stackDepth : 0;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks) {
+    SimTask* self = currentTask;
+    std::unique_lock<std::mutex> lock(simLock);
+    if (!simWaitUntil(lock, deadlineFor(ticks), [self] { return self->notifyValue > 0; })) return 0;
+    uint32_t value = self->notifyValue;
+    self->notifyValue = clearOnExit ? 0 : value - 1;
+    return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    std::lock_guard<std::mutex> lock(simLock);
+    task->notifyValue++;
+    simCond.notify_all();
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* woken) {
+    xTaskNotifyGive(task);
+    if (woken) *woken = pdTRUE;
+}
+
+BaseType_t xPortInIsrContext() {
+    return inIsr;
+}
+
+BaseType_t xPortGetCoreID() {
+    return currentTask ? currentTask->core : 0;
+}
+
+bool simInIsr() {
+    return inIsr;
+}
+
+void simRunIsr(void (*handler)()) {
+    bool nested = inIsr;
+    inIsr = true;
+    handler();
+    inIsr = nested;
+}
+
+// ---- Queues ----
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+    return new SimQueue{itemSize, length, {}};
+}
+
+static BaseType_t queuePut(QueueHandle_t queue, const void* item, TickType_t ticks, bool front) {
+    std::unique_lock<std::mutex> lock(simLock);
+    if (!simWaitUntil(lock, deadlineFor(ticks), [queue] { return queue->items.size() < queue->length; })) {
+        return pdFAIL;
+    }
+    const uint8_t* bytes = (const uint8_t*)item;
+    std::vector<uint8_t> copy(bytes, bytes + queue->itemSize);
+    if (front) {
+        queue->items.push_front(std::move(copy));
+    } else {
+        queue->items.push_back(std::move(copy));
+    }
+    simCond.notify_all();
+    return pdPASS;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks) {
+    return queuePut(queue, item, ticks, false);
+}
+
+BaseType_t xQueueSendToFront(QueueHandle_t queue, const void* item, TickType_t ticks) {
+    return queuePut(queue, item, ticks, true);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t ticks) {
+    std::unique_lock<std::mutex> lock(simLock);
+    if (!simWaitUntil(lock, deadlineFor(ticks), [queue] { return !queue->items.empty(); })) {
+        return pdFAIL;
+    }
+    if (queue->itemSize) memcpy(item, queue->items.front().data(), queue->itemSize);
+    queue->items.pop_front();
+    simCond.notify_all();
+    return pdPASS;
+}
+
+BaseType_t xQueueReset(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> lock(simLock);
+    queue->items.clear();
+    simCond.notify_all();
+    return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+    std::lock_guard<std::mutex> lock(simLock);
+    return (UBaseType_t)queue->items.size();
+}
+
+// ---- Mutexes ----
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+    SimQueue* mutex = new SimQueue{0, 1, {}};
+    mutex->items.emplace_back();
+    return mutex;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary() {
+    return new SimQueue{0, 1, {}};
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks) {
+    return xQueueReceive(semaphore, nullptr, ticks);
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+    return xQueueSend(semaphore, nullptr, 0);
+}
@@ -0,0 +1,159 @@
+/*
+ * Host stress run and throughput benchmark for spsc.h
+ *
+ * Build with ThreadSanitizer (see esp32/README.md, "Host Tools"):
+ *   g++ -std=c++17 -O1 -g -fsanitize=thread -pthread \
+ *       -I../esp32_firmware spsc_bench.cpp -o spsc_bench
+ *
+ * Every run verifies ordering and value integrity while it measures, and
+ * exits non-zero on the first violation.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "spsc.h"
+
+using Clock = std::chrono::steady_clock;
+
+static int failures = 0;
+
+static void fail(const char* what, unsigned long long expected, unsigned long long got) {
+    fprintf(stderr, "FAIL %s: expected %llu, got %llu\n", what, expected, got);
+    failures++;
+}
+
+static double secondsSince(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// One item at a time, both sides spinning
+static void benchSingle(uint64_t count) {
+    static SpscRing<uint64_t, 1024> ring;
+    Clock::time_point start = Clock::now();
+
+    std::thread producer([&] {
+        for (uint64_t i = 0; i < count; i++) {
+            while (!ring.push(i)) std::this_thread::yield();
+        }
+    });
+
+    uint64_t next = 0, value;
+    while (next < count) {
+        if (ring.pop(value)) {
+            if (value != next) { fail("single order", next, value); break; }
+            next++;
+        }
+    }
+    producer.join();
+
+    double s = secondsSince(start);
+    printf("ring single   %10llu items  %8.2f Mitems/s\n",
+           (unsigned long long)count, count / s / 1e6);
+}
+
+// Bulk transfers of uneven sizes, like UART chunks
+static void benchBulk(uint64_t count) {
+    static SpscRing<uint8_t, 4096> ring;
+    Clock::time_point start = Clock::now();
+
+    std::thread producer([&] {
+        uint8_t chunk[97];
+        uint64_t sent = 0;
+        while (sent < count) {
+            size_t n = (size_t)std::min<uint64_t>(sizeof(chunk), count - sent);
+            for (size_t i = 0; i < n; i++) chunk[i] = (uint8_t)(sent + i);
+            size_t done = 0;
+            while (done < n) {
+                done += ring.pushN(chunk + done, n - done);
+                if (done < n) std::this_thread::yield();
+            }
+            sent += n;
+        }
+    });
+
+    uint8_t chunk[64];
+    uint64_t received = 0;
+    while (received < count) {
+        size_t n = ring.popN(chunk, sizeof(chunk));
+        for (size_t i = 0; i < n; i++) {
+            if (chunk[i] != (uint8_t)(received + i)) {
+                fail("bulk order", (uint8_t)(received + i), chunk[i]);
+                received = count;
+                break;
+            }
+        }
+        received += n;
+    }
+    producer.join();
+
+    double s = secondsSince(start);
+    printf("ring bulk     %10llu bytes  %8.2f MB/s\n",
+           (unsigned long long)count, count / s / 1e6);
+}
+
+// One writer, several readers; every read must be a whole value
+struct Sample {
+    uint32_t seq;
+    uint32_t inverted;
+    uint32_t tripled;
+};
+
+static void benchMailbox(uint32_t count, int readers) {
+    static Mailbox<Sample> box;
+    std::atomic<bool> done{false};
+    std::vector<std::thread> threads;
+    std::atomic<uint64_t> reads{0};
+    Clock::time_point start = Clock::now();
+
+    for (int r = 0; r < readers; r++) {
+        threads.emplace_back([&] {
+            Sample s;
+            uint32_t last = 0;
+            uint64_t local = 0;
+            while (!done.load(std::memory_order_relaxed)) {
+                if (!box.read(s)) continue;
+                if (s.inverted != ~s.seq || s.tripled != s.seq * 3) {
+                    fail("mailbox torn read", s.seq, s.inverted);
+                    break;
+                }
+                if (s.seq < last) { fail("mailbox went backwards", last, s.seq); break; }
+                last = s.seq;
+                local++;
+            }
+            reads += local;
+        });
+    }
+
+    for (uint32_t i = 1; i <= count; i++) {
+        box.publish(Sample{i, ~i, i * 3});
+    }
+    done = true;
+    for (std::thread& t : threads) t.join();
+
+    if (box.version() != count) fail("mailbox version", count, box.version());
+
+    double s = secondsSince(start);
+    printf("mailbox       %10u writes %8.2f Mwrites/s, %llu reads by %d readers\n",
+           count, count / s / 1e6, (unsigned long long)reads.load(), readers);
+}
+
+int main(int argc, char** argv) {
+    // Scale down under sanitizers: ./spsc_bench 0.05
+    double scale = argc > 1 ? atof(argv[1]) : 1.0;
+    if (scale <= 0) scale = 1.0;
+
+    benchSingle((uint64_t)(20000000 * scale));
+    benchBulk((uint64_t)(200000000 * scale));
+    benchMailbox((uint32_t)(5000000 * scale), 3);
+
+    if (failures) {
+        fprintf(stderr, "%d failure(s)\n", failures);
+        return 1;
+    }
+    printf("OK\n");
+    return 0;
+}
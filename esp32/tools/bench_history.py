@@ -0,0 +1,131 @@
+"""Run the host benchmarks, keep their history and flag regressions.
+
+Runs firmware_bench (esp32/host, Google Benchmark), appends the results
+to a JSON-lines history file, and compares each benchmark's CPU time with
+the median of the last few runs recorded on the same machine. Exits with
+status 1 if any benchmark got slower by more than the threshold.
+
+Run from the repository root:
+    python esp32/tools/bench_history.py build/host/firmware_bench
+    python esp32/tools/bench_history.py build/host/firmware_bench \\
+        --threshold 5 -- --benchmark_filter=CRC --benchmark_repetitions=5
+
+Arguments after -- go to the benchmark binary. With repetitions, the
+median of each benchmark is what is recorded.
+"""
+import argparse
+import json
+import os
+import platform
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+from typing import Dict, List
+
+DEFAULT_HISTORY = "bench_history.jsonl"
+DEFAULT_THRESHOLD = 10.0  # Percent slower than the baseline
+DEFAULT_WINDOW = 5        # Previous runs the baseline is the median of
+
+
+def run_benchmarks(binary: str, extra: List[str]) -> Dict[str, dict]:
+    """Run the binary; results by benchmark name, CPU time in ns."""
+    with tempfile.NamedTemporaryFile(suffix=".json", delete=False) as f:
+        out_path = f.name
+    try:
+        subprocess.run([binary, f"--benchmark_out={out_path}", "--benchmark_out_format=json"] + extra,
+                       check=True)
+        with open(out_path) as f:
+            report = json.load(f)
+    finally:
+        os.unlink(out_path)
+
+    repeated = any(b.get("run_type") == "aggregate" for b in report["benchmarks"])
+    results = {}
+    for b in report["benchmarks"]:
+        if b.get("error_occurred"):
+            raise SystemExit(f"{b['name']}: {b.get('error_message', 'failed')}")
+        if repeated and b.get("aggregate_name") != "median":
+            continue
+        name = b.get("run_name", b["name"])
+        scale = {"ns": 1, "us": 1e3, "ms": 1e6, "s": 1e9}[b.get("time_unit", "ns")]
+        entry = {"cpu_ns": b["cpu_time"] * scale}
+        for counter in ("per_byte", "pixels", "frames", "bytes_per_second"):
+            if counter in b:
+                entry[counter] = b[counter]
+        results[name] = entry
+    return results
+
+
+def git_revision() -> str:
+    try:
+        return subprocess.run(["git", "describe", "--always", "--dirty"], capture_output=True,
+                              text=True, check=True).stdout.strip()
+    except (OSError, subprocess.CalledProcessError):
+        return ""
+
+
+def load_history(path: str) -> List[dict]:
+    if not os.path.exists(path):
+        return []
+    with open(path) as f:
+        return [json.loads(line) for line in f if line.strip()]
+
+
+def compare(results: Dict[str, dict], history: List[dict], window: int,
+            threshold: float) -> List[str]:
+    """Print each benchmark against its baseline; names of the regressions."""
+    host = platform.node()
+    previous = [run for run in history if run.get("host") == host][-window:]
+    regressions = []
+    print(f"\n{'Benchmark':<36} {'CPU':>12} {'Baseline':>12} {'Change':>8}")
+    for name, entry in results.items():
+        times = [run["results"][name]["cpu_ns"] for run in previous if name in run["results"]]
+        if not times:
+            print(f"{name:<36} {entry['cpu_ns']:>10.0f}ns {'-':>12} {'new':>8}")
+            continue
+        baseline = statistics.median(times)
+        change = (entry["cpu_ns"] / baseline - 1) * 100
+        flag = ""
+        if change > threshold:
+            regressions.append(name)
+            flag = "  REGRESSION"
+        print(f"{name:<36} {entry['cpu_ns']:>10.0f}ns {baseline:>10.0f}ns {change:>+7.1f}%{flag}")
+    return regressions
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("binary", help="firmware_bench executable")
+    parser.add_argument("--history", default=DEFAULT_HISTORY,
+                        help=f"JSON-lines history file (default {DEFAULT_HISTORY})")
+    parser.add_argument("--threshold", type=float, default=DEFAULT_THRESHOLD,
+                        help=f"percent slower that fails (default {DEFAULT_THRESHOLD:g})")
+    parser.add_argument("--window", type=int, default=DEFAULT_WINDOW,
+                        help=f"previous runs in the baseline median (default {DEFAULT_WINDOW})")
+    parser.add_argument("--no-record", action="store_true",
+                        help="compare only, do not append this run to the history")
+    argv = sys.argv[1:]
+    extra = argv[argv.index("--") + 1:] if "--" in argv else []
+    args = parser.parse_args(argv[:len(argv) - len(extra) - (1 if "--" in argv else 0)])
+
+    results = run_benchmarks(args.binary, extra)
+    history = load_history(args.history)
+    regressions = compare(results, history, args.window, args.threshold)
+
+    if not args.no_record:
+        run = {"time": time.strftime("%Y-%m-%dT%H:%M:%S%z"), "revision": git_revision(),
+               "host": platform.node(), "results": results}
+        with open(args.history, "a") as f:
+            f.write(json.dumps(run) + "\n")
+
+    if regressions:
+        print(f"\n{len(regressions)} benchmark(s) more than {args.threshold:g}% slower: "
+              + ", ".join(regressions))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,112 @@
+"""Gzip web assets into a C header for the firmware's flash.
+
+The web UI sources stay readable as raw string literals in their own
+headers (R"rawliteral(...)rawliteral"). This script pulls each literal
+out, gzips it and writes a header with one byte array per asset, its
+length and a strong ETag, so the server can send the bytes as they are
+with Content-Encoding: gzip and answer revalidations with 304.
+
+Run from the repository root after editing a source:
+    python esp32/tools/embed_assets.py esp32/esp32_firmware/web_assets.h \\
+        esp32/esp32_firmware/web_page.h:HTML_PAGE
+    python esp32/tools/embed_assets.py legacy/EPaper_AP_Portal/web_assets.h \\
+        legacy/EPaper_AP_Portal/web_html.h:HTML_PAGE \\
+        legacy/EPaper_AP_Portal/web_css.h:CSS_STYLES \\
+        legacy/EPaper_AP_Portal/web_js.h:JS_APP
+
+--check exits with status 1 if the header is out of date instead.
+"""
+import argparse
+import gzip
+import hashlib
+import os
+import re
+import sys
+from typing import List, Tuple
+
+LINE_BYTES = 16
+
+
+def extract_literal(path: str, symbol: str) -> bytes:
+    """The raw string literal assigned to symbol in path, as UTF-8."""
+    with open(path, encoding="utf-8", newline="") as f:
+        source = f.read()
+    match = re.search(
+        r"\b" + re.escape(symbol) + r'\b[^=;]*=\s*R"([^(\s]*)\((.*?)\)\1"', source, re.DOTALL)
+    if not match:
+        raise SystemExit(f"{path}: no raw string literal for {symbol}")
+    # The compiler reads CRLF sources as LF
+    return match.group(2).replace("\r\n", "\n").encode("utf-8")
+
+
+def compress(data: bytes) -> bytes:
+    # mtime=0 keeps the output, and with it the ETag, reproducible
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def render(command: str, assets: List[Tuple[str, str, bytes, bytes]]) -> str:
+    guard = "WEB_ASSETS_H"
+    lines = [
+        f"#ifndef {guard}",
+        f"#define {guard}",
+        "",
+        "// Generated by esp32/tools/embed_assets.py, do not edit. Regenerate with",
+        f"//   {command}",
+        "",
+        "#include <Arduino.h>",
+    ]
+    for symbol, path, raw, packed in assets:
+        etag = hashlib.sha256(packed).hexdigest()[:16]
+        lines += [
+            "",
+            f"// {os.path.basename(path)}: {len(raw)} bytes, {len(packed)} gzipped",
+            f"#define {symbol}_GZ_LEN {len(packed)}",
+            f'#define {symbol}_ETAG "\\"{etag}\\""',
+            f"const uint8_t {symbol}_GZ[] PROGMEM = {{",
+        ]
+        for i in range(0, len(packed), LINE_BYTES):
+            chunk = packed[i:i + LINE_BYTES]
+            lines.append("    " + ", ".join(f"0x{b:02x}" for b in chunk) + ",")
+        lines.append("};")
+    lines += ["", f"#endif // {guard}", ""]
+    return "\n".join(lines)
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description="Gzip web assets into a C header")
+    parser.add_argument("output", help="Header to write")
+    parser.add_argument("assets", nargs="+", metavar="SOURCE:SYMBOL",
+                        help="Header holding the raw string literal, and its name")
+    parser.add_argument("--check", action="store_true", help="Only check that output is up to date")
+    args = parser.parse_args()
+
+    assets = []
+    for spec in args.assets:
+        path, _, symbol = spec.rpartition(":")
+        if not path or not symbol:
+            raise SystemExit(f"Expected SOURCE:SYMBOL, got {spec}")
+        raw = extract_literal(path, symbol)
+        assets.append((symbol, path, raw, compress(raw)))
+
+    command = " ".join(["python", "esp32/tools/embed_assets.py", args.output] + args.assets)
+    header = render(command, assets)
+
+    if args.check:
+        try:
+            with open(args.output, encoding="utf-8", newline="") as f:
+                current = f.read()
+        except FileNotFoundError:
+            current = None
+        if current != header:
+            print(f"{args.output} is out of date; run: {command}", file=sys.stderr)
+            sys.exit(1)
+        return
+
+    with open(args.output, "w", encoding="utf-8", newline="\n") as f:
+        f.write(header)
+    for symbol, _, raw, packed in assets:
+        print(f"{symbol}: {len(raw)} -> {len(packed)} bytes ({len(packed) * 100 // len(raw)}%)")
+
+
+if __name__ == "__main__":
+    main()
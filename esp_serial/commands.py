@@ -1,4 +1,6 @@
 """Command builders for ESP32 communication."""
+from typing import Sequence
+
 from .protocol import Command, CommandType, Protocol
 
 
@@ -54,6 +56,67 @@ class CommandBuilder:
         return Command(CommandType.SHALT)
 
     @staticmethod
-    def system_ping() -> Command:
-        """Build heartbeat/ping command."""
-        return Command(CommandType.SPING)
+    def system_ping(payload: bytes = b"") -> Command:
+        """
+        Build heartbeat/ping command.
+
+        Args:
+            payload: Ignored by the firmware; sized payloads measure link throughput
+        """
+        return Command(CommandType.SPING, payload)
+
+    @staticmethod
+    def system_tasks() -> Command:
+        """Build task statistics command."""
+        return Command(CommandType.STASKS)
+
+    @staticmethod
+    def system_scheduler() -> Command:
+        """Build scheduler statistics command."""
+        return Command(CommandType.SSCHED)
+
+    @staticmethod
+    def system_heap() -> Command:
+        """Build heap statistics command."""
+        return Command(CommandType.SHEAP)
+
+    @staticmethod
+    def system_profile(reset: bool = False) -> Command:
+        """
+        Build latency profiler command.
+
+        Args:
+            reset: Clear the histograms after reporting them
+        """
+        return Command(CommandType.SPROF, b"reset" if reset else b"")
+
+    @staticmethod
+    def system_stats(reset: bool = False) -> Command:
+        """
+        Build protocol statistics command.
+
+        Args:
+            reset: Clear the statistics after reporting them
+        """
+        return Command(CommandType.SSTATS, b"reset" if reset else b"")
+
+    @staticmethod
+    def system_trace(clear: bool = False) -> Command:
+        """
+        Build trace dump command.
+
+        Args:
+            clear: Restart the trace ring empty after the dump
+        """
+        return Command(CommandType.STRACE, b"clear" if clear else b"")
+
+    @staticmethod
+    def system_bench(tests: Sequence[str] = ()) -> Command:
+        """
+        Build self-benchmark command.
+
+        Args:
+            tests: Names of the tests to run (epd, ledc, crc, memcpy_int,
+                memcpy_psram, uart); all of them if empty
+        """
+        return Command(CommandType.SBENCH, ",".join(tests).encode())
@@ -1,15 +1,17 @@
 """Serial connection manager for ESP32 communication."""
 import asyncio
+import json
 import logging
 import threading
-from typing import Callable, Optional
+from typing import Any, Callable, Dict, Optional, Sequence, Union
 
 import serial as pyserial  # Rename to avoid confusion with our module
 
-from config import SERIAL_PORT, SERIAL_BAUDRATE, SERIAL_TIMEOUT
-from .protocol import Command, Response, ResponseStatus
+from config import SERIAL_PORT, SERIAL_BAUDRATE, SERIAL_TIMEOUT, SERIAL_RTSCTS
+from .protocol import Command, Protocol, Response, ResponseStatus
 
 logger = logging.getLogger(__name__)
+firmware_logger = logging.getLogger("esp32.firmware")
 
 
 def resolve_port(port: str) -> str:
@@ -45,10 +47,20 @@ class SerialManager:
         port: str = SERIAL_PORT,
         baudrate: int = SERIAL_BAUDRATE,
         timeout: float = SERIAL_TIMEOUT,
+        rtscts: bool = SERIAL_RTSCTS,
+        on_log: Optional[Callable[[int, int, str], None]] = None,
     ):
+        """
+        Args:
+            rtscts: Hardware flow control, for the UART2 transport.
+            on_log: Receives firmware log frames as (logging level, uptime
+                ms, text). Defaults to the "esp32.firmware" logger.
+        """
         self.port = resolve_port(port)
         self.baudrate = baudrate
         self.timeout = timeout
+        self.rtscts = rtscts
+        self.on_log = on_log or self._default_log
         self._serial: Optional[pyserial.Serial] = None
         self._lock = threading.Lock()
         self._connected = False
@@ -71,6 +83,7 @@ class SerialManager:
                     parity=pyserial.PARITY_NONE,
                     stopbits=pyserial.STOPBITS_ONE,
                     timeout=self.timeout,
+                    rtscts=self.rtscts,
                 )
                 self._connected = True
                 logger.info(f"Connected to ESP32 on {self.port} at {self.baudrate} baud")
@@ -103,8 +116,8 @@ class SerialManager:
                 return Response(ResponseStatus.ERR, "Not connected")
 
             try:
-                # Clear input buffer
-                self._serial.reset_input_buffer()
+                # Drop stale input, but keep the logs in it
+                self._drain_input()
 
                 # Send command
                 encoded = command.encode()
@@ -112,18 +125,24 @@ class SerialManager:
                 self._serial.flush()
                 logger.debug(f"Sent: {command.cmd_type.value}")
 
-                # Read response
-                response_data = b""
-                lines_read = 0
-                while lines_read < 2:  # Status line + message line
-                    line = self._serial.readline()
-                    if not line:
+                # Read response: status line, then exactly the announced
+                # number of message bytes and the trailing newline. Log
+                # frames may arrive first and are routed to on_log.
+                while True:
+                    response_data = self._serial.readline()
+                    if not response_data:
+                        return Response(ResponseStatus.ERR, "No response (timeout)")
+                    if not response_data.startswith(Protocol.LOG_TAG):
                         break
-                    response_data += line
-                    lines_read += 1
-
-                if not response_data:
-                    return Response(ResponseStatus.ERR, "No response (timeout)")
+                    log_length = self._log_length(response_data)
+                    if log_length is not None:
+                        self._emit_log(self._serial.read(log_length + 1)[:log_length])
+                msg_length = self._message_length(response_data)
+                if msg_length is None:
+                    # Unknown status line: fall back to reading one more line
+                    response_data += self._serial.readline()
+                else:
+                    response_data += self._serial.read(msg_length + 1)
 
                 response = Response.decode(response_data)
                 logger.debug(f"Received: {response.status.value} - {response.message}")
@@ -133,6 +152,58 @@ class SerialManager:
                 logger.error(f"Serial error: {e}")
                 return Response(ResponseStatus.ERR, str(e))
 
+    @staticmethod
+    def _log_length(header: bytes) -> Optional[int]:
+        """Parse the message length from a LOG<LENGTH> line."""
+        length = header.strip()[len(Protocol.LOG_TAG):]
+        return int(length) if length.isdigit() else None
+
+    @staticmethod
+    def _default_log(level: int, uptime_ms: int, text: str) -> None:
+        firmware_logger.log(level, f"[{uptime_ms / 1000:.3f}] {text}")
+
+    def _emit_log(self, message: bytes) -> None:
+        try:
+            self.on_log(*Protocol.parse_log(message.decode(errors="replace")))
+        except Exception as e:
+            logger.debug(f"Log handler failed: {e}")
+
+    def _drain_input(self) -> None:
+        """Discard pending input without blocking, routing complete log frames."""
+        pending = self._serial.read(self._serial.in_waiting) if self._serial.in_waiting else b""
+        while pending:
+            line_end = pending.find(b"\n")
+            if line_end < 0:
+                if not Protocol.LOG_TAG.startswith(pending[:len(Protocol.LOG_TAG)]):
+                    break
+                # A log frame still arriving: finish it, or its text would
+                # be taken for the response
+                pending += self._serial.readline()
+                line_end = pending.find(b"\n")
+                if line_end < 0:
+                    break
+            header, rest = pending[:line_end], pending[line_end + 1:]
+            log_length = self._log_length(header) if header.startswith(Protocol.LOG_TAG) else None
+            if log_length is None:
+                pending = rest
+                continue
+            if len(rest) < log_length + 1:
+                rest += self._serial.read(log_length + 1 - len(rest))
+                if len(rest) < log_length:
+                    break
+            self._emit_log(rest[:log_length])
+            pending = rest[log_length + 1:]
+
+    @staticmethod
+    def _message_length(status_line: bytes) -> Optional[int]:
+        """Parse the message length from a <STATUS><LENGTH> line."""
+        line = status_line.strip().decode(errors="replace")
+        for status in ResponseStatus:
+            if line.startswith(status.value):
+                length = line[len(status.value):]
+                return int(length) if length.isdigit() else None
+        return None
+
     async def send_command_async(self, command: Command) -> Response:
         """Send command asynchronously."""
         loop = asyncio.get_event_loop()
@@ -157,3 +228,63 @@ class SerialManager:
         from .commands import CommandBuilder
         response = self.send_command(CommandBuilder.system_ping())
         return response.status == ResponseStatus.OK
+
+    def get_protocol_stats(self, reset: bool = False) -> Optional[Dict[str, Any]]:
+        """Poll per-command protocol statistics from the ESP32.
+
+        Each command entry holds counts ("n", "err"), bytes ("in", "out")
+        and [avg, p50, p99, max] microsecond latencies for the "rx", "crc",
+        "handler" and "tx" phases.
+
+        Args:
+            reset: Clear the firmware counters after reading them
+
+        Returns:
+            Parsed statistics, or None if the request failed
+        """
+        from .commands import CommandBuilder
+        response = self.send_command(CommandBuilder.system_stats(reset))
+        if response.status != ResponseStatus.OK:
+            logger.warning(f"Stats request failed: {response.message}")
+            return None
+        try:
+            return json.loads(response.message)
+        except ValueError as e:
+            logger.warning(f"Invalid stats payload: {e}")
+            return None
+
+    def run_self_bench(self, tests: Sequence[str] = ()) -> Optional[Dict[str, Union[int, Dict[str, float], str]]]:
+        """Run the firmware's on-target microbenchmarks (SBENCH).
+
+        Results by test name: {"count", "cycles", "us", "cycles_per_unit"}
+        for a test that ran, or the reason it did not ("busy", "none",
+        "timeout", ...). "mhz" holds the CPU clock the cycles count.
+
+        Args:
+            tests: Names of the tests to run, all of them if empty
+
+        Returns:
+            Parsed results, or None if the request failed
+        """
+        from .commands import CommandBuilder
+        response = self.send_command(CommandBuilder.system_bench(tests))
+        if response.status != ResponseStatus.OK:
+            logger.warning(f"Self-benchmark failed: {response.message}")
+            return None
+        results: Dict[str, Union[int, Dict[str, float], str]] = {}
+        for field in response.message.split():
+            name, _, value = field.partition(":")
+            count, slash, cycles = value.partition("/")
+            if name == "mhz":
+                results[name] = int(value)
+            elif slash and count.isdigit() and cycles.isdigit():
+                results[name] = {"count": int(count), "cycles": int(cycles),
+                                 "cycles_per_unit": int(cycles) / max(int(count), 1)}
+            else:
+                results[name] = value
+        mhz = results.get("mhz")
+        if isinstance(mhz, int) and mhz > 0:
+            for entry in results.values():
+                if isinstance(entry, dict):
+                    entry["us"] = entry["cycles"] / mhz
+        return results
@@ -1,4 +1,5 @@
 """Protocol encoder/decoder for ESP32 communication."""
+import logging
 import struct
 from dataclasses import dataclass
 from enum import Enum
@@ -18,6 +19,13 @@ class CommandType(Enum):
     SRESET = "SRESET"  # Soft reset
     SHALT = "SHALT"    # Enter deep sleep
     SPING = "SPING"    # Heartbeat/ping
+    STASKS = "STASKS"  # Task stack/CPU statistics
+    SSCHED = "SSCHED"  # Scheduler lateness statistics
+    SHEAP = "SHEAP"  # Heap and allocation statistics
+    SPROF = "SPROF"  # Latency profiler histograms
+    SSTATS = "SSTATS"  # Per-command protocol statistics (JSON)
+    STRACE = "STRACE"  # Event trace ring dump (base64)
+    SBENCH = "SBENCH"  # On-target microbenchmarks (CPU cycles)
 
 
 class ResponseStatus(Enum):
@@ -50,18 +58,21 @@ class Response:
     def decode(cls, data: bytes) -> "Response":
         """Decode response from wire format: <STATUS><MESSAGE_LENGTH>\n<MESSAGE>\n"""
         try:
-            lines = data.decode().strip().split("\n")
-            if not lines:
+            text = data.decode().lstrip()
+            if not text:
                 return cls(ResponseStatus.ERR, "Empty response")
 
-            # Parse status and length from first line
-            status_line = lines[0]
+            # Parse status and length from first line; the length covers
+            # the whole message, which may itself contain newlines
+            status_line, _, body = text.partition("\n")
+            status_line = status_line.strip()
             for status in ResponseStatus:
                 if status_line.startswith(status.value):
                     length_str = status_line[len(status.value):]
                     msg_length = int(length_str) if length_str else 0
-                    message = lines[1] if len(lines) > 1 else ""
-                    return cls(status, message[:msg_length] if msg_length else message)
+                    if msg_length:
+                        return cls(status, body[:msg_length])
+                    return cls(status, body.split("\n", 1)[0].rstrip("\r"))
 
             return cls(ResponseStatus.ERR, f"Unknown status: {status_line}")
         except Exception as e:
@@ -73,6 +84,21 @@ class Protocol:
 
     CRC_POLYNOMIAL = 0x1021  # CRC-CCITT
 
+    # Firmware log frames: LOG<LEN>\n<L> <ms> <message>\n
+    LOG_TAG = b"LOG"
+    LOG_LEVELS = {"E": logging.ERROR, "W": logging.WARNING, "I": logging.INFO, "D": logging.DEBUG}
+
+    @staticmethod
+    def parse_log(message: str) -> tuple[int, int, str]:
+        """Split a log frame message into (logging level, uptime ms, text)."""
+        parts = message.split(" ", 2)
+        level = Protocol.LOG_LEVELS.get(parts[0], logging.INFO)
+        try:
+            uptime_ms = int(parts[1]) if len(parts) > 1 else 0
+        except ValueError:
+            uptime_ms = 0
+        return level, uptime_ms, parts[2] if len(parts) > 2 else ""
+
     @staticmethod
     def calculate_crc(data: bytes) -> str:
         """Calculate 16-bit CRC-CCITT for data."""
@@ -0,0 +1,115 @@
+"""Drive the host firmware simulator (esp32/host, target firmware_sim).
+
+The simulator runs the unmodified firmware against a HAL shim and exposes
+its serial link as a pseudo-terminal, so SerialManager talks to it as to a
+board. Its virtual clock runs at a chosen speed, or frozen and stepped, so
+motor timeouts and display refreshes need not take real seconds. The
+e-paper controller is emulated too: each refresh holds BUSY for the
+panel's time and, with epd_dir, leaves the visible image as a PNG.
+
+Usage:
+    with FirmwareSim("build/host/firmware_sim", speed=0) as sim:
+        manager = SerialManager(port=sim.port)
+        manager.connect()
+        sim.wait_booted()
+        manager.send_command(CommandBuilder.motor_velocity(150, 150, 2000))
+        sim.advance(2000)
+        assert not any(sim.pwm().values())
+"""
+import subprocess
+import time
+from typing import Dict, Optional
+
+DEFAULT_BOOT_MS = 1200  # setup() waits 1 s before it starts the tasks
+
+
+class FirmwareSim:
+    """A running firmware_sim process and its control channel."""
+
+    def __init__(self, binary: str, speed: float = 1.0, link: Optional[str] = None,
+                 port_offset: Optional[int] = None, epd_dir: Optional[str] = None):
+        args = [binary, "--speed", str(speed)]
+        if link:
+            args += ["--link", link]
+        if port_offset is not None:
+            args += ["--port-offset", str(port_offset)]
+        if epd_dir:
+            args += ["--epd-dir", epd_dir]
+        self._process = subprocess.Popen(
+            args, stdin=subprocess.PIPE, stdout=subprocess.PIPE, text=True, bufsize=1)
+        self.port = self._expect("pty")
+
+    def _expect(self, key: str) -> str:
+        while True:
+            line = self._process.stdout.readline()
+            if not line:
+                raise RuntimeError(f"firmware_sim exited (status {self._process.poll()})")
+            word, _, value = line.strip().partition(" ")
+            if word != "pty" or key == "pty":
+                break
+            self.port = value  # Restarted (SRESET): same terminal, printed again
+        if word != key:
+            raise RuntimeError(f"firmware_sim: expected {key}, got {line.strip()!r}")
+        return value
+
+    def _command(self, command: str, key: str) -> str:
+        self._process.stdin.write(command + "\n")
+        self._process.stdin.flush()
+        return self._expect(key)
+
+    def time_us(self) -> int:
+        """Virtual microseconds since boot."""
+        return int(self._command("time", "time"))
+
+    def set_speed(self, speed: float) -> None:
+        """Virtual seconds per real second; 0 freezes the clock."""
+        self._command(f"speed {speed}", "speed")
+
+    def advance(self, ms: float) -> int:
+        """Step the clock; timers due on the way fire in order."""
+        return int(self._command(f"advance {ms}", "time"))
+
+    def wait_booted(self, boot_ms: int = DEFAULT_BOOT_MS) -> None:
+        """Let setup() finish, stepping the clock if it is frozen.
+
+        Connect first: opening the port drops unread input, and would cut
+        a boot log frame in half if it raced one.
+        """
+        start = self.time_us()
+        time.sleep(0.05)
+        if self.time_us() == start:
+            self.advance(boot_ms)
+            return
+        while self.time_us() < boot_ms * 1000:
+            time.sleep(0.01)
+
+    def pwm(self) -> Dict[int, int]:
+        """PWM duty per motor pin."""
+        duties = {}
+        for item in self._command("pwm", "pwm").split():
+            pin, _, duty = item.partition("=")
+            duties[int(pin)] = int(duty)
+        return duties
+
+    def epd(self) -> Dict[str, str]:
+        """Display refreshes so far, and the 0x22 sequence, BUSY time and
+        PNG (epd_dir) of the last one."""
+        return dict(item.partition("=")[::2] for item in self._command("epd", "epd").split())
+
+    def close(self) -> None:
+        if self._process.poll() is None:
+            try:
+                self._process.stdin.write("quit\n")
+                self._process.stdin.flush()
+            except BrokenPipeError:
+                pass
+            try:
+                self._process.wait(timeout=5)
+            except subprocess.TimeoutExpired:
+                self._process.kill()
+
+    def __enter__(self) -> "FirmwareSim":
+        return self
+
+    def __exit__(self, *exc) -> None:
+        self.close()
@@ -0,0 +1,93 @@
+"""Measure protocol link throughput with sized SPING frames.
+
+The firmware ignores the SPING payload, so the round trip is dominated by
+moving the frame across the link. Run it once per transport (UART0, UART2,
+USB) to compare them; the framing is the same on all three.
+
+Usage:
+    python -m esp_serial.throughput --port /dev/ttyACM0
+    python -m esp_serial.throughput --port /dev/ttyAMA0 --baud 2000000 --rtscts
+"""
+import argparse
+import os
+import statistics
+import time
+from typing import Any, Dict, List, Optional
+
+DEFAULT_SIZES = [0, 1024, 4096, 15000]  # 15000 = one DIMG frame
+
+
+def measure(manager, size: int, count: int) -> Optional[Dict[str, Any]]:
+    """Send count SPING frames carrying size bytes; None if any fails."""
+    from .commands import CommandBuilder
+    from .protocol import ResponseStatus
+
+    command = CommandBuilder.system_ping(os.urandom(size))
+    frame_bytes = len(command.encode())
+    manager.get_protocol_stats(reset=True)
+
+    round_trips: List[float] = []
+    for _ in range(count):
+        start = time.perf_counter()
+        response = manager.send_command(command)
+        round_trips.append(time.perf_counter() - start)
+        if response.status != ResponseStatus.OK:
+            return None
+
+    result: Dict[str, Any] = {
+        "size": size,
+        "frame_bytes": frame_bytes,
+        "round_trip_ms": statistics.median(round_trips) * 1000,
+        "host_kib_s": frame_bytes * count / sum(round_trips) / 1024,
+    }
+
+    # Device side: time from the first to the last byte of each frame
+    stats = manager.get_protocol_stats()
+    if stats:
+        result["link"] = stats.get("link", {})
+        ping = stats.get("commands", {}).get("SPING")
+        if ping:
+            # The average is exact; percentiles are log2 buckets
+            rx_avg_us = ping["rx"][0]
+            result["rx_avg_ms"] = rx_avg_us / 1000
+            if rx_avg_us:
+                result["device_kib_s"] = frame_bytes / (rx_avg_us / 1e6) / 1024
+    return result
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description="Measure ESP32 protocol link throughput")
+    parser.add_argument("--port", required=True, help="Serial port of the ESP32")
+    parser.add_argument("--baud", type=int, default=115200, help="Baud rate (ignored for USB)")
+    parser.add_argument("--rtscts", action="store_true", help="Hardware flow control (UART2)")
+    parser.add_argument("--count", type=int, default=10, help="Frames per size")
+    parser.add_argument("--size", type=int, action="append",
+                        help="Payload size in bytes, repeatable (default: 0, 1K, 4K, 15000)")
+    args = parser.parse_args()
+
+    from .manager import SerialManager
+    manager = SerialManager(port=args.port, baudrate=args.baud, rtscts=args.rtscts)
+    if not manager.connect():
+        raise SystemExit(f"Cannot open {args.port}")
+    try:
+        results = []
+        for size in args.size or DEFAULT_SIZES:
+            result = measure(manager, size, args.count)
+            if result is None:
+                raise SystemExit(f"SPING with {size} bytes failed")
+            results.append(result)
+    finally:
+        manager.disconnect()
+
+    link = next((r["link"] for r in results if r.get("link")), {})
+    print(f"transport: {link.get('transport', '?')}, baud: {link.get('baud', '?')}")
+    print(f"{'payload':>8} {'frame':>8} {'rtt ms':>9} {'host KiB/s':>11} {'rx ms':>8} {'dev KiB/s':>10}")
+    for r in results:
+        rx = f"{r['rx_avg_ms']:8.2f}" if "rx_avg_ms" in r else f"{'-':>8}"
+        dev = f"{r['device_kib_s']:10.1f}" if "device_kib_s" in r else f"{'-':>10}"
+        print(f"{r['size']:>8} {r['frame_bytes']:>8} {r['round_trip_ms']:9.2f} "
+              f"{r['host_kib_s']:11.1f} {rx} {dev}")
+
+
+if __name__ == "__main__":
+    main()
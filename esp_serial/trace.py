@@ -0,0 +1,180 @@
+"""Convert ESP32 event trace dumps (STRACE) to Chrome trace JSON.
+
+The result opens in https://ui.perfetto.dev or chrome://tracing.
+
+Usage:
+    # Fetch from the robot and convert
+    python -m esp_serial.trace --port /dev/ttyACM0 -o trace.json
+
+    # Convert a saved dump (raw binary or the base64 STRACE reply)
+    python -m esp_serial.trace dump.bin -o trace.json
+"""
+import argparse
+import base64
+import binascii
+import json
+import struct
+from typing import Any, Dict, List, Optional, Tuple
+
+MAGIC = b"ETRC"
+SUPPORTED_VERSION = 1
+HEADER = struct.Struct("<4sBBBxIII")
+EVENT = struct.Struct("<IBBBB8s")
+FLAG_VALUES = 0x01
+
+
+def decode_dump(data: bytes) -> bytes:
+    """Accept either the raw dump or its base64 text form."""
+    if data.startswith(MAGIC):
+        return data
+    try:
+        raw = base64.b64decode(data.strip(), validate=True)
+    except binascii.Error as e:
+        raise ValueError(f"Not a trace dump: {e}") from e
+    if not raw.startswith(MAGIC):
+        raise ValueError("Not a trace dump: bad magic")
+    return raw
+
+
+def _read_strings(data: bytes, offset: int, count: int) -> Tuple[List[str], int]:
+    strings = []
+    for _ in range(count):
+        length = data[offset]
+        strings.append(data[offset + 1:offset + 1 + length].decode(errors="replace"))
+        offset += 1 + length
+    return strings, offset
+
+
+def parse_dump(data: bytes) -> Dict[str, Any]:
+    """Parse a raw dump into names, threads and event tuples."""
+    magic, version, name_count, thread_count, count, overwritten, now_us = \
+        HEADER.unpack_from(data, 0)
+    if magic != MAGIC:
+        raise ValueError("Not a trace dump: bad magic")
+    if version != SUPPORTED_VERSION:
+        raise ValueError(f"Unsupported trace version {version}")
+
+    names, offset = _read_strings(data, HEADER.size, name_count)
+    threads, offset = _read_strings(data, offset, thread_count)
+
+    events = []
+    for i in range(count):
+        ts, phase, thread, name, flags, payload = EVENT.unpack_from(
+            data, offset + i * EVENT.size)
+        events.append((ts, chr(phase), thread, name, flags, payload))
+
+    return {
+        "names": names,
+        "threads": threads,
+        "events": events,
+        "overwritten": overwritten,
+        "now_us": now_us,
+    }
+
+
+def to_chrome_trace(data: bytes, pid: int = 1) -> Dict[str, Any]:
+    """Build a Chrome trace (JSON object format) from a dump."""
+    dump = parse_dump(decode_dump(data))
+    names, threads = dump["names"], dump["threads"]
+
+    trace_events: List[Dict[str, Any]] = [
+        {"ph": "M", "pid": pid, "name": "process_name", "args": {"name": "esp32"}},
+    ]
+    for tid, thread in enumerate(threads):
+        if thread:
+            trace_events.append({"ph": "M", "pid": pid, "tid": tid,
+                                 "name": "thread_name", "args": {"name": thread}})
+
+    # Timestamps are the low 32 bits of esp_timer; unwrap across overflows
+    base = 0
+    last = None
+    open_begins: Dict[int, int] = {}
+    for ts, phase, thread, name, flags, payload in dump["events"]:
+        if last is not None and ts < last and last - ts > 0x80000000:
+            base += 1 << 32
+        last = ts
+
+        event: Dict[str, Any] = {
+            "ph": phase,
+            "pid": pid,
+            "tid": thread,
+            "ts": base + ts,
+            "name": names[name] if name < len(names) else f"event{name}",
+        }
+        if flags & FLAG_VALUES:
+            left, right = struct.unpack("<ii", payload)
+            event["args"] = {"left": left, "right": right}
+        else:
+            label = payload.split(b"\0", 1)[0].decode(errors="replace")
+            if label:
+                event["args"] = {"label": label}
+                if phase == "B":
+                    event["name"] = f"{event['name']} {label}"
+
+        if phase == "i":
+            event["s"] = "t"
+        elif phase == "B":
+            open_begins[thread] = open_begins.get(thread, 0) + 1
+        elif phase == "E":
+            # Ends whose begin was overwritten in the ring are dropped
+            if not open_begins.get(thread):
+                continue
+            open_begins[thread] -= 1
+        trace_events.append(event)
+
+    return {
+        "traceEvents": trace_events,
+        "displayTimeUnit": "ms",
+        "otherData": {"overwritten_events": dump["overwritten"]},
+    }
+
+
+def fetch_dump(manager, clear: bool = False) -> Optional[bytes]:
+    """Read the trace ring through a connected SerialManager."""
+    from .commands import CommandBuilder
+    from .protocol import ResponseStatus
+
+    response = manager.send_command(CommandBuilder.system_trace(clear))
+    if response.status != ResponseStatus.OK:
+        return None
+    return decode_dump(response.message.encode())
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description="Convert ESP32 trace dumps to Chrome trace JSON")
+    parser.add_argument("dump", nargs="?", help="Saved dump file (raw or base64)")
+    parser.add_argument("--port", help="Fetch the dump from the ESP32 on this serial port")
+    parser.add_argument("--clear", action="store_true", help="Clear the ring after fetching")
+    parser.add_argument("--save", help="Also write the raw dump to this file")
+    parser.add_argument("-o", "--output", default="trace.json", help="Output JSON file")
+    args = parser.parse_args()
+
+    if args.port:
+        from .manager import SerialManager
+        manager = SerialManager(port=args.port)
+        if not manager.connect():
+            raise SystemExit(f"Cannot open {args.port}")
+        try:
+            data = fetch_dump(manager, args.clear)
+        finally:
+            manager.disconnect()
+        if data is None:
+            raise SystemExit("STRACE failed")
+    elif args.dump:
+        with open(args.dump, "rb") as f:
+            data = decode_dump(f.read())
+    else:
+        parser.error("give a dump file or --port")
+
+    if args.save:
+        with open(args.save, "wb") as f:
+            f.write(data)
+
+    trace = to_chrome_trace(data)
+    with open(args.output, "w") as f:
+        json.dump(trace, f)
+    print(f"{len(trace['traceEvents'])} events -> {args.output}")
+
+
+if __name__ == "__main__":
+    main()
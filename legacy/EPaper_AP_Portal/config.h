@@ -37,8 +37,12 @@ IPAddress AP_SUBNET(255, 255, 255, 0);
 // Buffer size for 4.2" display: 400*300/8 = 15000 bytes
 #define IMAGE_BUFFER_SIZE  15000
 
-// Upload chunk size (optimized for memory)
-#define UPLOAD_CHUNK_SIZE  4096
+// Upload bodies are decoded in steps of this many bytes as they stream in
+#define UPLOAD_CHUNK_SIZE  256
+
+// Upload sessions track received data in blocks of this size (5 rows);
+// session chunks start and end on block boundaries
+#define UPLOAD_BLOCK_SIZE  250
 
 // ===========================================
 // Web Server Configuration
@@ -51,4 +55,9 @@ IPAddress AP_SUBNET(255, 255, 255, 0);
 // API Version
 #define API_VERSION  "1.0"
 
+// Static buffer for serialized JSON responses. The largest is a session
+// chunk reply with 16 missing ranges, about 440 bytes; the rest is margin
+// for new fields (sendJsonDocument() answers 500 rather than truncate).
+#define JSON_BUFFER_SIZE  1024
+
 #endif // CONFIG_H
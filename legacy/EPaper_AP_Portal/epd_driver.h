@@ -3,6 +3,7 @@
 
 #include <Arduino.h>
 #include "config.h"
+#include "log.h"
 
 // ===========================================
 // Low-level SPI Functions (matching original)
@@ -100,7 +101,7 @@ void EPD_Send_4(uint8_t c, uint8_t v1, uint8_t v2, uint8_t v3, uint8_t v4) {
 // ===========================================
 
 void EPD_4in2_V2_Init() {
-    Serial.println("Initializing 4.2\" V2 E-Paper...");
+    LOG_I("Initializing 4.2\" V2 E-Paper...");
 
     EPD_Reset();
     EPD_WaitUntilIdle_high();
@@ -133,7 +134,7 @@ void EPD_4in2_V2_Init() {
     // Ready to receive new image data
     EPD_SendCommand(0x24);
 
-    Serial.println("4.2\" V2 E-Paper initialized");
+    LOG_I("4.2\" V2 E-Paper initialized");
 }
 
 void EPD_4in2_V2_Show() {
@@ -148,14 +149,14 @@ void EPD_4in2_V2_Show() {
 }
 
 void EPD_4in2_V2_Clear() {
-    Serial.println("Clearing display...");
+    LOG_I("Clearing display...");
     EPD_4in2_V2_Init();
     // Init already clears and shows, then prepares for new data
-    Serial.println("Display cleared");
+    LOG_I("Display cleared");
 }
 
 void EPD_4in2_V2_Display(const uint8_t* image) {
-    Serial.println("Displaying image...");
+    LOG_I("Displaying image...");
 
     EPD_Reset();
     EPD_WaitUntilIdle_high();
@@ -182,15 +183,15 @@ void EPD_4in2_V2_Display(const uint8_t* image) {
     // Trigger display refresh
     EPD_4in2_V2_Show();
 
-    Serial.println("Display update complete");
+    LOG_I("Display update complete");
 }
 
 void EPD_4in2_V2_Sleep() {
-    Serial.println("Entering deep sleep...");
+    LOG_I("Entering deep sleep...");
     EPD_SendCommand(0x10);
     EPD_SendData(0x01);
     delay(100);
-    Serial.println("Display in deep sleep");
+    LOG_I("Display in deep sleep");
 }
 
 #endif // EPD_DRIVER_H
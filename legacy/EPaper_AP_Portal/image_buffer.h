@@ -3,43 +3,46 @@
 
 #include <Arduino.h>
 #include "config.h"
+#include "log.h"
 
-// Image buffer in PSRAM if available, otherwise regular RAM
-uint8_t* imageBuffer = nullptr;
+// Static image buffer: no heap allocation, so it cannot fragment or fail
+uint8_t imageBuffer[IMAGE_BUFFER_SIZE];
 uint16_t bufferIndex = 0;
 bool bufferReady = false;
 
-void ImageBuffer_Init() {
-    // Try to allocate in PSRAM first (ESP32-WROVER modules)
-    if (psramFound()) {
-        imageBuffer = (uint8_t*)ps_malloc(IMAGE_BUFFER_SIZE);
-        Serial.println("Image buffer allocated in PSRAM");
-    } else {
-        imageBuffer = (uint8_t*)malloc(IMAGE_BUFFER_SIZE);
-        Serial.println("Image buffer allocated in RAM");
-    }
-
-    if (imageBuffer == nullptr) {
-        Serial.println("ERROR: Failed to allocate image buffer!");
-        return;
-    }
+// Offset-addressed upload session: chunks land anywhere in the buffer, in
+// any order, and a bitmap records which blocks hold verified data. The
+// frame only becomes ready once every block is in and the whole-frame CRC
+// (when the client gave one) matches.
+#define UPLOAD_BLOCK_COUNT ((IMAGE_BUFFER_SIZE + UPLOAD_BLOCK_SIZE - 1) / UPLOAD_BLOCK_SIZE)
+
+struct UploadSession {
+    uint16_t id;              // 0 = no session open
+    uint16_t blocksReceived;
+    bool hasFrameCrc;
+    uint16_t frameCrc;
+    uint8_t blocks[(UPLOAD_BLOCK_COUNT + 7) / 8];
+};
+static UploadSession session;
+static uint16_t lastSessionId = 0;
 
+void ImageBuffer_Init() {
     // Clear buffer (white = 0xFF for e-paper)
     memset(imageBuffer, 0xFF, IMAGE_BUFFER_SIZE);
     bufferIndex = 0;
     bufferReady = false;
+    session.id = 0;
 }
 
 void ImageBuffer_Clear() {
-    if (imageBuffer != nullptr) {
-        memset(imageBuffer, 0xFF, IMAGE_BUFFER_SIZE);
-    }
+    memset(imageBuffer, 0xFF, IMAGE_BUFFER_SIZE);
     bufferIndex = 0;
     bufferReady = false;
+    session.id = 0;
 }
 
 bool ImageBuffer_IsReady() {
-    return bufferReady && (imageBuffer != nullptr);
+    return bufferReady;
 }
 
 uint8_t* ImageBuffer_GetPtr() {
@@ -52,8 +55,6 @@ uint16_t ImageBuffer_GetSize() {
 
 // Receive image data chunk (already processed 1-bit data)
 bool ImageBuffer_Receive(const uint8_t* data, uint16_t len) {
-    if (imageBuffer == nullptr) return false;
-
     uint16_t copyLen = min(len, (uint16_t)(IMAGE_BUFFER_SIZE - bufferIndex));
     if (copyLen > 0) {
         memcpy(imageBuffer + bufferIndex, data, copyLen);
@@ -62,7 +63,7 @@ bool ImageBuffer_Receive(const uint8_t* data, uint16_t len) {
 
     if (bufferIndex >= IMAGE_BUFFER_SIZE) {
         bufferReady = true;
-        Serial.printf("Image buffer full: %d bytes\n", bufferIndex);
+        LOG_I("Image buffer full: %d bytes", bufferIndex);
     }
 
     return true;
@@ -72,6 +73,104 @@ bool ImageBuffer_Receive(const uint8_t* data, uint16_t len) {
 void ImageBuffer_Reset() {
     bufferIndex = 0;
     bufferReady = false;
+    session.id = 0;
+}
+
+// Drop everything received after index (a rejected upload chunk)
+void ImageBuffer_Rewind(uint16_t index) {
+    if (index < bufferIndex) {
+        bufferIndex = index;
+        bufferReady = false;
+    }
+}
+
+// CRC-CCITT (0x1021, initial 0xFFFF), continued chunk by chunk
+uint16_t crc16Update(uint16_t crc, const uint8_t* data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i] << 8;
+        for (int j = 0; j < 8; j++) {
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+// Open a new session over a cleared buffer; returns its id
+uint16_t ImageBuffer_BeginSession(bool hasFrameCrc, uint16_t frameCrc) {
+    ImageBuffer_Clear();
+    if (++lastSessionId == 0) lastSessionId = 1;
+    session.id = lastSessionId;
+    session.blocksReceived = 0;
+    session.hasFrameCrc = hasFrameCrc;
+    session.frameCrc = frameCrc;
+    memset(session.blocks, 0, sizeof(session.blocks));
+    return session.id;
+}
+
+uint16_t ImageBuffer_SessionId() {
+    return session.id;
+}
+
+// Write a session chunk at its offset; caller checks the bounds
+void ImageBuffer_WriteAt(uint16_t offset, const uint8_t* data, uint16_t len) {
+    memcpy(imageBuffer + offset, data, len);
+}
+
+// Mark every block touched by [offset, offset + len) received or missing
+void ImageBuffer_MarkBlocks(uint16_t offset, uint16_t len, bool received) {
+    if (len == 0) return;
+    for (uint16_t b = offset / UPLOAD_BLOCK_SIZE; b <= (offset + len - 1) / UPLOAD_BLOCK_SIZE; b++) {
+        bool had = session.blocks[b / 8] & (1 << (b % 8));
+        if (received && !had) {
+            session.blocks[b / 8] |= 1 << (b % 8);
+            session.blocksReceived++;
+        } else if (!received && had) {
+            session.blocks[b / 8] &= ~(1 << (b % 8));
+            session.blocksReceived--;
+            bufferReady = false;
+        }
+    }
+}
+
+uint16_t ImageBuffer_SessionReceivedBytes() {
+    uint16_t bytes = session.blocksReceived * UPLOAD_BLOCK_SIZE;
+    // The last block may be short
+    uint16_t last = UPLOAD_BLOCK_COUNT - 1;
+    if (session.blocks[last / 8] & (1 << (last % 8))) {
+        bytes -= UPLOAD_BLOCK_COUNT * UPLOAD_BLOCK_SIZE - IMAGE_BUFFER_SIZE;
+    }
+    return bytes;
+}
+
+// Missing byte ranges as [start, end) pairs, adjacent blocks merged.
+// Returns the number of ranges written, at most maxRanges.
+uint8_t ImageBuffer_MissingRanges(uint16_t ranges[][2], uint8_t maxRanges) {
+    uint8_t count = 0;
+    for (uint16_t b = 0; b < UPLOAD_BLOCK_COUNT && count < maxRanges; b++) {
+        if (session.blocks[b / 8] & (1 << (b % 8))) continue;
+        uint16_t start = b;
+        while (b + 1 < UPLOAD_BLOCK_COUNT && !(session.blocks[(b + 1) / 8] & (1 << ((b + 1) % 8)))) b++;
+        ranges[count][0] = start * UPLOAD_BLOCK_SIZE;
+        ranges[count][1] = min((uint32_t)(b + 1) * UPLOAD_BLOCK_SIZE, (uint32_t)IMAGE_BUFFER_SIZE);
+        count++;
+    }
+    return count;
+}
+
+// Once every block is in, check the whole frame and mark it ready. A frame
+// CRC mismatch cannot be pinned on one chunk, so every block is dropped.
+bool ImageBuffer_CommitSession() {
+    if (session.blocksReceived < UPLOAD_BLOCK_COUNT) return false;
+    if (session.hasFrameCrc && crc16Update(0xFFFF, imageBuffer, IMAGE_BUFFER_SIZE) != session.frameCrc) {
+        memset(session.blocks, 0, sizeof(session.blocks));
+        session.blocksReceived = 0;
+        LOG_W("Session %u: frame CRC mismatch, all blocks dropped", session.id);
+        return false;
+    }
+    bufferIndex = IMAGE_BUFFER_SIZE;
+    bufferReady = true;
+    LOG_I("Session %u: frame complete and verified", session.id);
+    return true;
 }
 
 // Get current buffer fill level
@@ -81,7 +180,7 @@ uint16_t ImageBuffer_GetFillLevel() {
 
 // Set a single byte at position
 void ImageBuffer_SetByte(uint16_t pos, uint8_t value) {
-    if (imageBuffer != nullptr && pos < IMAGE_BUFFER_SIZE) {
+    if (pos < IMAGE_BUFFER_SIZE) {
         imageBuffer[pos] = value;
     }
 }
@@ -89,7 +188,6 @@ void ImageBuffer_SetByte(uint16_t pos, uint8_t value) {
 // Set a pixel at position (x, y)
 // In 1-bit mode: 0 = black, 1 = white
 void ImageBuffer_SetPixel(uint16_t x, uint16_t y, bool white) {
-    if (imageBuffer == nullptr) return;
     if (x >= EPD_WIDTH || y >= EPD_HEIGHT) return;
 
     uint16_t byteIndex = (y * EPD_WIDTH + x) / 8;
@@ -106,8 +204,6 @@ void ImageBuffer_SetPixel(uint16_t x, uint16_t y, bool white) {
 
 // Fill buffer with a test pattern
 void ImageBuffer_TestPattern() {
-    if (imageBuffer == nullptr) return;
-
     // Create a simple test pattern: checkerboard
     for (uint16_t y = 0; y < EPD_HEIGHT; y++) {
         for (uint16_t x = 0; x < EPD_WIDTH; x++) {
@@ -115,6 +211,7 @@ void ImageBuffer_TestPattern() {
             ImageBuffer_SetPixel(x, y, white);
         }
     }
+    session.id = 0;
     bufferReady = true;
 }
 
@@ -0,0 +1,41 @@
+#ifndef LOG_H
+#define LOG_H
+
+#include <Arduino.h>
+
+// ===========================================
+// Leveled Serial Logging
+// ===========================================
+// Levels above LOG_LEVEL compile to nothing, arguments included. Per-chunk
+// upload tracing and hex dumps are DEBUG, so they no longer slow uploads.
+#define LOG_LEVEL_NONE  0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN  2
+#define LOG_LEVEL_INFO  3
+#define LOG_LEVEL_DEBUG 4
+
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+#define LOG_AT(level, tag, fmt, ...) \
+    do { if (LOG_LEVEL >= level) Serial.printf("[" tag "] " fmt "\n", ##__VA_ARGS__); } while (0)
+
+#define LOG_E(fmt, ...) LOG_AT(LOG_LEVEL_ERROR, "E", fmt, ##__VA_ARGS__)
+#define LOG_W(fmt, ...) LOG_AT(LOG_LEVEL_WARN, "W", fmt, ##__VA_ARGS__)
+#define LOG_I(fmt, ...) LOG_AT(LOG_LEVEL_INFO, "I", fmt, ##__VA_ARGS__)
+#define LOG_D(fmt, ...) LOG_AT(LOG_LEVEL_DEBUG, "D", fmt, ##__VA_ARGS__)
+
+// Hex dump of the first bytes (at most 16) of a buffer at DEBUG level
+inline void logHexDump(const char* label, const uint8_t* data, int len) {
+    if (LOG_LEVEL < LOG_LEVEL_DEBUG) return;
+    char line[3 * 16 + 1];
+    int n = len < 16 ? len : 16;
+    for (int i = 0; i < n; i++) {
+        snprintf(line + 3 * i, 4, "%02X ", data[i]);
+    }
+    line[3 * n] = '\0';
+    LOG_D("%s (first %d bytes): %s", label, n, line);
+}
+
+#endif // LOG_H
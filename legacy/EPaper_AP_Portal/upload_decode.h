@@ -0,0 +1,119 @@
+#ifndef UPLOAD_DECODE_H
+#define UPLOAD_DECODE_H
+
+// Upload body decoding, kept apart from the route handlers so it builds
+// without WebServer: the host benchmarks (esp32/host/bench) run it as is.
+
+#include <Arduino.h>
+#include "config.h"
+#include "log.h"
+#include "image_buffer.h"
+
+// Upload body formats, chosen per request from its headers
+enum UploadFormat : uint8_t {
+    UPLOAD_NIBBLE,    // text/plain, two 'a'+nibble chars per byte (original format)
+    UPLOAD_BINARY,    // application/octet-stream, raw packed bytes
+    UPLOAD_PACKBITS,  // application/octet-stream with X-Encoding: packbits
+};
+static const char* const uploadFormatNames[] = {"nibble", "binary", "packbits"};
+
+// Decode nibble from character (matching original byteToStr format)
+// Original encodes: low_nibble+'a', high_nibble+'a'
+inline uint8_t decodeNibble(char c) {
+    if (c >= 'a' && c <= 'p') {
+        return c - 'a';
+    }
+    return 0;
+}
+
+// Upload request in progress. The body is not buffered: WebServer hands
+// it over in HTTP_RAW_BUFLEN pieces, which are decoded straight into the
+// image buffer, so a request needs one small chunk of RAM whatever its size.
+struct UploadState {
+    UploadFormat format;
+    bool inSession;        // Offset-addressed session chunk, not an append
+    uint16_t startIndex;   // Buffer offset where the request's data goes
+    uint16_t received;     // Bytes decoded by this request
+    uint16_t crc;          // Running CRC of the decoded bytes
+    int8_t lowNibble;      // Nibble: low nibble waiting for its pair, or -1
+    uint8_t literal;       // PackBits: literal bytes still to copy
+    uint8_t repeat;        // PackBits: count waiting for its repeated byte
+    bool overflow;         // More data than the buffer has room for
+    const char* refused;   // Set at RAW_START: the body is skipped
+    int refusedCode;
+};
+static UploadState upload;
+
+// Stores decoded bytes in the image buffer and adds them to the running CRC
+void uploadStore(const uint8_t* chunk, uint16_t len) {
+    uint16_t at = upload.startIndex + upload.received;
+    if (at + len > IMAGE_BUFFER_SIZE) {
+        upload.overflow = true;
+        return;
+    }
+    logHexDump("Chunk data", chunk, min(8, (int)len));
+    if (upload.inSession) {
+        ImageBuffer_WriteAt(at, chunk, len);
+    } else {
+        ImageBuffer_Receive(chunk, len);
+    }
+    upload.crc = crc16Update(upload.crc, chunk, len);
+    upload.received += len;
+}
+
+// Collects decoded bytes into a small stack buffer for uploadStore
+class UploadWriter {
+public:
+    void put(uint8_t b) {
+        _chunk[_len++] = b;
+        if (_len == UPLOAD_CHUNK_SIZE) flush();
+    }
+    void flush() {
+        if (_len > 0 && !upload.overflow) uploadStore(_chunk, _len);
+        _len = 0;
+    }
+
+private:
+    uint8_t _chunk[UPLOAD_CHUNK_SIZE];
+    uint16_t _len = 0;
+};
+
+// Nibble format: each byte is 2 chars, low_nibble+'a' then high_nibble+'a'.
+// Pairs may straddle two pieces.
+void uploadDecodeNibbles(const uint8_t* data, size_t len) {
+    UploadWriter out;
+    for (size_t i = 0; i < len && !upload.overflow; i++) {
+        uint8_t nibble = decodeNibble(data[i]);
+        if (upload.lowNibble < 0) {
+            upload.lowNibble = nibble;
+            continue;
+        }
+        out.put(upload.lowNibble | (nibble << 4));
+        upload.lowNibble = -1;
+    }
+    out.flush();
+}
+
+// PackBits (as in TIFF/MacPaint): header n >= 0 is followed by n+1 literal
+// bytes, n in -127..-1 by one byte repeated 1-n times, -128 is a no-op.
+// Runs may straddle two pieces.
+void uploadDecodePackBits(const uint8_t* data, size_t len) {
+    UploadWriter out;
+    for (size_t i = 0; i < len && !upload.overflow; i++) {
+        uint8_t c = data[i];
+        if (upload.literal > 0) {
+            out.put(c);
+            upload.literal--;
+        } else if (upload.repeat > 0) {
+            for (uint8_t n = 0; n < upload.repeat; n++) out.put(c);
+            upload.repeat = 0;
+        } else if ((int8_t)c >= 0) {
+            upload.literal = c + 1;
+        } else if (c != 0x80) {
+            upload.repeat = 1 - (int8_t)c;
+        }
+    }
+    out.flush();
+}
+
+#endif // UPLOAD_DECODE_H
@@ -0,0 +1,701 @@
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+// Generated by esp32/tools/embed_assets.py, do not edit. Regenerate with
+//   python esp32/tools/embed_assets.py legacy/EPaper_AP_Portal/web_assets.h legacy/EPaper_AP_Portal/web_html.h:HTML_PAGE legacy/EPaper_AP_Portal/web_css.h:CSS_STYLES legacy/EPaper_AP_Portal/web_js.h:JS_APP
+
+#include <Arduino.h>
+
+// web_html.h: 4476 bytes, 1237 gzipped
+#define HTML_PAGE_GZ_LEN 1237
+#define HTML_PAGE_ETAG "\"f4375a4e0b58d871\""
+const uint8_t HTML_PAGE_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xbd, 0x58, 0xdf, 0x6f, 0xdb, 0x36,
+    0x10, 0x7e, 0xef, 0x5f, 0xc1, 0xf1, 0x61, 0x68, 0x87, 0x2a, 0xb2, 0x9d, 0x04, 0x2b, 0x32, 0x59,
+    0xc0, 0x92, 0x36, 0x5b, 0x1e, 0xba, 0x1a, 0x4b, 0xba, 0x61, 0x7b, 0xa3, 0xa4, 0x8b, 0xcd, 0x85,
+    0x26, 0x09, 0x92, 0x72, 0xec, 0x61, 0x7f, 0xfc, 0x8e, 0xa4, 0x9c, 0xd8, 0x8e, 0xa4, 0x38, 0xce,
+    0xb0, 0x22, 0x0d, 0xc5, 0x8f, 0x77, 0x1f, 0x7f, 0xdc, 0xf1, 0xee, 0x98, 0x37, 0xd9, 0x37, 0x1f,
+    0xbf, 0x5c, 0xdc, 0xfc, 0x31, 0xf9, 0x44, 0x66, 0x6e, 0x2e, 0xf2, 0x37, 0x99, 0x6f, 0x88, 0x60,
+    0x72, 0x3a, 0xa6, 0x20, 0xa9, 0x07, 0x80, 0x55, 0xf9, 0x1b, 0x82, 0xff, 0xb2, 0x39, 0x38, 0x46,
+    0xca, 0x19, 0x33, 0x16, 0xdc, 0x98, 0x7e, 0xbd, 0xb9, 0x4c, 0x3e, 0xd0, 0xcd, 0x21, 0xc9, 0xe6,
+    0x30, 0xa6, 0x0b, 0x0e, 0xf7, 0x5a, 0x19, 0x47, 0x49, 0xa9, 0xa4, 0x03, 0x89, 0xa2, 0xf7, 0xbc,
+    0x72, 0xb3, 0x71, 0x05, 0x0b, 0x5e, 0x42, 0x12, 0x3a, 0xef, 0x09, 0x97, 0xdc, 0x71, 0x26, 0x12,
+    0x5b, 0x32, 0x01, 0xe3, 0xe1, 0xd1, 0xe0, 0x3d, 0x99, 0xb3, 0x25, 0x9f, 0xd7, 0xf3, 0x4d, 0xa8,
+    0xb6, 0x60, 0x42, 0x9f, 0x15, 0x08, 0x49, 0xd5, 0x32, 0x1f, 0xd3, 0x5a, 0x40, 0x32, 0x57, 0x05,
+    0xc7, 0xe6, 0x1e, 0x8a, 0x04, 0x81, 0xa4, 0x64, 0xda, 0x6b, 0x6c, 0xac, 0x61, 0x05, 0xb6, 0x45,
+    0xf9, 0x25, 0x6a, 0x8e, 0x3b, 0x01, 0xf9, 0xa7, 0x64, 0xc2, 0x34, 0x18, 0xf2, 0x91, 0x5b, 0x2d,
+    0xd8, 0x2a, 0x4b, 0x23, 0x1c, 0x45, 0x04, 0x97, 0x77, 0xc4, 0x80, 0x18, 0x53, 0xeb, 0x56, 0x02,
+    0xec, 0x0c, 0x00, 0xcf, 0x61, 0x66, 0xe0, 0x76, 0x4c, 0xd3, 0x08, 0x1d, 0x95, 0xd6, 0x33, 0x66,
+    0x69, 0x3c, 0xd8, 0xac, 0x50, 0xd5, 0xaa, 0xd1, 0xae, 0xf8, 0x82, 0x94, 0x82, 0x59, 0x3b, 0xa6,
+    0x7e, 0x7e, 0xc6, 0x25, 0x98, 0x66, 0xf2, 0x30, 0xee, 0x35, 0xc0, 0x3c, 0x02, 0x11, 0x1c, 0x3e,
+    0x5d, 0x12, 0x62, 0xdb, 0x42, 0x7a, 0xcd, 0x6b, 0xeb, 0x22, 0xac, 0x97, 0xe6, 0x27, 0x47, 0x23,
+    0x4a, 0x4e, 0x06, 0x83, 0xe5, 0xf1, 0x60, 0x40, 0x3e, 0x2b, 0xa9, 0xb2, 0x54, 0x6f, 0xcc, 0x95,
+    0xae, 0x27, 0x7b, 0x84, 0x2c, 0x94, 0x8e, 0x2b, 0xb9, 0xa6, 0xaa, 0xb5, 0x50, 0xac, 0x4a, 0x1a,
+    0x94, 0xee, 0xcc, 0xb8, 0xb1, 0x97, 0xca, 0x28, 0x9d, 0xfc, 0xad, 0x24, 0x1e, 0x2b, 0xaf, 0x62,
+    0xf7, 0x4f, 0xdf, 0xdb, 0xd6, 0x08, 0x5a, 0x5c, 0xea, 0xda, 0x11, 0xb7, 0xd2, 0x68, 0x9a, 0x5b,
+    0x2e, 0x1a, 0x0d, 0xff, 0x75, 0xe5, 0x47, 0x28, 0x61, 0x65, 0x09, 0x1a, 0xcd, 0xc2, 0xe7, 0x6c,
+    0x0a, 0xe9, 0x77, 0x78, 0xb6, 0xbc, 0xaa, 0x40, 0xb6, 0x50, 0xed, 0x2e, 0xa0, 0xb1, 0x68, 0xcb,
+    0xac, 0x71, 0x73, 0x8b, 0xe9, 0x96, 0x38, 0x47, 0x79, 0x4a, 0xbc, 0x2f, 0x9f, 0xab, 0xe5, 0x98,
+    0x0e, 0xc8, 0x80, 0x8c, 0x4e, 0xf0, 0x87, 0x12, 0x5c, 0x0d, 0xda, 0x57, 0x86, 0xfd, 0x58, 0x67,
+    0xd4, 0x1d, 0xae, 0xb5, 0xac, 0x8d, 0x41, 0xf2, 0x0b, 0x25, 0x94, 0x59, 0xa3, 0xd1, 0xd1, 0xc7,
+    0x74, 0xd4, 0x31, 0x65, 0x34, 0x0c, 0x73, 0x33, 0x82, 0x5b, 0xfc, 0x3c, 0x1a, 0x92, 0xe1, 0xe9,
+    0xe2, 0x84, 0x8d, 0xc8, 0x88, 0xf8, 0xc9, 0x86, 0x09, 0x7e, 0xfd, 0x7c, 0xba, 0xd9, 0x4f, 0x46,
+    0x8b, 0xe4, 0x84, 0xa6, 0x7d, 0x6c, 0x4a, 0xac, 0xd0, 0x05, 0x81, 0x68, 0xc5, 0xa5, 0xc3, 0xad,
+    0x0c, 0xbf, 0x27, 0x1f, 0xc8, 0x70, 0x44, 0x8e, 0x09, 0x7e, 0xf4, 0xaa, 0x06, 0xb5, 0xe5, 0x10,
+    0x55, 0xd0, 0x2d, 0x56, 0xd8, 0x1e, 0x53, 0xb2, 0x1c, 0x35, 0x5d, 0xdf, 0x9e, 0x76, 0xa9, 0x67,
+    0x29, 0x9e, 0x5d, 0xc7, 0x90, 0xce, 0x6f, 0x98, 0x26, 0x4e, 0x11, 0x0b, 0x02, 0xfd, 0x84, 0x04,
+    0xb3, 0x65, 0x85, 0xc9, 0x33, 0xab, 0xd9, 0x83, 0x27, 0xcd, 0xb8, 0xb7, 0x8b, 0x32, 0xa4, 0x32,
+    0x6c, 0x4a, 0xbe, 0x25, 0xde, 0x00, 0xc8, 0x8a, 0x12, 0xf9, 0x96, 0x53, 0x3e, 0xce, 0x88, 0xc6,
+    0xdd, 0xf1, 0xb7, 0x6d, 0x08, 0xb5, 0xa3, 0x5b, 0xf6, 0xf8, 0xaf, 0x36, 0xe0, 0xcd, 0xfb, 0xe0,
+    0xc0, 0xc1, 0xd5, 0x1a, 0xf0, 0x7a, 0x8d, 0x85, 0x3b, 0x8b, 0x2e, 0x11, 0x6f, 0xd6, 0x99, 0xb7,
+    0xfa, 0x0f, 0x3d, 0xae, 0xbe, 0xe6, 0x6c, 0xbb, 0xbe, 0x6d, 0xf2, 0x25, 0x93, 0x0b, 0x66, 0x93,
+    0x7b, 0x83, 0xc1, 0x07, 0x85, 0xc3, 0x12, 0x22, 0xf6, 0x7b, 0x03, 0x75, 0x1c, 0x6c, 0x14, 0x0a,
+    0xf2, 0x56, 0xd5, 0xa6, 0x84, 0x8b, 0x00, 0x50, 0x3c, 0xb0, 0x38, 0xd4, 0xa1, 0xb7, 0x39, 0xb7,
+    0x77, 0x73, 0xb5, 0x00, 0x83, 0x1b, 0x6b, 0x66, 0x46, 0xe4, 0x4b, 0x03, 0xf4, 0xb8, 0xca, 0x2e,
+    0xc7, 0x8c, 0xc9, 0x4a, 0x3c, 0x84, 0xc9, 0x7d, 0xd4, 0xa2, 0x06, 0x71, 0x82, 0x92, 0x8a, 0x39,
+    0xd6, 0x30, 0x8c, 0x29, 0x02, 0x79, 0x8b, 0x71, 0xf7, 0xa1, 0x32, 0xbb, 0x54, 0xe6, 0x50, 0xaa,
+    0x62, 0x77, 0x55, 0xc5, 0xc1, 0xab, 0x2a, 0x76, 0x57, 0x55, 0x3c, 0xbf, 0xaa, 0x9e, 0xe1, 0x8e,
+    0xa1, 0x2e, 0xb8, 0xc5, 0x2f, 0x0d, 0xd8, 0x5a, 0x74, 0xc6, 0x40, 0x9d, 0x4f, 0xa2, 0x1c, 0x79,
+    0x5b, 0x71, 0x37, 0x03, 0x03, 0xd5, 0xbb, 0xb3, 0xd6, 0x1b, 0xb8, 0xeb, 0x83, 0x0d, 0x7f, 0xe3,
+    0x84, 0xa4, 0x89, 0x7c, 0x98, 0x5d, 0x30, 0x40, 0x03, 0x9f, 0xce, 0x30, 0x62, 0x63, 0x9a, 0xe9,
+    0xf3, 0xce, 0xee, 0x3b, 0xdd, 0x79, 0xd9, 0xfc, 0x25, 0x33, 0x4a, 0xd8, 0xe7, 0xee, 0x58, 0x14,
+    0x4b, 0xa6, 0x46, 0xd5, 0xba, 0x6b, 0xeb, 0x58, 0x5f, 0x80, 0xc8, 0xcf, 0x8d, 0x5f, 0xab, 0x04,
+    0x6b, 0xb3, 0x34, 0x22, 0xed, 0xd2, 0x9b, 0x69, 0xca, 0x60, 0xad, 0xd4, 0xe4, 0xa9, 0xe2, 0x41,
+    0x9d, 0x92, 0x39, 0x97, 0x63, 0x9a, 0x0c, 0xfd, 0x09, 0x60, 0x59, 0x83, 0xf1, 0xd3, 0x7f, 0x2d,
+    0x98, 0xa8, 0x51, 0x65, 0xd0, 0x99, 0x84, 0x7c, 0x50, 0xdc, 0x66, 0xfa, 0x8d, 0xa1, 0xf7, 0x0d,
+    0x9a, 0x68, 0x78, 0x88, 0xe9, 0x5f, 0xb0, 0xfd, 0x0b, 0x2f, 0xca, 0xac, 0x3b, 0x68, 0xf3, 0x65,
+    0xa3, 0xfc, 0xda, 0xad, 0xaf, 0x79, 0xfe, 0xcf, 0x8d, 0x7f, 0x0d, 0xa5, 0x4c, 0xff, 0xb6, 0xd7,
+    0x19, 0xac, 0x5a, 0x57, 0x3e, 0x97, 0xca, 0xcc, 0x99, 0xeb, 0x0b, 0x94, 0x4a, 0x87, 0x7c, 0xd3,
+    0x6c, 0xbd, 0xe0, 0x92, 0x19, 0x8c, 0xb4, 0x91, 0x08, 0xaa, 0xfc, 0x3c, 0x00, 0x59, 0x1a, 0xc5,
+    0xf6, 0xe6, 0xd1, 0xac, 0xbc, 0x2b, 0xb8, 0x43, 0xb7, 0x9f, 0xe0, 0xd7, 0x39, 0x7e, 0xbd, 0x98,
+    0x42, 0xf2, 0xc2, 0x57, 0xb9, 0xf9, 0x2f, 0xa1, 0x25, 0x6f, 0x05, 0x4c, 0x59, 0xb9, 0x7a, 0xd7,
+    0xcf, 0xe3, 0x73, 0xaa, 0x5f, 0xf9, 0x7f, 0x72, 0x77, 0x59, 0xc8, 0xaf, 0xad, 0x57, 0xb7, 0xa8,
+    0x9d, 0x7b, 0xcc, 0xd2, 0x85, 0x93, 0x04, 0xff, 0xfb, 0x2c, 0xad, 0x64, 0x15, 0x0e, 0x30, 0x5c,
+    0x10, 0x27, 0x7f, 0x05, 0x7c, 0x86, 0xd0, 0x3c, 0x34, 0x59, 0x1a, 0xb5, 0xf6, 0xa6, 0xd3, 0x06,
+    0x4b, 0x91, 0x0d, 0xb2, 0x6b, 0x90, 0x15, 0xcd, 0xfd, 0x6f, 0x5f, 0xad, 0x3c, 0x14, 0xd2, 0x6d,
+    0xac, 0x07, 0x94, 0x1a, 0xd6, 0x31, 0x57, 0xdb, 0x3d, 0x4a, 0xe5, 0x46, 0xb0, 0x60, 0xcf, 0x15,
+    0x0e, 0x8d, 0x20, 0x77, 0x30, 0xef, 0xbd, 0x51, 0xdb, 0xe2, 0xc1, 0xbf, 0x71, 0x9b, 0xa1, 0x77,
+    0xd6, 0x75, 0xb7, 0xba, 0xb4, 0x83, 0xf3, 0xc4, 0x13, 0x8b, 0xc8, 0x0d, 0x2c, 0x83, 0x01, 0x58,
+    0xb5, 0x7a, 0xc5, 0x3d, 0xd5, 0x46, 0x4d, 0x31, 0x2f, 0xc5, 0x5d, 0x37, 0xd9, 0x24, 0x22, 0xe7,
+    0xcc, 0xec, 0x55, 0x81, 0xf5, 0xb2, 0xfa, 0x72, 0x7d, 0x9b, 0xf6, 0xd2, 0x23, 0xf9, 0xfe, 0xc9,
+    0xf4, 0x00, 0x83, 0x3b, 0x85, 0x79, 0xa9, 0xcb, 0xde, 0x1d, 0x0e, 0x3e, 0x67, 0xeb, 0x85, 0x62,
+    0xf7, 0x42, 0x80, 0xf7, 0x81, 0xd0, 0x3c, 0xe3, 0x8e, 0xfb, 0xd0, 0xdd, 0x00, 0x06, 0xe6, 0xdc,
+    0xff, 0x26, 0x13, 0xe6, 0x1c, 0x18, 0xf9, 0x0a, 0xb2, 0x9f, 0xa0, 0xe1, 0xc3, 0x0f, 0x12, 0x38,
+    0xaf, 0x42, 0x59, 0x7f, 0x38, 0xe3, 0xb5, 0x00, 0xc0, 0x10, 0x1d, 0x9a, 0xa7, 0x34, 0xad, 0x07,
+    0x7e, 0xab, 0x94, 0x7b, 0xf2, 0x16, 0xd6, 0xf9, 0x8f, 0x93, 0xab, 0x33, 0xac, 0x4c, 0x54, 0x05,
+    0x79, 0xca, 0x34, 0x4f, 0xa3, 0xa3, 0x62, 0xd9, 0xe1, 0x11, 0xf2, 0xcf, 0xe6, 0x50, 0xdd, 0x04,
+    0xfd, 0x96, 0xa1, 0x6a, 0x7d, 0xe0, 0x01, 0xda, 0x79, 0x18, 0x6f, 0xce, 0xbc, 0x19, 0xe6, 0x32,
+    0x5b, 0x1a, 0xae, 0x1d, 0xb1, 0xa6, 0xc4, 0xc7, 0x3e, 0x56, 0xef, 0x47, 0x7f, 0x85, 0x7a, 0x3c,
+    0xc2, 0xfe, 0xc5, 0x1f, 0x9f, 0xfa, 0xf8, 0xb4, 0x0e, 0x7f, 0x6a, 0xf9, 0x17, 0x7f, 0x74, 0x9e,
+    0x42, 0x7c, 0x11, 0x00, 0x00,
+};
+
+// web_css.h: 6972 bytes, 1871 gzipped
+#define CSS_STYLES_GZ_LEN 1871
+#define CSS_STYLES_ETAG "\"f216a85139e93d17\""
+const uint8_t CSS_STYLES_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xb5, 0x59, 0x6d, 0x6f, 0xdb, 0x36,
+    0x10, 0xfe, 0x9e, 0x5f, 0x41, 0xb4, 0x28, 0x1a, 0x17, 0x96, 0x2b, 0xbf, 0xd6, 0xb1, 0x31, 0xa0,
+    0xeb, 0x80, 0x01, 0x03, 0x56, 0x74, 0x58, 0xd6, 0x4f, 0xc3, 0x3e, 0x50, 0x12, 0x65, 0x71, 0x91,
+    0x44, 0x81, 0xa2, 0xec, 0xa4, 0x41, 0xff, 0xfb, 0x8e, 0x22, 0x29, 0x91, 0x7a, 0xb1, 0x9d, 0x02,
+    0x73, 0x11, 0x43, 0x3e, 0x91, 0x77, 0xc7, 0xe3, 0x73, 0x0f, 0xef, 0xd8, 0x9b, 0x1d, 0x67, 0x4c,
+    0xa0, 0xe7, 0x1b, 0x04, 0x1f, 0xcf, 0x2b, 0x38, 0xcd, 0x30, 0x7f, 0xda, 0xa1, 0xd7, 0x8b, 0xf5,
+    0x66, 0x49, 0x82, 0xbd, 0x2b, 0xf7, 0x22, 0xcc, 0x1f, 0xe0, 0xe5, 0x3c, 0x5a, 0x91, 0x68, 0x6b,
+    0x5e, 0x96, 0x24, 0x64, 0x79, 0xa4, 0xa6, 0x6d, 0x56, 0x1f, 0x56, 0xdb, 0x66, 0x5a, 0x59, 0x85,
+    0x21, 0x29, 0x4b, 0xa9, 0x6e, 0x11, 0xae, 0xd7, 0xc4, 0xc8, 0x23, 0x9c, 0x1f, 0x08, 0x07, 0x31,
+    0x89, 0x57, 0xf0, 0x31, 0xe2, 0xe0, 0x00, 0xa2, 0x78, 0x1b, 0xe3, 0x38, 0x6c, 0x35, 0xf0, 0x18,
+    0x87, 0x44, 0xca, 0xeb, 0x8f, 0x91, 0x0b, 0xf2, 0x28, 0xa4, 0x23, 0x64, 0x71, 0xb7, 0x0c, 0x6c,
+    0xa1, 0x97, 0x55, 0x82, 0x44, 0x3d, 0x4f, 0x02, 0xc6, 0x23, 0x65, 0x71, 0x41, 0xb6, 0xb1, 0x6f,
+    0xc4, 0x1c, 0x47, 0xb4, 0x02, 0xff, 0xe6, 0x8b, 0xe2, 0xb1, 0x31, 0x99, 0xe0, 0x88, 0x9d, 0x76,
+    0xc8, 0x47, 0xab, 0xe2, 0x11, 0x6d, 0xe0, 0xcf, 0x9b, 0xc3, 0x17, 0x3f, 0x04, 0xb7, 0x3e, 0x92,
+    0xff, 0xde, 0x23, 0x7f, 0x36, 0x9f, 0xec, 0x6f, 0xbe, 0xdf, 0xdc, 0xbc, 0xd3, 0x91, 0x0b, 0xd8,
+    0xa3, 0x57, 0xd2, 0x6f, 0x34, 0x87, 0x15, 0x28, 0x53, 0x60, 0x51, 0x6b, 0x84, 0xc0, 0x1d, 0x68,
+    0x0e, 0xfa, 0xd4, 0xcf, 0x02, 0x47, 0x51, 0x3d, 0xce, 0x38, 0x71, 0x22, 0xc1, 0x03, 0x15, 0x9e,
+    0xc0, 0x85, 0x97, 0xd0, 0x43, 0x92, 0xc2, 0x9f, 0xf0, 0x42, 0x96, 0x32, 0x70, 0x57, 0x70, 0x9c,
+    0x97, 0x05, 0xe6, 0x24, 0x17, 0xb5, 0xbd, 0x80, 0x45, 0x4f, 0xda, 0x64, 0xcc, 0x72, 0xe1, 0xc5,
+    0x38, 0xa3, 0x29, 0xc4, 0xdd, 0xc3, 0x45, 0x91, 0x12, 0xaf, 0x7c, 0x2a, 0x05, 0xc9, 0xa6, 0xe8,
+    0x53, 0x4a, 0xf3, 0x87, 0xcf, 0x38, 0xbc, 0xaf, 0x7f, 0xff, 0x0a, 0x23, 0xa7, 0xe8, 0xed, 0x3d,
+    0x39, 0x30, 0x82, 0xbe, 0xfe, 0xf6, 0x76, 0x8a, 0xfe, 0x64, 0x01, 0x13, 0x6c, 0x8a, 0x4a, 0xd0,
+    0x0e, 0xdb, 0xc7, 0xa9, 0x8e, 0x6b, 0x80, 0xc3, 0x87, 0x03, 0x67, 0x55, 0x0e, 0x01, 0x3c, 0x62,
+    0x7e, 0x2b, 0xb7, 0x64, 0xa2, 0x5e, 0x69, 0x87, 0x94, 0x54, 0x06, 0x5a, 0xcb, 0x33, 0x9a, 0x7b,
+    0x09, 0x91, 0x3e, 0x43, 0x14, 0x7d, 0xff, 0x98, 0x28, 0x31, 0x38, 0x40, 0x5a, 0xf9, 0x6c, 0x5d,
+    0x7b, 0x3f, 0x03, 0x9c, 0x08, 0x0c, 0x6f, 0xb8, 0x5e, 0x43, 0x86, 0x1f, 0xbd, 0x13, 0x8d, 0x44,
+    0xb2, 0x43, 0x1b, 0xdf, 0x2f, 0xba, 0x01, 0x43, 0xb8, 0x12, 0xac, 0x13, 0xb5, 0xf9, 0xc6, 0x0c,
+    0xd3, 0x22, 0x08, 0xb4, 0x10, 0x2c, 0xdb, 0xa1, 0x65, 0xbd, 0x87, 0x60, 0x26, 0x21, 0x38, 0x6a,
+    0x4c, 0xd4, 0x98, 0xc0, 0x10, 0x54, 0x50, 0x18, 0x42, 0x18, 0x09, 0xef, 0x28, 0x5c, 0xc8, 0x5d,
+    0xf6, 0xed, 0x89, 0xc9, 0xdc, 0x0e, 0x31, 0x6c, 0x2b, 0x51, 0xa3, 0xf6, 0xad, 0xf0, 0xa4, 0x57,
+    0x06, 0x5e, 0xdb, 0x3e, 0x37, 0xbe, 0xac, 0xb4, 0x2b, 0xb3, 0xb2, 0x0a, 0x04, 0x15, 0x29, 0xd1,
+    0x1a, 0x7b, 0x51, 0x54, 0x70, 0x9d, 0xec, 0xbb, 0xf6, 0xe6, 0x46, 0xc3, 0xfb, 0x77, 0xe8, 0x6b,
+    0x91, 0x32, 0x1c, 0xa1, 0x7b, 0x12, 0x0a, 0xca, 0x72, 0xf4, 0xee, 0xfd, 0xcd, 0xac, 0xaa, 0x45,
+    0x32, 0xf3, 0x6a, 0xd1, 0xf3, 0x90, 0x0f, 0x8b, 0xc6, 0x89, 0x88, 0xb3, 0xc2, 0xfb, 0xc6, 0x72,
+    0xe3, 0x45, 0x7f, 0x9b, 0x75, 0x9a, 0x69, 0x3f, 0x4c, 0xb2, 0x40, 0x40, 0x51, 0x84, 0xcb, 0x84,
+    0x44, 0x06, 0x0d, 0xf5, 0x0b, 0x67, 0x54, 0x93, 0x42, 0x6a, 0x84, 0xfa, 0x35, 0xe9, 0xc4, 0x78,
+    0xb5, 0x05, 0x4d, 0x6d, 0x08, 0xc7, 0xf6, 0x24, 0xac, 0x78, 0x29, 0xc3, 0x53, 0x30, 0xda, 0x0a,
+    0xeb, 0x14, 0xa0, 0x72, 0x99, 0x3b, 0x84, 0xd3, 0x14, 0x72, 0x6f, 0x51, 0x22, 0x82, 0x4b, 0xd2,
+    0x59, 0xdb, 0x2e, 0x61, 0x47, 0xc2, 0xa7, 0xa8, 0x95, 0xc0, 0x13, 0x3e, 0x48, 0x61, 0x93, 0xa4,
+    0xb5, 0xc3, 0xce, 0x1e, 0x68, 0x62, 0x9b, 0xf4, 0xf1, 0x0f, 0xdc, 0x14, 0x6f, 0x24, 0xe1, 0xb8,
+    0x56, 0x30, 0x44, 0xfc, 0x68, 0x02, 0x59, 0xfb, 0x16, 0x33, 0x0e, 0xd1, 0x2e, 0x43, 0x9c, 0x92,
+    0x5b, 0x7f, 0x76, 0x77, 0x37, 0xb1, 0xa6, 0xd0, 0xb0, 0xd9, 0x1d, 0x8d, 0x73, 0x19, 0x0a, 0x65,
+    0xcc, 0x64, 0x47, 0x2b, 0x71, 0x3c, 0x6b, 0x58, 0x75, 0x32, 0x88, 0x30, 0x95, 0x07, 0x8d, 0x21,
+    0x99, 0x59, 0x10, 0x49, 0x54, 0xf4, 0xa1, 0xdb, 0x66, 0xcc, 0x50, 0x0e, 0xf7, 0x34, 0xcc, 0x12,
+    0x08, 0xfe, 0x80, 0x96, 0xd5, 0xa8, 0x96, 0x06, 0xc3, 0x0a, 0xae, 0x7f, 0x70, 0x72, 0xa4, 0xe4,
+    0xe4, 0xe0, 0xb5, 0x50, 0xb2, 0x0e, 0x60, 0xaf, 0xc3, 0xe1, 0x55, 0x08, 0x6b, 0x17, 0x39, 0x98,
+    0x05, 0x0d, 0x47, 0x6b, 0x6e, 0xd7, 0xd6, 0xea, 0x5f, 0x3a, 0x08, 0xc6, 0xc5, 0x3e, 0x47, 0x8d,
+    0xc4, 0x3d, 0xc4, 0xf9, 0x11, 0x97, 0xde, 0x89, 0x03, 0xf7, 0x36, 0xa3, 0x0b, 0x66, 0xb0, 0xca,
+    0x49, 0x8a, 0x25, 0x54, 0xf6, 0xf6, 0xee, 0x03, 0x43, 0xbe, 0x19, 0x80, 0x5a, 0x3c, 0x8f, 0xd7,
+    0xf1, 0xdd, 0xe0, 0xa2, 0x1b, 0x70, 0x48, 0x20, 0xc7, 0xa9, 0x74, 0x3e, 0xa1, 0x51, 0x44, 0x72,
+    0x9d, 0x1d, 0xac, 0x0a, 0x13, 0x0f, 0x87, 0xca, 0x66, 0x0e, 0x08, 0x1d, 0x74, 0x4e, 0xfd, 0xd4,
+    0x3e, 0x46, 0xb4, 0x2c, 0x52, 0x0c, 0xa7, 0x46, 0x90, 0xb2, 0xf0, 0x61, 0xc4, 0x3f, 0x83, 0x4e,
+    0x45, 0xc1, 0x6a, 0x67, 0x7f, 0x01, 0x9c, 0xa0, 0x2f, 0xe0, 0x07, 0xcc, 0xae, 0xb7, 0x35, 0x94,
+    0xc0, 0x61, 0x5a, 0xd0, 0x0d, 0x00, 0x0e, 0x4a, 0x96, 0x02, 0x32, 0xfa, 0x9c, 0x02, 0x72, 0x1a,
+    0x5d, 0x4c, 0x40, 0x38, 0x70, 0xf1, 0xed, 0xf2, 0xc3, 0x14, 0xdd, 0xdd, 0x4d, 0xd1, 0x62, 0xb9,
+    0x9e, 0xea, 0x63, 0xd7, 0x66, 0x8a, 0x8c, 0x99, 0x00, 0x8f, 0x06, 0x42, 0xba, 0x98, 0xe0, 0x3c,
+    0x4a, 0x49, 0x79, 0xc1, 0x45, 0x9a, 0x97, 0x44, 0xec, 0xf4, 0x59, 0x30, 0x53, 0x73, 0x2e, 0x4c,
+    0xd1, 0x61, 0x6b, 0x41, 0x66, 0xc2, 0x66, 0xc1, 0xae, 0x07, 0xf2, 0xce, 0x92, 0x7b, 0x81, 0x39,
+    0x25, 0xd4, 0x8d, 0x5a, 0x03, 0x86, 0xb5, 0xd9, 0x1d, 0x8b, 0x78, 0xea, 0x47, 0x80, 0x1a, 0xb9,
+    0xf5, 0xe0, 0xf5, 0x14, 0xc9, 0xef, 0x89, 0xbd, 0x84, 0x99, 0x48, 0xd1, 0x33, 0xc4, 0xa7, 0x90,
+    0x4b, 0x43, 0x29, 0x89, 0xeb, 0x35, 0x36, 0x21, 0xcc, 0x4f, 0x25, 0xf1, 0x38, 0x91, 0x59, 0xbe,
+    0x47, 0xdf, 0xdb, 0x49, 0xdc, 0x9a, 0xc4, 0xd5, 0xa2, 0xe0, 0x69, 0xd0, 0xb0, 0x65, 0xb7, 0x55,
+    0x4b, 0xca, 0xd3, 0x80, 0xda, 0x40, 0xfa, 0x62, 0x72, 0xc9, 0x76, 0xe7, 0xcc, 0x8a, 0xae, 0x53,
+    0xcc, 0x5d, 0xc5, 0xd7, 0xb8, 0xdc, 0x51, 0xec, 0x06, 0xa2, 0x65, 0x04, 0x90, 0x55, 0xa9, 0x70,
+    0xe9, 0xa0, 0x8e, 0x4c, 0x4b, 0x3a, 0x43, 0x27, 0xda, 0x80, 0x8a, 0xe2, 0xc7, 0x78, 0x75, 0x80,
+    0x86, 0xb6, 0x86, 0x85, 0x3a, 0x16, 0x9c, 0x44, 0xb7, 0xca, 0xab, 0xb1, 0xc4, 0xb6, 0x11, 0x38,
+    0xef, 0xa4, 0xe6, 0xb9, 0xd3, 0x7e, 0x10, 0xde, 0x1a, 0xb8, 0x9a, 0x2c, 0x60, 0x8d, 0x9c, 0xa5,
+    0xa5, 0x22, 0x0a, 0xf3, 0xa3, 0xc3, 0x40, 0x71, 0x4a, 0x4c, 0x59, 0x05, 0x4f, 0x5e, 0x44, 0x39,
+    0xd1, 0x19, 0x0c, 0xd1, 0xa8, 0x32, 0x4d, 0x72, 0x07, 0x5c, 0xd8, 0x25, 0xfa, 0x38, 0x23, 0x2b,
+    0x2b, 0x9e, 0xf4, 0xa7, 0x18, 0x37, 0x55, 0xef, 0x93, 0x07, 0xae, 0x66, 0xa5, 0x5b, 0x7f, 0x58,
+    0x76, 0xfa, 0xea, 0x52, 0x1c, 0x90, 0xd4, 0x3d, 0xcb, 0xb7, 0xbe, 0x53, 0x14, 0xbe, 0xe8, 0xa0,
+    0xec, 0x68, 0xa7, 0x79, 0x51, 0x89, 0xbf, 0xc5, 0x53, 0x41, 0x7e, 0x7a, 0xc5, 0x65, 0x77, 0xf4,
+    0xea, 0x1f, 0x83, 0x15, 0xf0, 0x1b, 0xb4, 0xba, 0x9b, 0xd7, 0x00, 0xcf, 0x74, 0x0f, 0x92, 0xe6,
+    0x31, 0x4c, 0x94, 0xad, 0x92, 0x22, 0xbf, 0x91, 0x7a, 0xfe, 0xcc, 0x9e, 0x2e, 0x9b, 0xa3, 0xa6,
+    0x12, 0xb2, 0x7e, 0x77, 0x68, 0xf4, 0x92, 0xb7, 0xbb, 0x9d, 0x71, 0xa5, 0x04, 0x04, 0x81, 0x56,
+    0x91, 0x54, 0x59, 0x60, 0x1a, 0xcb, 0xb3, 0x5e, 0x1a, 0x12, 0xf5, 0x7b, 0x24, 0xea, 0xbf, 0x8c,
+    0x44, 0xfb, 0x3c, 0xd9, 0xab, 0x28, 0xfb, 0x6b, 0x29, 0x49, 0x0a, 0x98, 0x1b, 0x0a, 0x76, 0x53,
+    0x5c, 0x6c, 0xce, 0x6e, 0xf3, 0x8f, 0xa4, 0xcf, 0x66, 0x68, 0x61, 0x4e, 0xb3, 0x67, 0x01, 0x88,
+    0xe6, 0x09, 0xb4, 0x68, 0x62, 0xd0, 0xf9, 0x02, 0x77, 0xeb, 0x4b, 0x7f, 0x88, 0x93, 0x6a, 0x36,
+    0x3c, 0xb3, 0x06, 0xa7, 0x99, 0xcc, 0x58, 0xce, 0x40, 0x71, 0xd8, 0xa4, 0xf2, 0xcf, 0x75, 0x4e,
+    0xaa, 0x4c, 0xc6, 0xfa, 0x79, 0x34, 0xbb, 0xdc, 0x24, 0x82, 0xd9, 0x9f, 0x2a, 0xc8, 0x53, 0x3d,
+    0x3b, 0x10, 0x79, 0x77, 0x26, 0xcd, 0xeb, 0x5e, 0xf1, 0x8a, 0xf4, 0xfc, 0xb7, 0x2a, 0x05, 0x8d,
+    0x9f, 0x4c, 0xa5, 0x3a, 0xd2, 0xcf, 0x49, 0xd3, 0xdd, 0x76, 0xad, 0x5b, 0x08, 0x3b, 0x3d, 0xdc,
+    0xda, 0xf4, 0x70, 0x66, 0x23, 0xad, 0xfc, 0x19, 0xa9, 0xc5, 0x7e, 0xa4, 0x51, 0x81, 0xa5, 0x5f,
+    0x6e, 0x1e, 0xb6, 0x93, 0x76, 0x30, 0x44, 0x08, 0x07, 0x29, 0xf4, 0x5e, 0x6a, 0x38, 0x83, 0x1d,
+    0xa1, 0x02, 0x02, 0xe6, 0xcb, 0x6e, 0xda, 0xf6, 0x22, 0x67, 0x72, 0x9f, 0xa1, 0x34, 0x24, 0x51,
+    0x33, 0xdb, 0xe4, 0xc7, 0x10, 0xae, 0x2f, 0x25, 0x93, 0x86, 0x5d, 0xcb, 0xe6, 0xb6, 0x42, 0xd5,
+    0x66, 0xed, 0xc0, 0xe6, 0x6d, 0xe3, 0xe1, 0x64, 0xb4, 0x9e, 0xb7, 0xef, 0x8d, 0xda, 0xa5, 0xb5,
+    0xbd, 0xcd, 0xe8, 0x44, 0x27, 0x79, 0xc6, 0xfa, 0x16, 0x47, 0xd5, 0xb5, 0x8e, 0xbd, 0x0e, 0x83,
+    0x68, 0x4d, 0xe6, 0x96, 0x86, 0x4c, 0xee, 0xd6, 0xb3, 0x8b, 0x22, 0xd9, 0xb0, 0xce, 0x2f, 0xe4,
+    0xfd, 0x85, 0xee, 0x65, 0xec, 0xc6, 0xe4, 0x22, 0x5f, 0x38, 0x8e, 0xbd, 0x2c, 0xde, 0xf5, 0x75,
+    0x8d, 0x4a, 0xbb, 0x7b, 0x81, 0x45, 0x55, 0x3a, 0x5d, 0x58, 0x59, 0x8b, 0xae, 0xbd, 0x35, 0xd0,
+    0xa3, 0x03, 0xcc, 0xff, 0x87, 0x76, 0x6d, 0xe1, 0xc4, 0xf7, 0x42, 0x6b, 0xa6, 0x3d, 0x91, 0x94,
+    0x70, 0x81, 0x77, 0xb6, 0xa3, 0x3b, 0x66, 0xe9, 0xb1, 0x4f, 0xf2, 0xf3, 0x67, 0xb4, 0x9e, 0x70,
+    0xc4, 0x69, 0x45, 0xec, 0xd2, 0xcd, 0xa1, 0x0e, 0x55, 0x85, 0xb1, 0x03, 0x54, 0x60, 0x76, 0xb4,
+    0x9c, 0x42, 0x71, 0xd1, 0x3d, 0xda, 0x36, 0xe3, 0x28, 0xba, 0xee, 0x88, 0xee, 0x75, 0x83, 0x8e,
+    0x1b, 0x31, 0x6d, 0x20, 0x6d, 0x5d, 0xce, 0xbd, 0xb9, 0x2e, 0xff, 0xf5, 0x49, 0xe2, 0xf4, 0x1a,
+    0x9a, 0xd7, 0xea, 0x57, 0xc0, 0x40, 0x4b, 0x8b, 0xd9, 0x00, 0x6b, 0x7f, 0x31, 0x59, 0xdb, 0xd9,
+    0x50, 0x13, 0x52, 0xd2, 0x41, 0xda, 0xe5, 0x4d, 0x93, 0x35, 0xa0, 0x6c, 0x59, 0xc1, 0x10, 0x7c,
+    0xef, 0xcf, 0xe2, 0x13, 0xcc, 0xfe, 0xca, 0x18, 0xb0, 0xaf, 0xb4, 0x17, 0xab, 0xa7, 0x2b, 0xaf,
+    0xfc, 0xce, 0xdc, 0x88, 0x8c, 0xde, 0xc7, 0x99, 0x03, 0x4d, 0x5b, 0x0a, 0x59, 0x44, 0xae, 0x23,
+    0xaf, 0xf6, 0xa2, 0x51, 0xdd, 0x26, 0x9f, 0x2f, 0xa7, 0xcf, 0x1f, 0xc4, 0x9f, 0x59, 0x40, 0xa1,
+    0x27, 0xfd, 0x52, 0x08, 0x9a, 0xd1, 0x6f, 0xb8, 0x39, 0x95, 0x3f, 0x66, 0x24, 0xa2, 0x18, 0xdd,
+    0x5a, 0x05, 0xff, 0x4a, 0x16, 0xa7, 0x86, 0x28, 0x7a, 0x17, 0xaf, 0xbd, 0x64, 0x54, 0xd6, 0xc1,
+    0x8a, 0x82, 0x8c, 0x75, 0x81, 0xda, 0x8b, 0x9c, 0xb9, 0xb8, 0x76, 0x07, 0x37, 0x97, 0xa6, 0xdd,
+    0x8b, 0x53, 0xbf, 0xa3, 0xbc, 0x77, 0x1b, 0xe9, 0x18, 0x58, 0xba, 0xc4, 0x60, 0xe6, 0x38, 0xcd,
+    0xb8, 0x85, 0xd1, 0x65, 0xe3, 0xba, 0x0d, 0xf5, 0x65, 0x77, 0x41, 0x9d, 0xaa, 0xe5, 0x52, 0xbf,
+    0x61, 0x66, 0xb5, 0xd5, 0xca, 0xe0, 0x15, 0x89, 0x19, 0x36, 0x84, 0xf5, 0x8b, 0xf5, 0xca, 0x77,
+    0xbd, 0xa5, 0xbf, 0x33, 0x2c, 0x57, 0x5e, 0xd3, 0x35, 0xa9, 0x53, 0x27, 0xd5, 0x92, 0xf3, 0x17,
+    0x4a, 0xba, 0xf4, 0xf0, 0xc8, 0x11, 0x94, 0x96, 0x76, 0xa9, 0xae, 0xe7, 0xef, 0x76, 0x38, 0x6e,
+    0x73, 0xa2, 0xf1, 0xe1, 0xed, 0xdb, 0xfd, 0x95, 0x97, 0x20, 0x83, 0xf7, 0x31, 0x8b, 0xf5, 0x7a,
+    0x8a, 0xda, 0x2f, 0x7f, 0xb6, 0xd5, 0x30, 0x7f, 0x49, 0x9f, 0x35, 0x1a, 0x18, 0x5d, 0x6e, 0xe6,
+    0xc0, 0x46, 0x86, 0x49, 0x3e, 0x3e, 0x90, 0xa7, 0x98, 0xe3, 0x8c, 0x94, 0xa8, 0xa8, 0xd2, 0xd2,
+    0x60, 0x40, 0xb6, 0xef, 0x72, 0x27, 0xa0, 0xe9, 0x6f, 0x0a, 0xa3, 0xb9, 0x6c, 0xdb, 0xe5, 0xcb,
+    0xb5, 0x2b, 0x97, 0x05, 0x93, 0x8a, 0xb7, 0x24, 0x48, 0xf9, 0x1f, 0x52, 0x32, 0xbc, 0x43, 0xe4,
+    0x8e, 0x8d, 0xe5, 0x9d, 0x36, 0x36, 0x9f, 0xad, 0x15, 0xd3, 0x79, 0x40, 0x41, 0xd0, 0x16, 0x41,
+    0x78, 0x62, 0x9a, 0xeb, 0xba, 0xe8, 0x3f, 0xe6, 0xe2, 0xae, 0x35, 0x3c, 0x1b, 0x00, 0x00,
+};
+
+// web_js.h: 31451 bytes, 7661 gzipped
+#define JS_APP_GZ_LEN 7661
+#define JS_APP_ETAG "\"1fe6a92fb08234f0\""
+const uint8_t JS_APP_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xcd, 0x3d, 0x6b, 0x77, 0xd3, 0xc8,
+    0x92, 0xdf, 0xf9, 0x15, 0xcd, 0xd9, 0xbb, 0x48, 0x26, 0xb6, 0x63, 0x07, 0x32, 0xc3, 0xc4, 0x13,
+    0xe6, 0x40, 0x80, 0x09, 0xbb, 0x3c, 0x72, 0x70, 0x58, 0xe0, 0x72, 0xb8, 0x73, 0x14, 0xbb, 0x1d,
+    0x0b, 0x64, 0xc9, 0x2b, 0xc9, 0x71, 0x3c, 0x33, 0xf9, 0xef, 0x5b, 0x55, 0xdd, 0x2d, 0xf5, 0x4b,
+    0x8a, 0x21, 0xb0, 0xbb, 0x39, 0x33, 0x21, 0x6a, 0x55, 0x57, 0x57, 0x57, 0x57, 0x55, 0x57, 0x55,
+    0x3f, 0x74, 0x2b, 0x9c, 0xad, 0xd2, 0x49, 0x19, 0x67, 0x69, 0xd8, 0x61, 0x7f, 0xdd, 0x62, 0xf0,
+    0x13, 0xac, 0x0a, 0xce, 0x8a, 0x32, 0x8f, 0x27, 0x65, 0x30, 0xba, 0x45, 0x45, 0xbb, 0xbb, 0xec,
+    0x49, 0x5c, 0x2c, 0x93, 0x68, 0xc3, 0xa6, 0xf1, 0x82, 0xa7, 0x05, 0xc0, 0x17, 0xf4, 0x66, 0x02,
+    0x7f, 0x94, 0xec, 0xc9, 0xf3, 0xf1, 0xc9, 0x8b, 0x47, 0x1f, 0xfe, 0x78, 0xf7, 0xfc, 0xc9, 0xe9,
+    0x31, 0x3b, 0x64, 0xf7, 0x07, 0x83, 0x91, 0xe7, 0xf5, 0xf1, 0xd3, 0xe7, 0xbf, 0x1f, 0x9f, 0xc2,
+    0xfb, 0x7b, 0xe6, 0xfb, 0x47, 0xe3, 0x93, 0xa7, 0x47, 0xa7, 0x7f, 0xbc, 0x79, 0x74, 0xfa, 0xfc,
+    0x35, 0xbc, 0x35, 0xb1, 0xed, 0x5a, 0xd5, 0x35, 0x92, 0x5e, 0xbf, 0x64, 0x4f, 0x13, 0x0e, 0xf4,
+    0x94, 0x3a, 0x31, 0xff, 0x00, 0x14, 0x61, 0xd1, 0x61, 0x87, 0x0f, 0xd9, 0x34, 0x9b, 0xac, 0xf0,
+    0x75, 0xff, 0xbf, 0x57, 0x3c, 0xdf, 0x8c, 0x79, 0xc2, 0x27, 0x65, 0x96, 0xc3, 0x4b, 0xbd, 0xf5,
+    0x69, 0x9e, 0x2d, 0xff, 0x99, 0xa5, 0x1c, 0xaa, 0xfd, 0x23, 0x0c, 0xfe, 0x4d, 0x3d, 0x06, 0x06,
+    0xd0, 0x2c, 0x4e, 0xf8, 0xf3, 0x74, 0xb9, 0x2a, 0x25, 0x54, 0xf5, 0x6c, 0x82, 0x2d, 0x73, 0x7e,
+    0x11, 0xf3, 0xf5, 0x98, 0x13, 0x4b, 0x25, 0xac, 0x59, 0x68, 0x56, 0x28, 0xb2, 0x55, 0x3e, 0xe1,
+    0x47, 0x51, 0x7a, 0x11, 0x15, 0x12, 0x5c, 0x2f, 0xf2, 0x62, 0x37, 0xa0, 0x8d, 0x32, 0x13, 0x7c,
+    0x02, 0x3d, 0x79, 0x7d, 0xc1, 0x73, 0x1c, 0x36, 0x01, 0xac, 0x95, 0x58, 0xa0, 0x54, 0xfd, 0x5d,
+    0x1e, 0x2d, 0x97, 0x3c, 0x57, 0xc0, 0x7a, 0x99, 0x09, 0x7e, 0x96, 0xc7, 0xe7, 0xf3, 0x32, 0xe5,
+    0x45, 0x31, 0x4e, 0xe2, 0x69, 0x55, 0xa3, 0x2e, 0xb6, 0xb0, 0x67, 0x69, 0x99, 0x47, 0x45, 0x69,
+    0x00, 0xab, 0xc2, 0x26, 0xcc, 0xff, 0x15, 0x25, 0x0e, 0x5a, 0x28, 0xf3, 0x63, 0xae, 0x81, 0xb5,
+    0x12, 0x13, 0x74, 0xb5, 0x4c, 0xb2, 0x68, 0xfa, 0x2c, 0xcb, 0x17, 0x91, 0x1a, 0x44, 0xbd, 0xc8,
+    0x22, 0xa3, 0x4c, 0xc7, 0x3c, 0x9d, 0x2a, 0x02, 0xc4, 0x93, 0x03, 0xf2, 0x86, 0x17, 0xbc, 0xac,
+    0x61, 0xe8, 0xd1, 0x01, 0x3a, 0x4a, 0x78, 0x94, 0xd7, 0x40, 0xf4, 0xe8, 0x00, 0x9d, 0xf2, 0x42,
+    0x43, 0x84, 0x4f, 0x2e, 0x3d, 0x09, 0xe7, 0x4b, 0x8d, 0x20, 0x7c, 0xb4, 0x64, 0xa9, 0x8c, 0xca,
+    0x55, 0x71, 0xca, 0x2f, 0x15, 0xaa, 0xba, 0xc0, 0x96, 0xa3, 0xec, 0x3c, 0x07, 0x76, 0x3e, 0xae,
+    0x08, 0xd3, 0x4a, 0xfc, 0xa0, 0xcf, 0xe2, 0x24, 0xb1, 0x60, 0xb1, 0x08, 0x81, 0x95, 0x3a, 0x8e,
+    0xa1, 0x35, 0x4e, 0x0f, 0x09, 0x70, 0x25, 0x83, 0x41, 0x8b, 0xd3, 0x28, 0x79, 0xbe, 0x88, 0xce,
+    0x51, 0xb5, 0xd2, 0x55, 0x92, 0x8c, 0xaa, 0xb7, 0x28, 0x88, 0x6f, 0x40, 0x1f, 0xe0, 0xc5, 0x5f,
+    0xec, 0xf2, 0x80, 0x0d, 0xba, 0x6c, 0x43, 0xbf, 0xd7, 0x07, 0xa6, 0xfa, 0x77, 0xd9, 0xfc, 0xc0,
+    0xb6, 0x1f, 0x57, 0x35, 0x9e, 0x62, 0x12, 0x25, 0x88, 0x7d, 0x58, 0x17, 0xc5, 0xc5, 0x93, 0x3c,
+    0x3a, 0x87, 0xb6, 0xcf, 0xa1, 0x7c, 0x16, 0x25, 0x05, 0xaf, 0xdf, 0x4d, 0xe1, 0xcd, 0x71, 0x94,
+    0x4e, 0x13, 0x97, 0x22, 0x7c, 0x05, 0x3d, 0xc8, 0x6d, 0x92, 0xf4, 0xd6, 0x90, 0x6a, 0x1f, 0x0c,
+    0x91, 0x3d, 0x20, 0x52, 0x09, 0x5e, 0x71, 0xe4, 0x08, 0x64, 0x11, 0x98, 0x5f, 0xb8, 0xfa, 0x5e,
+    0x5e, 0x02, 0x0a, 0x5d, 0xd1, 0xfb, 0xe7, 0xbc, 0x94, 0xe0, 0x61, 0xb0, 0x37, 0x0d, 0xba, 0xd0,
+    0xc0, 0x1a, 0x18, 0xfc, 0x86, 0x83, 0x80, 0xe6, 0x1c, 0xec, 0x57, 0x5a, 0x26, 0xd0, 0x56, 0x99,
+    0xaf, 0x38, 0xbb, 0xf2, 0x5a, 0x05, 0xc2, 0x69, 0x98, 0x83, 0xaf, 0x46, 0xaa, 0x08, 0x3f, 0xdc,
+    0xfe, 0x47, 0x1f, 0xfd, 0x55, 0xc1, 0x5e, 0x46, 0x29, 0x8c, 0x37, 0xda, 0xdc, 0x6f, 0xc5, 0xa5,
+    0xe6, 0x23, 0x06, 0xca, 0x24, 0x90, 0x86, 0xd8, 0x81, 0x2e, 0x0c, 0xec, 0x49, 0x9e, 0x4d, 0x40,
+    0xf0, 0xb4, 0xa1, 0x55, 0x73, 0x16, 0xfe, 0xd4, 0xd2, 0xde, 0xc7, 0x0a, 0xd4, 0xf1, 0x14, 0x87,
+    0x0a, 0x9f, 0x46, 0x15, 0x58, 0x35, 0x27, 0x9c, 0x65, 0xd3, 0x4d, 0x7f, 0x92, 0x44, 0x45, 0xf1,
+    0x22, 0x2e, 0xa0, 0x4e, 0x76, 0x7e, 0x9e, 0xf0, 0x30, 0x58, 0x56, 0x8d, 0x04, 0x66, 0x9b, 0x92,
+    0xe9, 0x57, 0xb7, 0x2c, 0x32, 0xe7, 0xd9, 0xfa, 0x44, 0xaa, 0x44, 0x08, 0x96, 0x72, 0x02, 0xb8,
+    0x75, 0xb2, 0x34, 0xd5, 0xea, 0x17, 0xe5, 0x26, 0xe1, 0xfd, 0xa9, 0x9c, 0x4a, 0x0f, 0x59, 0x70,
+    0x96, 0x64, 0x93, 0x2f, 0xc1, 0xc8, 0x01, 0x46, 0xdd, 0x92, 0xd0, 0xeb, 0x78, 0x5a, 0xce, 0x71,
+    0x64, 0x05, 0x6a, 0xb6, 0xc3, 0x82, 0x7f, 0x0f, 0xfc, 0xa4, 0xcc, 0xc1, 0xbc, 0x56, 0xa4, 0x6c,
+    0x4d, 0x43, 0x8a, 0x93, 0xdd, 0x56, 0x24, 0x04, 0x03, 0xab, 0xe5, 0x6f, 0x13, 0x15, 0xc0, 0xcc,
+    0x19, 0xa9, 0x21, 0x8e, 0x64, 0x8f, 0x8d, 0x57, 0xcb, 0x65, 0x06, 0x4a, 0x35, 0xcb, 0x72, 0xf6,
+    0x1f, 0x27, 0xbf, 0x77, 0xd9, 0xc9, 0x2b, 0xf8, 0x05, 0xca, 0x7e, 0xf4, 0xad, 0x8d, 0x44, 0xc5,
+    0x26, 0x9d, 0x68, 0x7c, 0x21, 0x95, 0xc7, 0x66, 0x43, 0x9c, 0xb7, 0x75, 0xce, 0xc4, 0x33, 0x16,
+    0xde, 0xb6, 0x0b, 0x49, 0x9a, 0x2a, 0xe9, 0x0b, 0x5e, 0x65, 0x34, 0xfd, 0x43, 0x11, 0xfa, 0x0f,
+    0xbc, 0x9a, 0x07, 0xd4, 0x4f, 0xce, 0xcb, 0x55, 0x9e, 0xd6, 0x65, 0x92, 0x39, 0x4a, 0x43, 0x33,
+    0xe0, 0x60, 0x92, 0x9d, 0x87, 0x01, 0xf5, 0xbb, 0xdc, 0x2c, 0xf9, 0x01, 0x48, 0x16, 0x62, 0xec,
+    0xe3, 0x43, 0x97, 0x05, 0xaf, 0xa2, 0x45, 0x5d, 0x96, 0xc2, 0x83, 0xd6, 0x80, 0x46, 0xc7, 0x0b,
+    0x98, 0xac, 0x90, 0x63, 0x31, 0x9a, 0xd4, 0x7e, 0xbf, 0x0f, 0x35, 0x50, 0x73, 0x95, 0xde, 0x2a,
+    0xa3, 0x33, 0xe7, 0x93, 0x2f, 0xd8, 0xaf, 0x8a, 0x81, 0xb5, 0xa9, 0x88, 0x8b, 0x63, 0x1e, 0x4f,
+    0x50, 0x79, 0x54, 0x4b, 0x20, 0xf6, 0x2f, 0xb2, 0x35, 0xcf, 0x8f, 0xa2, 0x82, 0x87, 0x9d, 0x3e,
+    0xcc, 0x72, 0xc5, 0xbb, 0xb8, 0x9c, 0x87, 0x41, 0x7f, 0x0e, 0x90, 0x41, 0x87, 0xfd, 0xfd, 0xb7,
+    0xd1, 0x57, 0xed, 0x67, 0x3b, 0x1c, 0xb3, 0xeb, 0x71, 0x20, 0x17, 0x70, 0x88, 0x59, 0x40, 0x3d,
+    0xdb, 0xa5, 0x96, 0xbf, 0xa1, 0xd2, 0x2c, 0xd0, 0x38, 0x81, 0x03, 0x2b, 0xba, 0xdb, 0x32, 0xb2,
+    0xc8, 0x22, 0x14, 0x3b, 0x74, 0x09, 0x7a, 0x2c, 0x11, 0xfc, 0x45, 0xce, 0x76, 0xbc, 0xa3, 0x09,
+    0xdc, 0x3d, 0xcd, 0x37, 0x6c, 0xb1, 0x4a, 0xca, 0x78, 0x09, 0x63, 0xb9, 0xe0, 0xe5, 0x3c, 0x9b,
+    0x16, 0xac, 0xcc, 0xa8, 0x2e, 0x2b, 0xe7, 0x5c, 0x0c, 0x4e, 0x55, 0x03, 0x67, 0x0d, 0x7c, 0xc5,
+    0xa7, 0xe6, 0x3c, 0xa8, 0xa3, 0x7c, 0x49, 0x58, 0xd8, 0xf0, 0x80, 0x90, 0x4f, 0x72, 0x0e, 0xd3,
+    0x28, 0x41, 0x3f, 0x8e, 0xcb, 0x45, 0xb4, 0x64, 0xe1, 0x19, 0x2f, 0x4b, 0x70, 0x9b, 0x24, 0x9d,
+    0x85, 0xd0, 0x96, 0x8e, 0xd1, 0xd3, 0xc0, 0xa9, 0x16, 0xb0, 0x38, 0x05, 0x63, 0x9f, 0x4e, 0xb3,
+    0xb5, 0xcd, 0x80, 0x12, 0x9a, 0xf9, 0xcb, 0x61, 0xae, 0x21, 0xaa, 0x40, 0x09, 0x4a, 0x9a, 0x83,
+    0xd5, 0xe2, 0x8d, 0x29, 0x5d, 0x67, 0x82, 0xde, 0x43, 0x16, 0xad, 0xa3, 0xb8, 0x74, 0x2b, 0x0b,
+    0xe5, 0x73, 0x6b, 0x8b, 0x99, 0x12, 0xdc, 0xd2, 0x0a, 0x05, 0x30, 0x54, 0x78, 0x9f, 0xc8, 0xd2,
+    0x14, 0x1f, 0x4d, 0xb6, 0x9a, 0xed, 0x4e, 0x94, 0x3f, 0x5c, 0x99, 0x76, 0xd1, 0xb4, 0x8c, 0x0d,
+    0x80, 0x39, 0x86, 0x73, 0x6c, 0x20, 0x10, 0xf3, 0xa4, 0x32, 0x70, 0xa2, 0x79, 0xf1, 0xd8, 0x08,
+    0x0c, 0x92, 0x06, 0xee, 0x68, 0x0d, 0x2d, 0x9e, 0x9b, 0x98, 0x32, 0xa1, 0x69, 0x79, 0xe2, 0x9d,
+    0x8f, 0x7d, 0x04, 0x95, 0x97, 0x7d, 0x70, 0x45, 0xd6, 0xc4, 0xb6, 0x50, 0xb4, 0xd0, 0x45, 0xdf,
+    0x62, 0xa0, 0xab, 0xb9, 0xa5, 0xd5, 0x0b, 0x9c, 0x0f, 0x53, 0xbe, 0x66, 0xa2, 0x96, 0x07, 0x2d,
+    0x80, 0xf4, 0x8b, 0x7c, 0x52, 0x53, 0x52, 0x66, 0x4f, 0xa2, 0x32, 0x7a, 0xfb, 0xe6, 0x45, 0x28,
+    0xf5, 0x67, 0x09, 0xf3, 0x9d, 0xa7, 0xa2, 0x18, 0x4a, 0xc4, 0x0d, 0x13, 0xcb, 0x22, 0x06, 0x05,
+    0x0f, 0x61, 0x72, 0xc8, 0x92, 0x0b, 0xb0, 0x5b, 0x39, 0xff, 0x0c, 0xf6, 0x90, 0x02, 0xad, 0xbf,
+    0xbc, 0xba, 0x8a, 0xad, 0x66, 0x29, 0xa9, 0xc6, 0x21, 0x93, 0xd5, 0x46, 0x2d, 0x90, 0x3c, 0xcf,
+    0xb3, 0x9c, 0x40, 0x11, 0xb1, 0x0b, 0x79, 0xe5, 0x21, 0xd0, 0xd4, 0x2e, 0xc0, 0x33, 0x6a, 0x97,
+    0xec, 0x17, 0x04, 0xcf, 0x2e, 0xe2, 0xc8, 0x15, 0x50, 0xb4, 0xc1, 0x48, 0x09, 0x8d, 0x3f, 0xd8,
+    0xe5, 0x4b, 0xf9, 0x2c, 0x46, 0xd8, 0x6a, 0xfc, 0x0a, 0x58, 0x59, 0x4e, 0xe6, 0x2c, 0x74, 0xa6,
+    0x0e, 0xa7, 0x4d, 0x57, 0xa7, 0x67, 0x11, 0xa8, 0xc2, 0x14, 0xdb, 0xe3, 0xfd, 0x05, 0x4c, 0xb6,
+    0xf0, 0xc6, 0x46, 0xdf, 0x60, 0x80, 0xa4, 0xb5, 0xd8, 0x13, 0xd6, 0x02, 0x07, 0x91, 0xc1, 0x28,
+    0x4a, 0x53, 0x04, 0x71, 0x6f, 0x09, 0x73, 0x5d, 0x94, 0x4f, 0x19, 0x44, 0x6d, 0x79, 0x16, 0x4d,
+    0xe6, 0xa6, 0x9d, 0xb8, 0xad, 0xb1, 0xeb, 0xdb, 0xcd, 0x82, 0x14, 0x1d, 0xd9, 0x68, 0xab, 0x4d,
+    0x98, 0x22, 0x68, 0x9e, 0x54, 0x46, 0xe1, 0x1b, 0x25, 0x49, 0x20, 0x03, 0x36, 0x8a, 0xf8, 0x11,
+    0xb1, 0xe0, 0x6c, 0xfa, 0x86, 0x0a, 0x7c, 0x02, 0x2f, 0xe6, 0x65, 0x7c, 0x5b, 0x4b, 0x20, 0x8e,
+    0x14, 0xb4, 0x20, 0x5b, 0x0d, 0x61, 0x0e, 0x89, 0x72, 0xd0, 0xc8, 0x3e, 0x14, 0x80, 0x45, 0xbf,
+    0x0e, 0xc9, 0x75, 0xc2, 0xa9, 0x01, 0xe3, 0x3f, 0x8f, 0x0a, 0xa5, 0x60, 0x0d, 0x56, 0xef, 0xea,
+    0x46, 0x0a, 0xfd, 0xff, 0x4a, 0x2f, 0x4d, 0x0b, 0x23, 0x87, 0xfc, 0x87, 0xab, 0xaf, 0xe4, 0xef,
+    0x8f, 0x52, 0x5a, 0x53, 0xc8, 0x6f, 0xae, 0xb1, 0xf7, 0x0e, 0xd8, 0x33, 0xe0, 0x22, 0xb9, 0x1c,
+    0xe0, 0x93, 0xc6, 0xaf, 0xc7, 0x6c, 0x1c, 0xcd, 0xa2, 0x3c, 0x06, 0xcf, 0x03, 0x55, 0x0f, 0x42,
+    0x81, 0x33, 0x54, 0xe5, 0x46, 0x7d, 0x65, 0x77, 0xee, 0x30, 0xbf, 0x47, 0xb3, 0xbd, 0xe6, 0x3e,
+    0x96, 0x8d, 0x54, 0xbd, 0x92, 0x14, 0xb5, 0xcf, 0xeb, 0x50, 0x49, 0xe8, 0x30, 0xd4, 0x94, 0x73,
+    0xeb, 0xeb, 0x33, 0x14, 0x85, 0x16, 0xf1, 0xfe, 0x3f, 0x90, 0xe4, 0xb0, 0x05, 0x10, 0x7f, 0x90,
+    0x7a, 0x08, 0x8f, 0xb3, 0x2f, 0x1a, 0xf5, 0xb2, 0x6f, 0x0d, 0xca, 0x2f, 0x74, 0x5a, 0x98, 0x8b,
+    0x06, 0x90, 0xab, 0x6d, 0x14, 0xe7, 0x47, 0x51, 0x86, 0xb0, 0x21, 0xb2, 0xee, 0x29, 0x36, 0x14,
+    0x06, 0xd5, 0xf0, 0x0a, 0x69, 0x0d, 0x3a, 0x5f, 0x4f, 0xb4, 0xd0, 0x61, 0xd9, 0xf8, 0x0f, 0xd7,
+    0x61, 0x45, 0xf0, 0x8f, 0x52, 0x62, 0x47, 0xde, 0xbf, 0x4d, 0x8b, 0x51, 0x15, 0x5b, 0x66, 0x4e,
+    0x3b, 0xd7, 0xa5, 0x81, 0x9a, 0xc8, 0xe3, 0x34, 0x2e, 0x8f, 0xf2, 0x0c, 0x13, 0xaa, 0x06, 0xbe,
+    0x51, 0x53, 0x80, 0xf2, 0x68, 0xfa, 0x79, 0x25, 0x33, 0xb9, 0x2c, 0x02, 0xc5, 0x63, 0x30, 0xbb,
+    0xc3, 0x7b, 0xf8, 0x05, 0x3e, 0xb1, 0x8c, 0xe1, 0x8d, 0x60, 0x85, 0xf1, 0xa4, 0xe0, 0x16, 0x79,
+    0xcd, 0xa1, 0x90, 0x2f, 0x1c, 0x4a, 0xb3, 0x2a, 0xc6, 0xe0, 0xd3, 0x3e, 0x7b, 0x0b, 0xe8, 0xa4,
+    0x9d, 0x12, 0x56, 0x6b, 0xf7, 0x65, 0x34, 0xe9, 0x42, 0x97, 0x91, 0xd1, 0xe4, 0xb3, 0x03, 0x25,
+    0x10, 0xb5, 0x3b, 0xf6, 0xc3, 0x4b, 0x8a, 0xd5, 0xe0, 0x33, 0x1a, 0x8e, 0x2a, 0x7e, 0x12, 0x81,
+    0x2d, 0x39, 0x36, 0x80, 0x11, 0xdb, 0x38, 0x79, 0xf5, 0xbb, 0x8c, 0x7b, 0x5c, 0xfc, 0xb7, 0xcc,
+    0xbf, 0x6e, 0x94, 0x92, 0x90, 0x83, 0xc2, 0x9e, 0xc3, 0x00, 0xc5, 0x51, 0x12, 0xff, 0x19, 0x61,
+    0xe2, 0xe0, 0xc6, 0x29, 0x2c, 0x7d, 0xbc, 0x41, 0x9c, 0x75, 0xf6, 0x63, 0xa3, 0x51, 0x32, 0x59,
+    0x25, 0x60, 0x4c, 0x65, 0x1a, 0xb3, 0xc4, 0x3c, 0x43, 0x29, 0xb8, 0x80, 0xd1, 0x1b, 0xa6, 0xb2,
+    0xa3, 0x38, 0x15, 0xa1, 0x9f, 0x1a, 0x6d, 0x2b, 0xa2, 0xaf, 0x60, 0xde, 0xc9, 0x10, 0xc6, 0xc8,
+    0xda, 0xf7, 0x27, 0x49, 0x0c, 0x11, 0x90, 0x78, 0xf7, 0xf7, 0xdf, 0xec, 0xde, 0xfe, 0x60, 0x64,
+    0x21, 0x58, 0x44, 0x97, 0xc7, 0x2a, 0xa0, 0xa1, 0x65, 0x1b, 0x23, 0x76, 0x95, 0x8d, 0x2a, 0xe4,
+    0x95, 0x8a, 0x8e, 0x7c, 0x50, 0x15, 0x9e, 0x5a, 0x73, 0xad, 0x80, 0xdc, 0x40, 0xf7, 0xd0, 0x22,
+    0xde, 0x16, 0x4e, 0xab, 0x6d, 0x13, 0x78, 0xe4, 0x03, 0xf5, 0x10, 0xc0, 0xee, 0xb2, 0xd0, 0xe2,
+    0xd1, 0x6e, 0xdd, 0x0d, 0x23, 0xcc, 0xf7, 0x10, 0x2a, 0x11, 0x3e, 0xac, 0xb9, 0xd4, 0x40, 0x64,
+    0xd5, 0x72, 0x05, 0x38, 0x6a, 0xeb, 0x4b, 0x45, 0x00, 0x92, 0x57, 0x8f, 0xc0, 0xae, 0xdf, 0xe6,
+    0x69, 0x86, 0x48, 0xe5, 0xbb, 0x6b, 0x04, 0xbb, 0x06, 0xee, 0x91, 0x3f, 0xf3, 0x34, 0xa6, 0x6a,
+    0xb3, 0x08, 0x57, 0xbf, 0xd0, 0xf8, 0x11, 0x1a, 0xdd, 0xff, 0x34, 0x52, 0xd1, 0x2a, 0x1a, 0xf6,
+    0x23, 0x36, 0x40, 0xab, 0x58, 0xd8, 0xe0, 0x83, 0x03, 0x6c, 0x04, 0xb5, 0x40, 0xbb, 0x88, 0x68,
+    0xbb, 0x46, 0x0b, 0x5d, 0x13, 0x87, 0x95, 0xd5, 0xaa, 0x14, 0x93, 0x0b, 0x63, 0x98, 0xe3, 0xe2,
+    0x01, 0xe6, 0x43, 0x79, 0x0e, 0x06, 0x64, 0x1d, 0x03, 0xc1, 0x2a, 0xa5, 0x19, 0x15, 0x4b, 0x7c,
+    0x99, 0xa3, 0x0a, 0xdb, 0xda, 0x02, 0x55, 0xdf, 0x01, 0xb5, 0x2f, 0xa3, 0x72, 0xde, 0x5f, 0xc4,
+    0x69, 0xd8, 0x42, 0x00, 0x0c, 0x8d, 0xbe, 0x2e, 0xd9, 0x19, 0x79, 0x70, 0xe1, 0x5a, 0xa7, 0xc0,
+    0xb9, 0x6b, 0x00, 0x6b, 0xb0, 0xda, 0x42, 0x87, 0x21, 0x11, 0x97, 0x07, 0x96, 0x3a, 0xf4, 0x04,
+    0xa6, 0x0e, 0xa0, 0xda, 0xeb, 0x1a, 0xa0, 0x9b, 0x03, 0x5b, 0x20, 0x05, 0xec, 0xb1, 0x07, 0x76,
+    0x7d, 0x20, 0xd0, 0x98, 0xa5, 0x73, 0x51, 0x7a, 0x7c, 0x4b, 0x73, 0x00, 0xaa, 0xbf, 0x57, 0x4b,
+    0xf0, 0xd8, 0xf9, 0x51, 0xbd, 0x34, 0xa8, 0xbb, 0x3a, 0xe2, 0xe5, 0x89, 0x58, 0x55, 0x08, 0xf5,
+    0x41, 0x31, 0x57, 0x35, 0xdb, 0x53, 0xdb, 0x76, 0xa2, 0xda, 0xd3, 0xa4, 0xc6, 0x1e, 0x6d, 0x95,
+    0x52, 0xa2, 0x4d, 0xf8, 0xac, 0x94, 0xac, 0x46, 0x66, 0xf6, 0x2f, 0x31, 0x0b, 0xbe, 0xbc, 0x0c,
+    0x46, 0x2d, 0x75, 0xca, 0x6c, 0xa9, 0x57, 0xd9, 0x6c, 0x51, 0x45, 0x09, 0x7e, 0x55, 0x69, 0xbd,
+    0x45, 0xa5, 0x4a, 0x05, 0xaa, 0x5a, 0x73, 0xa3, 0xd6, 0x8d, 0xe7, 0x25, 0x90, 0x7d, 0x90, 0xf2,
+    0x68, 0xf2, 0x5d, 0x66, 0x24, 0x88, 0x77, 0x9f, 0x5e, 0x80, 0xda, 0x9c, 0x64, 0x85, 0xe9, 0x3e,
+    0xa9, 0x08, 0x9b, 0x44, 0xd5, 0x9c, 0x44, 0xa0, 0xce, 0xe3, 0x6c, 0x95, 0x62, 0x6e, 0xf4, 0x88,
+    0xe6, 0x13, 0xec, 0x65, 0xe8, 0x28, 0x44, 0x99, 0xad, 0x26, 0xc8, 0x3d, 0x64, 0x3d, 0xfc, 0xc5,
+    0x0b, 0xf6, 0x5b, 0xfd, 0xf7, 0xc7, 0xc1, 0x27, 0x76, 0xc0, 0x34, 0x77, 0x48, 0x24, 0xcd, 0x5d,
+    0xa5, 0x20, 0x78, 0x39, 0x6f, 0xbd, 0x07, 0x41, 0x47, 0x8a, 0x68, 0xfc, 0x1d, 0x9d, 0xd0, 0x21,
+    0x3f, 0x28, 0x48, 0x18, 0xf5, 0x5b, 0x96, 0x97, 0xeb, 0x2c, 0xd8, 0xe0, 0x0a, 0x1e, 0xae, 0x11,
+    0x9a, 0x0c, 0xe0, 0x7d, 0x94, 0x68, 0xc0, 0xf5, 0x84, 0xcf, 0xa2, 0x55, 0xe2, 0xe9, 0xe0, 0x32,
+    0xc3, 0x24, 0xa3, 0xc9, 0x41, 0x87, 0x09, 0x94, 0x52, 0x10, 0x5c, 0xa0, 0x3f, 0xf5, 0x19, 0x50,
+    0x5f, 0x99, 0xc4, 0xcc, 0xbd, 0xb6, 0x28, 0xa5, 0xad, 0x3e, 0x42, 0x33, 0xa6, 0xbc, 0xd5, 0x4b,
+    0x8e, 0x10, 0xa6, 0x55, 0x06, 0xe5, 0xca, 0x9a, 0x5b, 0x65, 0x32, 0xa3, 0x5e, 0xd0, 0x92, 0xd3,
+    0x1e, 0xb8, 0x59, 0x62, 0xfd, 0x03, 0xa2, 0x01, 0x7b, 0xf2, 0xd2, 0x97, 0x43, 0x65, 0x7d, 0x8c,
+    0xde, 0xc1, 0x43, 0xeb, 0x8b, 0x3a, 0x8e, 0x67, 0x59, 0xb7, 0x44, 0xc9, 0x77, 0x7d, 0x8b, 0x01,
+    0xf8, 0x17, 0x15, 0x0d, 0x59, 0xc1, 0x8b, 0x32, 0x0c, 0x88, 0xda, 0x5e, 0xa6, 0x76, 0x1c, 0xb4,
+    0xb6, 0x1f, 0x2c, 0x00, 0x2e, 0x18, 0xf9, 0xbd, 0xba, 0x6a, 0xf0, 0xa6, 0x99, 0x3b, 0x72, 0x14,
+    0x28, 0x6b, 0xcc, 0x05, 0x42, 0x6e, 0x1b, 0x2e, 0x79, 0xc7, 0x59, 0xa2, 0xf1, 0x0d, 0xf6, 0x37,
+    0x8c, 0xf6, 0xf4, 0x52, 0x8c, 0x17, 0x18, 0xa4, 0x5e, 0x3d, 0x86, 0xfd, 0x4b, 0x07, 0x6e, 0x23,
+    0xe1, 0x36, 0x06, 0xdc, 0xc6, 0x69, 0x54, 0x2a, 0x9e, 0xbd, 0x38, 0xbc, 0x76, 0xe7, 0x76, 0x05,
+    0x7b, 0x6c, 0xc3, 0xda, 0xe9, 0x68, 0xe9, 0xe6, 0xc5, 0xe9, 0x18, 0x27, 0xcf, 0x43, 0xb6, 0x3f,
+    0xb0, 0x9d, 0x32, 0x6d, 0x14, 0x0e, 0xd5, 0x38, 0xd8, 0x43, 0xa5, 0x99, 0x5e, 0x35, 0x7d, 0x46,
+    0x97, 0x21, 0x4c, 0xe1, 0xd5, 0x54, 0xaa, 0x48, 0xef, 0x69, 0xe6, 0xb3, 0x5b, 0xcb, 0x2f, 0xd9,
+    0xec, 0xe9, 0xa5, 0x1d, 0x91, 0x6a, 0xf6, 0xb9, 0x15, 0xef, 0xb1, 0x8e, 0x77, 0xae, 0xe3, 0x45,
+    0xc3, 0x3e, 0xdd, 0x74, 0x3a, 0x5e, 0x51, 0xad, 0xfb, 0x66, 0x77, 0x08, 0xfd, 0x56, 0x88, 0x9c,
+    0xdf, 0x4b, 0xc3, 0xed, 0x0c, 0x9c, 0x06, 0xf3, 0xc1, 0x80, 0xd9, 0x78, 0x61, 0xde, 0x19, 0x30,
+    0x6b, 0x2f, 0xcc, 0xb1, 0x01, 0x33, 0xb7, 0xd2, 0x7f, 0x26, 0xb9, 0xfd, 0x38, 0x9d, 0x24, 0xab,
+    0x29, 0x07, 0xed, 0x4d, 0x5c, 0xc5, 0xc1, 0x1f, 0xd9, 0x68, 0xc5, 0x33, 0x39, 0xc2, 0x3a, 0x6b,
+    0xd6, 0x28, 0x6d, 0x97, 0x9e, 0x88, 0xdd, 0xed, 0x38, 0x30, 0xd1, 0xac, 0x87, 0xe8, 0x9b, 0x02,
+    0xae, 0x56, 0x72, 0xf3, 0x1b, 0x90, 0xbb, 0xe3, 0x92, 0xbb, 0x65, 0xab, 0x65, 0x63, 0xab, 0xc7,
+    0xd7, 0xb4, 0x8a, 0x9e, 0x17, 0xc8, 0x8f, 0x97, 0x49, 0xd6, 0xc8, 0x1b, 0x4c, 0x9a, 0x0b, 0x26,
+    0x1d, 0x7f, 0x13, 0xb9, 0x67, 0x37, 0x20, 0x77, 0xc7, 0x25, 0xf7, 0xca, 0x14, 0x25, 0x4c, 0x3a,
+    0x82, 0xe5, 0x47, 0xeb, 0xef, 0xf7, 0x86, 0x15, 0x6d, 0x34, 0x28, 0xbb, 0xa2, 0xd9, 0x87, 0xa6,
+    0xbb, 0xdb, 0x3c, 0x84, 0x04, 0x7d, 0xb7, 0xc1, 0xdf, 0x6d, 0x8d, 0xfc, 0x65, 0xf7, 0x64, 0xab,
+    0x2d, 0x08, 0x9c, 0xee, 0x1c, 0xa1, 0x11, 0xcb, 0xb1, 0x3f, 0xd5, 0xd2, 0xa0, 0xaf, 0x33, 0xef,
+    0xd9, 0xaf, 0x6c, 0x00, 0xa4, 0x2b, 0x01, 0x1f, 0x8c, 0x3c, 0x03, 0x42, 0xe3, 0x5a, 0xc3, 0x7d,
+    0x68, 0x81, 0x7b, 0x0f, 0xcc, 0x26, 0x6a, 0x1f, 0x2a, 0xcb, 0x2c, 0x2b, 0xbd, 0xab, 0x9d, 0x24,
+    0x21, 0x06, 0xef, 0x47, 0x6d, 0xbd, 0x6b, 0xa2, 0x62, 0x47, 0xb1, 0x5e, 0x1a, 0x39, 0x89, 0xfd,
+    0xb8, 0xc2, 0x7e, 0x2c, 0xb0, 0x7f, 0x18, 0xb5, 0x31, 0xdf, 0xe6, 0x97, 0xbd, 0xb9, 0x0a, 0xc9,
+    0xa3, 0x8d, 0x4a, 0x88, 0x89, 0xf6, 0x2a, 0x21, 0x32, 0xda, 0xae, 0x44, 0xe8, 0xae, 0xbc, 0xa1,
+    0xe6, 0xd7, 0x85, 0x05, 0xbe, 0xb9, 0x9a, 0xa7, 0x53, 0x9a, 0xac, 0x8d, 0xb9, 0xba, 0x61, 0x77,
+    0x96, 0xe3, 0x0e, 0xd4, 0xbb, 0xb3, 0x6e, 0xb6, 0xd7, 0x24, 0xc9, 0x36, 0xd3, 0xde, 0xb8, 0xe4,
+    0x71, 0x7a, 0xc6, 0xf3, 0x73, 0xf6, 0x04, 0x22, 0x45, 0x9e, 0x63, 0xf3, 0xe1, 0x38, 0x5e, 0x2c,
+    0x93, 0x78, 0x16, 0x43, 0xfc, 0x78, 0x87, 0x3d, 0x8b, 0x2f, 0xf9, 0xb4, 0x73, 0x63, 0xf7, 0x1a,
+    0x1c, 0xe6, 0x64, 0x53, 0xb5, 0x21, 0xe7, 0x2e, 0xd7, 0xcd, 0xde, 0x72, 0x51, 0x58, 0xe5, 0xd0,
+    0xc1, 0x85, 0xa1, 0x85, 0xbe, 0x43, 0x5a, 0x1e, 0x06, 0xf8, 0xe7, 0xaa, 0x28, 0x14, 0x71, 0xb4,
+    0xbe, 0x8c, 0xdd, 0x35, 0xd7, 0xa9, 0x5d, 0x9f, 0x45, 0x60, 0xaa, 0xb0, 0x92, 0xc7, 0x67, 0x03,
+    0xad, 0x6b, 0xf2, 0xbc, 0xbe, 0x47, 0x9d, 0x69, 0x72, 0x13, 0x3d, 0xf6, 0x46, 0x4e, 0x74, 0x7d,
+    0xa2, 0xbc, 0xe0, 0x10, 0xc6, 0x84, 0xf6, 0xc6, 0xd1, 0xfe, 0x45, 0x94, 0xac, 0x5c, 0xbf, 0x4a,
+    0x6d, 0xe2, 0xd4, 0xab, 0x9a, 0x9b, 0x48, 0xaf, 0xa9, 0xf8, 0x8c, 0x52, 0x1d, 0x98, 0x79, 0xdf,
+    0xdb, 0xff, 0x45, 0xe5, 0x80, 0x08, 0xe3, 0x0e, 0xdb, 0xdb, 0xdf, 0xef, 0x60, 0xe4, 0x0c, 0xaf,
+    0xf6, 0xf1, 0x15, 0x42, 0xf4, 0xaa, 0x9a, 0x1d, 0x7b, 0x3b, 0x4d, 0x9d, 0xe5, 0x3c, 0xcf, 0xa3,
+    0x8d, 0x48, 0xc0, 0x44, 0x39, 0xfc, 0x29, 0xb2, 0x0e, 0x75, 0x8f, 0x76, 0x15, 0x0a, 0x8b, 0x26,
+    0xac, 0xa6, 0xd6, 0x2c, 0x93, 0x2c, 0x2a, 0xef, 0xed, 0x3d, 0xc2, 0xea, 0xe1, 0x1a, 0x1a, 0xd7,
+    0x33, 0x50, 0x98, 0xe4, 0x0b, 0x69, 0x07, 0xa3, 0xb0, 0x48, 0x31, 0x18, 0x29, 0x82, 0x81, 0x3f,
+    0x77, 0x76, 0x1c, 0x87, 0x4c, 0xc8, 0x06, 0x79, 0xa0, 0x31, 0x40, 0xdd, 0x1f, 0xd9, 0x36, 0xf3,
+    0xc5, 0x0a, 0xa6, 0x8f, 0xac, 0x88, 0xcb, 0x8d, 0xbe, 0xda, 0x53, 0x75, 0xc2, 0xf1, 0x50, 0x50,
+    0x23, 0x07, 0xfd, 0xbd, 0x5f, 0x90, 0x5f, 0x28, 0x13, 0x1f, 0x01, 0xf9, 0x27, 0xe0, 0xd7, 0xa0,
+    0xbf, 0xff, 0xe0, 0x67, 0xad, 0x0c, 0x8a, 0x86, 0xa2, 0x7c, 0x38, 0xbc, 0x6f, 0x96, 0xef, 0x7d,
+    0x1a, 0x39, 0xa6, 0xfb, 0x11, 0xaa, 0x84, 0x2e, 0x0e, 0x61, 0x6f, 0x38, 0x18, 0x20, 0x3f, 0x77,
+    0xf0, 0xdf, 0x45, 0xb4, 0xa4, 0x0d, 0x34, 0x3d, 0x1c, 0x0d, 0x2c, 0xc4, 0xe1, 0x31, 0x70, 0x9c,
+    0xb3, 0x9d, 0x43, 0xbd, 0xfe, 0x5d, 0xb6, 0xd7, 0xdf, 0xdf, 0x6f, 0x6a, 0xc8, 0x19, 0x04, 0x81,
+    0xe2, 0xd0, 0x16, 0x0d, 0x18, 0x78, 0xdc, 0x7b, 0x36, 0xdc, 0x7b, 0xd0, 0xc1, 0x0e, 0xed, 0x3d,
+    0x70, 0x11, 0x1e, 0x25, 0xd1, 0x62, 0x69, 0xe2, 0x01, 0xe6, 0x7d, 0x8c, 0x3f, 0x35, 0xb9, 0xaa,
+    0x40, 0x7a, 0x97, 0x9d, 0x77, 0x1a, 0x37, 0x0f, 0x3d, 0xe1, 0x67, 0xab, 0xf3, 0x03, 0x36, 0xa1,
+    0x1d, 0x5a, 0x45, 0xb6, 0xe0, 0x6c, 0x09, 0x66, 0x27, 0x61, 0x24, 0xcb, 0x45, 0x43, 0xea, 0x0e,
+    0x68, 0x00, 0x89, 0x23, 0x21, 0x12, 0x70, 0x98, 0xc0, 0x23, 0x42, 0x06, 0x9f, 0xe4, 0x1f, 0xc0,
+    0xc7, 0xea, 0xef, 0xfd, 0x01, 0x3e, 0x58, 0x42, 0x6c, 0x5b, 0xc1, 0xa9, 0xb2, 0x50, 0xae, 0xf0,
+    0x6d, 0x84, 0xf0, 0x6d, 0x40, 0xf8, 0x40, 0xf0, 0x36, 0xae, 0xe0, 0x55, 0x90, 0x97, 0x02, 0xf2,
+    0x12, 0xc5, 0x14, 0xfe, 0x71, 0x21, 0x6d, 0x31, 0xdd, 0x00, 0xd3, 0xd1, 0xc7, 0xbb, 0x6c, 0x5a,
+    0x2d, 0xcc, 0x92, 0xe9, 0x09, 0x31, 0xe4, 0x50, 0x72, 0x1a, 0x04, 0xb0, 0x09, 0x16, 0xd4, 0x49,
+    0xc1, 0x56, 0xd5, 0x7e, 0xc5, 0x71, 0x64, 0xbf, 0xb1, 0x01, 0x3b, 0x40, 0x2d, 0x77, 0xab, 0x56,
+    0x58, 0x85, 0x3e, 0x52, 0xad, 0xc6, 0x55, 0x78, 0xb5, 0x78, 0x57, 0xa1, 0xef, 0xb5, 0xd5, 0x11,
+    0x47, 0x24, 0xca, 0x3c, 0x3e, 0x5b, 0x95, 0x5c, 0xd6, 0x05, 0x71, 0x4e, 0xd1, 0x3a, 0x9e, 0x65,
+    0x79, 0xe1, 0x6e, 0xc9, 0x01, 0x27, 0x80, 0x74, 0x09, 0xf9, 0xd7, 0x69, 0x58, 0x1c, 0x54, 0x04,
+    0x4b, 0x9d, 0x3b, 0x94, 0x88, 0xef, 0xb2, 0x9f, 0xc1, 0x80, 0x0d, 0x7f, 0xf2, 0xac, 0xcf, 0x79,
+    0xdb, 0xd9, 0xc8, 0x76, 0xe6, 0x4d, 0xed, 0x08, 0x62, 0x1e, 0x92, 0x53, 0xd4, 0xb8, 0xde, 0x48,
+    0xc4, 0x08, 0x5c, 0x1d, 0x39, 0x94, 0x21, 0x06, 0xbe, 0xc3, 0x8e, 0x41, 0xda, 0xbd, 0x06, 0xd2,
+    0xfc, 0xe4, 0x35, 0x20, 0xbe, 0x34, 0x50, 0xee, 0xb7, 0xa0, 0xdc, 0x8a, 0x8f, 0xcd, 0xe4, 0xef,
+    0xd8, 0xe4, 0x0f, 0xbf, 0x8a, 0xfc, 0xab, 0xad, 0xb6, 0x00, 0x1c, 0x65, 0xab, 0x14, 0xd7, 0xd1,
+    0x23, 0xd0, 0x7b, 0x5c, 0xc1, 0x5b, 0xcf, 0xe3, 0x52, 0x2a, 0x7f, 0x21, 0x16, 0x77, 0xd0, 0x32,
+    0x9c, 0xeb, 0x0a, 0x89, 0x1a, 0x46, 0x15, 0x44, 0xdd, 0x43, 0xda, 0x65, 0x8e, 0xd5, 0xaa, 0x67,
+    0x53, 0xc5, 0xdf, 0xe5, 0x88, 0xf2, 0x0c, 0x5b, 0x50, 0xdb, 0xe5, 0xc8, 0x32, 0xff, 0x98, 0xe9,
+    0x45, 0xbc, 0xbe, 0x88, 0x6a, 0x55, 0xfd, 0xd4, 0xae, 0x7d, 0x38, 0x4a, 0x04, 0x7e, 0x78, 0x88,
+    0x42, 0x56, 0xf7, 0x6c, 0x67, 0x67, 0x24, 0xc2, 0x85, 0xba, 0x73, 0x50, 0x64, 0xa6, 0x89, 0xaa,
+    0xc9, 0xe8, 0x10, 0x9b, 0xf4, 0xbf, 0x14, 0x1a, 0xd2, 0x0e, 0xb0, 0x77, 0x1d, 0xc0, 0x3d, 0x04,
+    0x30, 0x68, 0x6f, 0xda, 0xcb, 0x5b, 0xfb, 0x91, 0x62, 0xf7, 0x10, 0xa8, 0xc1, 0x63, 0xec, 0x13,
+    0x1a, 0xe7, 0xba, 0x73, 0x5d, 0x16, 0xbc, 0xc3, 0x6e, 0x61, 0x69, 0xdd, 0x3f, 0x23, 0xd7, 0x04,
+    0x0e, 0xdd, 0x72, 0xa5, 0x39, 0x74, 0x95, 0x5f, 0x56, 0xed, 0xfa, 0xbb, 0xb1, 0x0f, 0x2c, 0xdd,
+    0x74, 0xf6, 0x96, 0x9c, 0xf6, 0x1b, 0xfb, 0xb8, 0x96, 0xef, 0x6f, 0x27, 0xe2, 0x1a, 0x32, 0x6f,
+    0xfe, 0x85, 0x4f, 0x5a, 0xcb, 0x99, 0x64, 0x59, 0x3e, 0x85, 0x2a, 0x25, 0x2f, 0x70, 0xd9, 0x53,
+    0x21, 0x90, 0x42, 0x5c, 0x2c, 0xa3, 0x09, 0xb7, 0x5c, 0xaa, 0x22, 0x9f, 0xbc, 0x57, 0x93, 0x70,
+    0x8e, 0xa9, 0xe9, 0x50, 0xcb, 0x4f, 0xdd, 0xad, 0x96, 0xb7, 0x9c, 0x4a, 0x1f, 0x1a, 0x2a, 0x6d,
+    0xda, 0x2a, 0xbd, 0x6b, 0xa8, 0xb4, 0x6e, 0xab, 0x74, 0xdc, 0x50, 0x69, 0xae, 0x55, 0xf2, 0x4b,
+    0xd6, 0x91, 0x5a, 0xeb, 0xa7, 0x85, 0x3a, 0xe8, 0x28, 0xfd, 0xfe, 0x40, 0xbf, 0xdf, 0xd1, 0xef,
+    0x63, 0x6b, 0x76, 0x1f, 0xf3, 0xea, 0x10, 0x88, 0xda, 0x0b, 0x5b, 0xc4, 0x7f, 0x72, 0x7b, 0xa5,
+    0xc6, 0x5a, 0xdd, 0x33, 0x8e, 0xd9, 0x8c, 0x1a, 0x80, 0xab, 0xc5, 0x0d, 0xef, 0x19, 0x3c, 0x35,
+    0xef, 0xe5, 0xd1, 0x9a, 0x46, 0x72, 0x09, 0xa1, 0x14, 0x6d, 0x50, 0xc0, 0x0e, 0xca, 0xe5, 0x7c,
+    0xb4, 0x46, 0x26, 0x71, 0x4e, 0x53, 0xa0, 0x02, 0xb3, 0x38, 0x49, 0xc6, 0xb8, 0x9c, 0x82, 0x89,
+    0x60, 0xd2, 0x94, 0x60, 0xd4, 0x04, 0x47, 0xab, 0x0f, 0x22, 0xee, 0xb1, 0x8e, 0x0a, 0x99, 0x44,
+    0xea, 0x5c, 0x72, 0x77, 0x48, 0x69, 0x48, 0xeb, 0xa5, 0x49, 0xc7, 0xbc, 0x1b, 0xc2, 0xdc, 0x75,
+    0xb7, 0x32, 0x78, 0x87, 0xc7, 0x85, 0xdb, 0x82, 0x5a, 0xa3, 0x8e, 0x91, 0xcc, 0x6c, 0xda, 0xec,
+    0xa2, 0xa4, 0x86, 0x8b, 0xbd, 0x3f, 0x34, 0x0a, 0xf4, 0x37, 0x6d, 0x6f, 0xd9, 0xfe, 0x8c, 0x82,
+    0x7e, 0x66, 0x40, 0x0c, 0xd9, 0x1a, 0x24, 0x08, 0x99, 0x92, 0xda, 0x8b, 0x1b, 0xbc, 0x28, 0x65,
+    0x20, 0xaa, 0xb1, 0xcf, 0x88, 0x47, 0x8d, 0x3e, 0xee, 0xee, 0xd9, 0xbd, 0xc4, 0x92, 0x21, 0xfc,
+    0xd7, 0xf1, 0x44, 0x9d, 0xb5, 0x06, 0xd0, 0xb2, 0xae, 0xf4, 0x8d, 0xcf, 0x38, 0x4c, 0x5c, 0xbc,
+    0xf6, 0x58, 0xb1, 0x73, 0x8a, 0x0e, 0xf2, 0x80, 0xab, 0x87, 0xa1, 0xfe, 0xb0, 0x67, 0xbb, 0xc0,
+    0x22, 0x3a, 0x70, 0x1d, 0x5f, 0x2b, 0x62, 0x37, 0xc4, 0xff, 0x7b, 0x18, 0x5f, 0x2d, 0x7e, 0x1c,
+    0xf6, 0xce, 0x62, 0xd0, 0x54, 0x98, 0x1c, 0xf8, 0x54, 0xee, 0x6a, 0xf9, 0x1e, 0xeb, 0x79, 0x27,
+    0x84, 0xb0, 0x1e, 0x02, 0x37, 0xdd, 0xa0, 0x67, 0x10, 0x9a, 0x06, 0x6e, 0x3b, 0x85, 0xfa, 0xc6,
+    0x54, 0x42, 0x83, 0xad, 0xa9, 0x73, 0x09, 0x6d, 0xe6, 0x05, 0xfb, 0x07, 0xf3, 0x02, 0x30, 0xf0,
+    0x6c, 0x03, 0xe3, 0x7b, 0xc0, 0x1e, 0x28, 0xcf, 0x09, 0x77, 0xec, 0x60, 0x19, 0x84, 0x60, 0xe3,
+    0xc7, 0x6c, 0x16, 0xe7, 0x5a, 0xd8, 0x07, 0x15, 0x9f, 0xf6, 0x96, 0x11, 0x80, 0x1c, 0xe0, 0x46,
+    0xfd, 0xc3, 0x21, 0x04, 0xc1, 0x51, 0x5a, 0x88, 0x69, 0xb8, 0x4b, 0x45, 0x03, 0x59, 0x44, 0xf3,
+    0xb5, 0xbd, 0xfa, 0x23, 0x46, 0x49, 0x84, 0xed, 0x6f, 0xa1, 0xf5, 0x07, 0x5a, 0xd0, 0x0e, 0x1e,
+    0xe2, 0x83, 0x8e, 0xb9, 0x05, 0x06, 0xc9, 0x78, 0x9e, 0x4e, 0xf9, 0xa5, 0xe5, 0x99, 0xdd, 0x3c,
+    0xae, 0x42, 0xdf, 0xf4, 0x81, 0xcf, 0xaf, 0x55, 0xcd, 0x8a, 0x16, 0x9d, 0x43, 0x32, 0x0a, 0x1d,
+    0xca, 0x1c, 0x21, 0xc4, 0x3f, 0x7e, 0x65, 0x0f, 0xe8, 0x0f, 0x7f, 0xb0, 0xa6, 0x75, 0x1f, 0x19,
+    0xac, 0xfa, 0x13, 0x56, 0x81, 0x1b, 0xfc, 0x0f, 0x95, 0x3b, 0xae, 0x3f, 0xa8, 0xef, 0xd4, 0x98,
+    0x49, 0xcd, 0x8d, 0x25, 0xb3, 0x59, 0xf8, 0x90, 0xc2, 0xec, 0x2e, 0xee, 0xfc, 0xa2, 0x33, 0x32,
+    0x80, 0xa3, 0xd1, 0x95, 0x27, 0x6f, 0xac, 0x6e, 0xfe, 0x13, 0x13, 0x95, 0x5b, 0xfc, 0x7a, 0xe2,
+    0xc1, 0xdf, 0x40, 0xe6, 0xe0, 0xf2, 0xc1, 0x80, 0x3d, 0x7c, 0x48, 0x24, 0x7e, 0x9b, 0xff, 0x4e,
+    0x13, 0x03, 0x8d, 0xfc, 0xc7, 0x6a, 0x40, 0x77, 0x76, 0xd0, 0x29, 0xc4, 0xc7, 0x2d, 0x36, 0x0a,
+    0x1a, 0x76, 0x4c, 0x28, 0xa6, 0x94, 0x5a, 0xf4, 0x0b, 0x15, 0x4a, 0x70, 0x0b, 0x9f, 0xa1, 0xb0,
+    0xd6, 0xaf, 0x64, 0xa3, 0x83, 0x4f, 0xfd, 0x32, 0x1b, 0x97, 0x64, 0x89, 0x86, 0x3f, 0x75, 0xaa,
+    0xf2, 0xa1, 0x59, 0xde, 0x71, 0x96, 0xd1, 0x05, 0xdc, 0x77, 0x30, 0x57, 0x4f, 0xd3, 0x49, 0x36,
+    0xe5, 0x82, 0x30, 0x92, 0xa1, 0x32, 0x07, 0x15, 0x59, 0xc4, 0x05, 0x1e, 0xf9, 0x67, 0x61, 0x1a,
+    0x9f, 0x9d, 0xc1, 0x24, 0xcd, 0x11, 0x0a, 0x8f, 0x44, 0xde, 0xd8, 0x7e, 0x61, 0x43, 0xa7, 0xd8,
+    0xb5, 0xf0, 0xc2, 0xda, 0x1d, 0xf7, 0x22, 0x5b, 0x33, 0xd9, 0x1c, 0x69, 0x76, 0x57, 0x9c, 0x05,
+    0x9a, 0x83, 0x43, 0x22, 0xcb, 0x0d, 0x5d, 0x8f, 0x26, 0xaa, 0x18, 0xa6, 0x8c, 0x49, 0xb6, 0x00,
+    0xf2, 0x83, 0x28, 0xc0, 0x0c, 0x3b, 0x15, 0xfe, 0x41, 0xb9, 0x13, 0x90, 0x91, 0xde, 0x70, 0x9f,
+    0xf5, 0x1e, 0xe2, 0xbb, 0x5e, 0xb0, 0x0c, 0x3a, 0x36, 0x23, 0x05, 0x93, 0xfb, 0xb3, 0x3c, 0x5b,
+    0x1c, 0xcd, 0xa3, 0xfc, 0x08, 0x98, 0x11, 0x86, 0x17, 0xec, 0x0e, 0x1b, 0x5c, 0x3e, 0xc3, 0x44,
+    0xd1, 0x2f, 0x3f, 0x77, 0x19, 0x16, 0x80, 0x98, 0xdd, 0xef, 0xe8, 0xc5, 0xdf, 0xc5, 0x51, 0x87,
+    0x51, 0x7c, 0x1c, 0x97, 0x05, 0x88, 0xd1, 0x62, 0x89, 0x67, 0x30, 0x6f, 0xb0, 0xe3, 0x03, 0xaa,
+    0x1c, 0x8b, 0xe3, 0x12, 0x29, 0x7b, 0x08, 0xfa, 0x7f, 0xc0, 0xd2, 0x9d, 0x21, 0x4b, 0x62, 0xdc,
+    0x4a, 0x92, 0x54, 0xe3, 0x9b, 0x24, 0x19, 0xd8, 0x98, 0x14, 0x97, 0x43, 0x0e, 0x48, 0x35, 0x53,
+    0x3c, 0x3d, 0x8e, 0x6f, 0x15, 0x92, 0x9c, 0x2f, 0x79, 0x04, 0x24, 0x0d, 0x7b, 0x29, 0x2b, 0x63,
+    0x60, 0x6b, 0x5f, 0xe6, 0xd0, 0x95, 0x83, 0x57, 0xb0, 0x79, 0x74, 0xc1, 0x59, 0x92, 0x41, 0x2c,
+    0x24, 0xf4, 0x1d, 0x5d, 0x40, 0x11, 0xeb, 0xe6, 0xab, 0xb4, 0xe8, 0x9b, 0x03, 0xbe, 0x94, 0x7d,
+    0x24, 0x45, 0x77, 0xa7, 0xaa, 0x8c, 0x6e, 0x58, 0xb0, 0x8c, 0x2e, 0x82, 0xf6, 0x13, 0x9e, 0x9e,
+    0x97, 0xb8, 0xfa, 0x45, 0x6e, 0xf5, 0x84, 0xc7, 0x89, 0x51, 0xbe, 0x4b, 0x66, 0xc2, 0xb2, 0xca,
+    0x99, 0x69, 0x1b, 0xeb, 0xe8, 0xb7, 0x2a, 0x02, 0x8a, 0x41, 0x62, 0x42, 0x0c, 0x86, 0x35, 0x6c,
+    0xbe, 0xc5, 0x62, 0xe8, 0x4b, 0x7d, 0xd0, 0xdc, 0xa9, 0xbe, 0x43, 0xef, 0x0d, 0x24, 0xb8, 0x5f,
+    0x5f, 0x14, 0x62, 0x5c, 0x0c, 0x0f, 0x22, 0xd0, 0x14, 0xa0, 0x9f, 0x28, 0x12, 0x16, 0x25, 0x9f,
+    0x3a, 0x58, 0x62, 0x47, 0xbd, 0x68, 0x0c, 0xb1, 0x3a, 0x0c, 0xde, 0x9e, 0xcf, 0xfc, 0x01, 0xa7,
+    0x3e, 0x66, 0xc2, 0x38, 0xed, 0xed, 0xff, 0x8c, 0xfb, 0x5f, 0x56, 0xe9, 0xa8, 0x0d, 0x4a, 0x36,
+    0xe6, 0x39, 0x1c, 0x86, 0x53, 0x8c, 0xb7, 0x36, 0xe6, 0x4c, 0xe3, 0x74, 0xc5, 0xdb, 0xd6, 0x38,
+    0x51, 0x55, 0xa5, 0x54, 0x41, 0xa8, 0x96, 0x76, 0x71, 0xd9, 0x87, 0xac, 0x1e, 0x8b, 0xa8, 0xfb,
+    0xd9, 0x0c, 0x04, 0x2b, 0xe7, 0x1c, 0xb7, 0xf3, 0x2e, 0xc0, 0x95, 0xf3, 0xe4, 0x11, 0x0a, 0xb9,
+    0xc1, 0x25, 0x6e, 0x60, 0xae, 0xc3, 0x56, 0x3c, 0x33, 0x21, 0x2a, 0x29, 0xe6, 0xfa, 0xcc, 0xfd,
+    0x6d, 0x1a, 0x97, 0x3d, 0xb7, 0xba, 0xe4, 0x84, 0x36, 0x04, 0x22, 0x7b, 0xd0, 0xf4, 0x0a, 0x9c,
+    0x49, 0xdf, 0x08, 0xc4, 0xf6, 0x90, 0x99, 0x8c, 0xd1, 0x58, 0x5f, 0xd3, 0xdb, 0xb3, 0x25, 0x08,
+    0xa0, 0xfa, 0x30, 0x2f, 0x0a, 0x59, 0x2e, 0x56, 0x67, 0xb4, 0xb4, 0x10, 0x12, 0x70, 0x97, 0xc5,
+    0x30, 0x05, 0x64, 0xd6, 0x5c, 0x96, 0xe1, 0x68, 0x55, 0x08, 0x7d, 0x1b, 0x58, 0xa5, 0x29, 0x23,
+    0xcc, 0x0a, 0xe1, 0xa0, 0x46, 0x54, 0x9b, 0xa8, 0xa3, 0x37, 0x47, 0xbd, 0xa3, 0xa3, 0xe7, 0xa7,
+    0xa7, 0x38, 0x77, 0x0e, 0x07, 0x7b, 0xe0, 0x99, 0xc7, 0x62, 0x9f, 0x25, 0xda, 0x35, 0xf8, 0xe9,
+    0x88, 0xd1, 0x53, 0xf3, 0x41, 0xc4, 0x26, 0xf3, 0x55, 0xfa, 0x85, 0x4d, 0x39, 0x4e, 0x12, 0x98,
+    0xb6, 0x37, 0x75, 0x7b, 0x92, 0x4f, 0x86, 0x3f, 0x85, 0x04, 0xab, 0xf3, 0x4b, 0x5c, 0x9d, 0x80,
+    0xc7, 0x0a, 0x04, 0xd6, 0xf6, 0x25, 0x0f, 0xaa, 0x2e, 0x07, 0xcb, 0x9f, 0x9a, 0x02, 0x54, 0xff,
+    0x12, 0x33, 0x72, 0x41, 0x79, 0x27, 0x74, 0x6a, 0xfc, 0xae, 0xd4, 0x67, 0x81, 0xf6, 0xb3, 0xf0,
+    0x7b, 0x3e, 0x37, 0xa4, 0xa8, 0x89, 0xb4, 0x10, 0xff, 0x41, 0x7b, 0xfe, 0x60, 0x30, 0x18, 0x74,
+    0xd8, 0x6f, 0x60, 0xe5, 0xb1, 0x04, 0x90, 0x0f, 0x3b, 0xec, 0x5f, 0x4c, 0xf0, 0x47, 0x5a, 0x7c,
+    0xf8, 0x61, 0x07, 0x4c, 0x7b, 0x7f, 0xc7, 0xe9, 0x99, 0x6f, 0x87, 0xba, 0x36, 0x36, 0x50, 0xf5,
+    0x3b, 0xcc, 0x17, 0x8f, 0x4e, 0x9e, 0x43, 0x7c, 0xb1, 0x58, 0xac, 0xd2, 0x78, 0x72, 0xa3, 0x0d,
+    0xeb, 0xd6, 0x79, 0x79, 0x3c, 0x60, 0x20, 0xcf, 0xeb, 0x5c, 0x93, 0xdd, 0x69, 0x3b, 0x33, 0x2f,
+    0x62, 0x49, 0x71, 0xcc, 0xe1, 0x2b, 0x8e, 0xcc, 0xcb, 0xcb, 0x56, 0x70, 0x2b, 0x69, 0x74, 0x96,
+    0x90, 0x0f, 0x6e, 0xee, 0x95, 0xd3, 0x5a, 0xd1, 0x2e, 0x84, 0x70, 0x0f, 0xc5, 0x57, 0xf0, 0xfa,
+    0x05, 0x0d, 0x83, 0xf6, 0xac, 0x00, 0x79, 0x40, 0xc5, 0x0a, 0x02, 0x4e, 0x95, 0xb3, 0x00, 0x2f,
+    0x76, 0x45, 0x07, 0x92, 0xab, 0xdc, 0xd9, 0xf5, 0x5b, 0x63, 0x25, 0xa6, 0xdf, 0x79, 0x15, 0x47,
+    0x78, 0xf2, 0xb1, 0x9e, 0x58, 0xc3, 0x17, 0xcc, 0x8d, 0x6e, 0x35, 0x9f, 0xe9, 0xca, 0x4a, 0xd0,
+    0x54, 0x59, 0x1b, 0x33, 0x3e, 0xb5, 0x27, 0x29, 0xf5, 0x07, 0x1c, 0xcd, 0xa7, 0x97, 0x4b, 0xba,
+    0xb4, 0x00, 0xdf, 0x99, 0x17, 0x2b, 0xdd, 0xb5, 0xef, 0x55, 0x11, 0x51, 0x8d, 0xdd, 0x0b, 0xb5,
+    0x68, 0x45, 0x69, 0xe7, 0x34, 0x4b, 0x7b, 0x7f, 0xf2, 0x3c, 0x53, 0x06, 0x01, 0x66, 0x7a, 0xb1,
+    0x9a, 0x35, 0x55, 0x6b, 0x1f, 0x4a, 0x0a, 0x8d, 0xbd, 0x4f, 0x59, 0xfa, 0x4f, 0xa8, 0xa4, 0x65,
+    0xae, 0x6d, 0x88, 0x28, 0x49, 0x9e, 0x3d, 0x6b, 0x78, 0xef, 0x33, 0x12, 0x46, 0x2f, 0xbd, 0x56,
+    0x42, 0x49, 0xac, 0xf4, 0xa0, 0xc1, 0x4e, 0xdc, 0x16, 0xa9, 0x67, 0x9d, 0x18, 0xdb, 0x80, 0xbb,
+    0x95, 0x28, 0x5f, 0x7d, 0x89, 0x96, 0xb0, 0x26, 0xb1, 0xdd, 0xec, 0xfb, 0x42, 0x00, 0xbc, 0x9a,
+    0xa4, 0x00, 0x93, 0xfd, 0xca, 0x60, 0x1f, 0x0e, 0x89, 0x4e, 0x0d, 0x8c, 0xd6, 0xa3, 0x24, 0xe9,
+    0x81, 0x71, 0xa9, 0x5e, 0xd7, 0x8d, 0xc2, 0xcb, 0x6c, 0x66, 0x8f, 0x6f, 0x9b, 0x74, 0x88, 0x08,
+    0x63, 0xf8, 0x93, 0x12, 0x90, 0x0a, 0x27, 0xf9, 0x54, 0xe4, 0xe1, 0xca, 0x7e, 0xf6, 0x8b, 0x24,
+    0x9e, 0x70, 0x9c, 0x22, 0x30, 0xb6, 0xe8, 0xe3, 0x49, 0xfd, 0x33, 0x3c, 0xaf, 0x76, 0x66, 0x04,
+    0x1d, 0xfd, 0x65, 0x34, 0xa5, 0x2d, 0x48, 0xe1, 0x1e, 0xd0, 0x32, 0x08, 0x00, 0xf2, 0x73, 0x16,
+    0xa7, 0x61, 0xc0, 0x82, 0x8e, 0x2d, 0x36, 0xf2, 0xce, 0x2c, 0x75, 0xd7, 0x92, 0x7e, 0xcf, 0x92,
+    0x58, 0xb8, 0x6f, 0x3c, 0xf0, 0xf4, 0x76, 0x29, 0x6f, 0x61, 0xd0, 0x0e, 0x38, 0xb1, 0x10, 0xfd,
+    0x78, 0x89, 0x6d, 0x07, 0x9a, 0xf3, 0xaa, 0xb9, 0x7d, 0xd3, 0x53, 0xb5, 0x9d, 0x96, 0xe7, 0x54,
+    0x35, 0x9d, 0xf0, 0x7e, 0x9a, 0xad, 0x43, 0x6f, 0x15, 0x99, 0xc4, 0x3f, 0xac, 0x68, 0xc6, 0x8d,
+    0x90, 0x22, 0x72, 0x08, 0x60, 0x2e, 0x10, 0x67, 0x14, 0x05, 0xde, 0x57, 0x54, 0x2a, 0x59, 0xd7,
+    0x69, 0x8c, 0x4a, 0x1b, 0x7e, 0x0e, 0x0c, 0x5c, 0x63, 0xe1, 0xe3, 0x4b, 0x64, 0x5d, 0xa3, 0x75,
+    0x2c, 0x83, 0x48, 0xd6, 0xb9, 0xb6, 0x40, 0xef, 0xe3, 0xcb, 0xc2, 0x4c, 0x33, 0x3b, 0x7d, 0x05,
+    0x99, 0xd3, 0xb8, 0xd1, 0x26, 0x2e, 0x82, 0xf1, 0x41, 0x57, 0xe3, 0x33, 0x0a, 0x8b, 0x60, 0x4c,
+    0x7f, 0x1d, 0xe7, 0xfc, 0x0f, 0x92, 0x20, 0x18, 0x7b, 0xf1, 0x2f, 0xbc, 0x54, 0x44, 0x40, 0xd9,
+    0x82, 0x52, 0xf7, 0x67, 0x79, 0xb6, 0x2e, 0x78, 0x0e, 0xef, 0xda, 0x8e, 0x53, 0x22, 0x42, 0x9e,
+    0x44, 0xcb, 0x82, 0x4f, 0xff, 0x58, 0xc8, 0xca, 0xb8, 0xb5, 0x17, 0x0c, 0xe9, 0x84, 0x07, 0xb6,
+    0x2c, 0x69, 0xc2, 0xf1, 0x86, 0xcf, 0xa0, 0xfa, 0x1c, 0xa5, 0x43, 0x8a, 0x46, 0xa3, 0x24, 0x18,
+    0x46, 0xff, 0x97, 0x81, 0xc7, 0xae, 0x9d, 0xc2, 0x4c, 0x76, 0xce, 0xab, 0x73, 0x55, 0xd2, 0x9c,
+    0x7b, 0x58, 0x2d, 0x01, 0xde, 0xf0, 0x62, 0x09, 0xcf, 0xbc, 0x3a, 0xca, 0x3e, 0xe3, 0xe5, 0x64,
+    0x1e, 0x06, 0xbb, 0xd1, 0x32, 0xde, 0x55, 0x47, 0xf1, 0xf0, 0x86, 0x25, 0xb1, 0xd9, 0xe2, 0x80,
+    0x05, 0x27, 0xaf, 0xc7, 0xa7, 0x81, 0x73, 0x62, 0x92, 0xa6, 0x51, 0x0b, 0x67, 0x3f, 0xfb, 0xe2,
+    0xb3, 0x5f, 0xe0, 0x37, 0x63, 0x10, 0x5c, 0x9f, 0xef, 0x54, 0x97, 0xf0, 0xe5, 0x82, 0x11, 0xd5,
+    0x31, 0xcf, 0xd6, 0xed, 0x73, 0x06, 0x2b, 0x86, 0x83, 0x41, 0xf3, 0x69, 0x43, 0x71, 0x7e, 0x51,
+    0xd2, 0x06, 0x26, 0xc3, 0xd2, 0x3b, 0x18, 0x29, 0x0c, 0x5e, 0x6c, 0x89, 0xc0, 0x57, 0x72, 0x3e,
+    0x00, 0x11, 0x40, 0x90, 0x4a, 0x38, 0xf1, 0xcd, 0xa2, 0xe8, 0xf8, 0xc6, 0xf4, 0x14, 0x62, 0x49,
+    0xf0, 0x50, 0x43, 0x71, 0x34, 0xd6, 0xbc, 0xb9, 0x08, 0x0c, 0xd1, 0x60, 0x60, 0x8c, 0x59, 0x9d,
+    0x05, 0x47, 0x46, 0x5c, 0x93, 0x09, 0x7f, 0x5a, 0x25, 0xc1, 0x09, 0xb8, 0xb1, 0xbb, 0x02, 0x8e,
+    0x28, 0x26, 0xc8, 0x86, 0x13, 0xa1, 0x26, 0x6d, 0x7a, 0x66, 0x7e, 0x86, 0x9e, 0x50, 0x62, 0xfb,
+    0x10, 0x1e, 0x07, 0xc6, 0xda, 0xe8, 0x66, 0x1f, 0x58, 0x44, 0x41, 0x61, 0x78, 0x03, 0xa1, 0x60,
+    0x1c, 0xa3, 0xab, 0xb9, 0x8a, 0x72, 0x84, 0x11, 0x14, 0x9d, 0xf1, 0x05, 0x24, 0xf8, 0x1a, 0x7c,
+    0x91, 0x1c, 0x42, 0x76, 0x34, 0xe6, 0x18, 0x5d, 0x43, 0x88, 0x05, 0xbe, 0xb9, 0x42, 0x02, 0x7a,
+    0x77, 0x01, 0xaa, 0xc7, 0x0a, 0xf0, 0xbc, 0x4a, 0x02, 0xe5, 0x05, 0xde, 0x17, 0x15, 0xc1, 0xb0,
+    0x14, 0x3e, 0x2f, 0x6f, 0x99, 0x15, 0xa5, 0xd0, 0xfa, 0x70, 0x4e, 0x99, 0x02, 0x50, 0x45, 0xbc,
+    0x13, 0xcb, 0x76, 0xdd, 0x73, 0x29, 0xa4, 0x1e, 0xb7, 0x3d, 0x2a, 0x4b, 0xbe, 0x58, 0xca, 0xfc,
+    0xa2, 0x7a, 0xf8, 0x95, 0xdd, 0xab, 0x1e, 0xdc, 0x79, 0x39, 0x6f, 0x53, 0xa3, 0x95, 0x32, 0x42,
+    0xb6, 0x16, 0x75, 0x99, 0x24, 0xf1, 0x80, 0x19, 0xb4, 0x1e, 0xd0, 0x6f, 0xaf, 0x8e, 0xe5, 0xba,
+    0x6e, 0x9d, 0xe5, 0x3c, 0xfa, 0xd2, 0x74, 0xd8, 0xef, 0x76, 0xde, 0xac, 0x86, 0x6a, 0xe1, 0x83,
+    0xee, 0xd4, 0x13, 0x04, 0x57, 0xd0, 0xb4, 0x65, 0xcf, 0x6a, 0xd9, 0x51, 0x59, 0xc1, 0x61, 0x75,
+    0xf0, 0x98, 0x84, 0x0d, 0xeb, 0x75, 0x5a, 0x02, 0xb7, 0xaa, 0x81, 0xcf, 0x05, 0x5e, 0xcb, 0x69,
+    0x07, 0x0a, 0x12, 0x63, 0x21, 0xe6, 0x8e, 0x03, 0x11, 0x93, 0x15, 0xb8, 0x64, 0xc8, 0xd6, 0x79,
+    0x0c, 0x7c, 0x4f, 0x81, 0xfb, 0x28, 0x19, 0x71, 0x0e, 0xe1, 0xdb, 0x0c, 0x04, 0x9e, 0x84, 0x42,
+    0x05, 0x6f, 0x49, 0x56, 0x54, 0xcb, 0x0e, 0x25, 0x16, 0xbf, 0x8b, 0x9f, 0xc5, 0x74, 0x09, 0x26,
+    0x0a, 0x4d, 0x81, 0x9b, 0x22, 0x37, 0x4a, 0x76, 0xd0, 0x49, 0xa0, 0xf8, 0x4f, 0x08, 0x57, 0x50,
+    0x30, 0xca, 0x04, 0x82, 0xfd, 0x4d, 0xe2, 0x1a, 0x4b, 0x0c, 0x2c, 0x82, 0x41, 0xc1, 0x58, 0x11,
+    0xea, 0xe1, 0x44, 0x43, 0xf3, 0xb7, 0xba, 0x0c, 0xa9, 0xcf, 0x8e, 0x6a, 0x0a, 0xa3, 0xfa, 0xf6,
+    0x24, 0x11, 0x5a, 0x9a, 0xe2, 0x1b, 0x60, 0x36, 0x3e, 0xc3, 0xdd, 0x51, 0xe0, 0xce, 0xf6, 0xb5,
+    0x4b, 0xee, 0xc6, 0x4f, 0xc7, 0xe3, 0xe7, 0xaf, 0x5f, 0xfd, 0x71, 0x74, 0xfc, 0xf6, 0xd5, 0x7f,
+    0x8a, 0x1b, 0x44, 0x8d, 0x2b, 0x44, 0xd5, 0xfb, 0x37, 0xaf, 0xdf, 0xbe, 0x7a, 0x32, 0xc6, 0x63,
+    0x0e, 0xd2, 0x7a, 0x58, 0x42, 0xef, 0x9f, 0x77, 0x55, 0xbe, 0xcd, 0xcd, 0x47, 0xcd, 0x45, 0x06,
+    0x1c, 0xe2, 0x35, 0xb2, 0x53, 0xf0, 0x6f, 0x83, 0x53, 0x74, 0x5f, 0x38, 0x45, 0xce, 0x52, 0x30,
+    0xbe, 0x7c, 0x73, 0xbd, 0xcc, 0xef, 0xca, 0xe1, 0x44, 0xd9, 0x37, 0x04, 0xca, 0xd2, 0x03, 0xd3,
+    0x32, 0x29, 0x9d, 0xf8, 0x8b, 0x05, 0xef, 0x7b, 0x64, 0xbd, 0x7b, 0x10, 0xd3, 0x07, 0xa8, 0x24,
+    0x97, 0xa1, 0x88, 0xc6, 0xa5, 0x9f, 0xd2, 0xd1, 0xa3, 0x51, 0x8d, 0x4a, 0x92, 0x7f, 0x83, 0x48,
+    0x8f, 0x12, 0x34, 0x09, 0xb5, 0xa4, 0xd9, 0x10, 0x6e, 0xd1, 0x41, 0x13, 0xa3, 0x50, 0x14, 0xaf,
+    0xc8, 0xd3, 0x25, 0x8e, 0x78, 0x71, 0x64, 0xc5, 0x1b, 0xb3, 0xaa, 0xae, 0x02, 0x1a, 0x57, 0x65,
+    0xc3, 0x87, 0xa2, 0x6e, 0x5f, 0x3e, 0xfb, 0xd6, 0x5d, 0xc8, 0x31, 0x12, 0x06, 0x4a, 0xfc, 0xf9,
+    0xab, 0x2d, 0x2b, 0x77, 0xee, 0xb0, 0xdb, 0x02, 0x0d, 0x8a, 0x01, 0xd4, 0xe1, 0x12, 0xb4, 0x61,
+    0x8d, 0x46, 0x90, 0xf0, 0x11, 0x75, 0x03, 0x5c, 0x8f, 0xec, 0x13, 0x0a, 0xb2, 0xa8, 0x2f, 0x95,
+    0xc3, 0x37, 0x95, 0x57, 0xf4, 0x08, 0x8d, 0xc4, 0x39, 0x01, 0xea, 0x8f, 0xd4, 0xe3, 0xaf, 0x80,
+    0xa8, 0x7a, 0xd8, 0x39, 0x34, 0xc5, 0xbd, 0x7d, 0xa9, 0x46, 0xcc, 0xbc, 0x87, 0x2a, 0x30, 0xa8,
+    0x32, 0x3e, 0x4a, 0xf5, 0xab, 0xdd, 0x89, 0x0a, 0xbb, 0x89, 0x1c, 0xbb, 0xd0, 0x74, 0x4d, 0x84,
+    0x52, 0x01, 0x92, 0x32, 0xe7, 0x04, 0xab, 0xfe, 0x13, 0xc8, 0xdb, 0x16, 0x7b, 0xa7, 0x9b, 0x25,
+    0x07, 0xf9, 0x0b, 0x70, 0x59, 0x55, 0x26, 0x25, 0x76, 0x33, 0x98, 0xc0, 0xca, 0x1e, 0xc4, 0x87,
+    0x3c, 0x5a, 0xb4, 0x78, 0x86, 0x20, 0xc2, 0x42, 0xae, 0x7a, 0x52, 0x3d, 0x01, 0x8f, 0xd4, 0x34,
+    0x39, 0xbe, 0x9d, 0x6d, 0x2a, 0xbf, 0xa6, 0x6e, 0xd6, 0x75, 0x45, 0xb7, 0xdb, 0xab, 0x92, 0x81,
+    0x72, 0x54, 0x47, 0x24, 0xb2, 0x3a, 0x5f, 0x75, 0x83, 0xc6, 0x0c, 0xe5, 0x43, 0x19, 0x13, 0xc9,
+    0xb9, 0x8f, 0xd0, 0xc2, 0x53, 0xb9, 0x62, 0x12, 0x60, 0x3a, 0xb0, 0xf6, 0xed, 0xfd, 0x58, 0xfc,
+    0xf7, 0xb9, 0x34, 0x44, 0x2c, 0x42, 0x6b, 0x7c, 0x93, 0xb9, 0x22, 0x04, 0x02, 0x98, 0x2a, 0xeb,
+    0x2e, 0x93, 0x73, 0x07, 0x42, 0x6c, 0x5a, 0x2e, 0x17, 0x91, 0x53, 0x28, 0xba, 0x7a, 0x4a, 0x2d,
+    0x3a, 0x95, 0xa6, 0x8a, 0x17, 0xcd, 0x95, 0x0d, 0x97, 0x53, 0x8b, 0x4f, 0x24, 0xc2, 0x9c, 0x4f,
+    0x78, 0x7c, 0x01, 0x6e, 0xcc, 0xae, 0xf2, 0x26, 0xd1, 0xdc, 0xb3, 0xbb, 0xec, 0xc1, 0xa0, 0xf1,
+    0xc6, 0x92, 0x56, 0x07, 0xd0, 0x72, 0xed, 0xc7, 0x25, 0xde, 0x56, 0xab, 0xa6, 0x2a, 0xb0, 0x13,
+    0xf5, 0x14, 0x36, 0x62, 0xcb, 0x98, 0xc2, 0xe1, 0xd5, 0x52, 0xac, 0x75, 0x10, 0x61, 0xad, 0xbc,
+    0x46, 0xcf, 0x72, 0x1d, 0xe5, 0x10, 0xe9, 0x92, 0x98, 0xc0, 0xe4, 0x0a, 0x46, 0x5a, 0x69, 0x57,
+    0xa0, 0xdd, 0x28, 0xd2, 0xe2, 0x43, 0x7e, 0xfd, 0x06, 0x42, 0xdd, 0x38, 0x6b, 0xa6, 0xa9, 0x79,
+    0x8f, 0xad, 0xb8, 0xfe, 0xf4, 0x6b, 0xa6, 0x9a, 0x8e, 0x3f, 0xf9, 0x71, 0xdb, 0xc4, 0xd4, 0x10,
+    0x9b, 0x6c, 0x33, 0x2f, 0xa0, 0xab, 0x61, 0xcd, 0x0a, 0x3a, 0x62, 0x67, 0x5a, 0x68, 0xe6, 0x92,
+    0x33, 0x45, 0xe8, 0x78, 0xec, 0x39, 0xc2, 0xbf, 0x8f, 0x5a, 0xd2, 0x44, 0xe3, 0x8d, 0x81, 0x2d,
+    0x4d, 0x06, 0x3b, 0xb8, 0x1b, 0x25, 0xa0, 0xb3, 0xc3, 0x24, 0x91, 0xb4, 0xe7, 0x8a, 0x18, 0xae,
+    0x4a, 0x30, 0x3c, 0x15, 0x82, 0x54, 0xbf, 0x53, 0x76, 0xfe, 0xfa, 0x74, 0xef, 0x16, 0x23, 0xd8,
+    0xc4, 0xc4, 0x38, 0x55, 0x35, 0x58, 0x34, 0xc3, 0xfd, 0x30, 0x81, 0x66, 0xba, 0xe5, 0xd4, 0x85,
+    0xf1, 0x15, 0x75, 0xa4, 0x08, 0xda, 0x1c, 0x4a, 0x22, 0xc0, 0x76, 0x23, 0x5f, 0xab, 0x6d, 0x76,
+    0x22, 0xc0, 0x3b, 0x60, 0xe5, 0x3a, 0x03, 0x17, 0x31, 0xc2, 0x93, 0xe6, 0x68, 0xee, 0xeb, 0xcd,
+    0x15, 0xe4, 0x0a, 0x42, 0x68, 0x87, 0x41, 0x59, 0xaf, 0x82, 0x50, 0x51, 0x4a, 0xd1, 0xec, 0x66,
+    0x99, 0xa9, 0x12, 0x2b, 0xac, 0xa0, 0x35, 0x64, 0x3e, 0x95, 0xdb, 0x52, 0x82, 0xa0, 0x7d, 0x55,
+    0xe0, 0xfa, 0x84, 0x9f, 0x8e, 0x6f, 0xe7, 0x50, 0x5b, 0x58, 0xae, 0x92, 0x79, 0x5e, 0x16, 0x19,
+    0x42, 0x22, 0x56, 0xbf, 0xa7, 0x4c, 0x34, 0x43, 0x4a, 0x5d, 0x63, 0xad, 0x73, 0xaa, 0x22, 0xb5,
+    0x76, 0x7f, 0x40, 0xec, 0x2a, 0x6c, 0x30, 0x98, 0x81, 0x0b, 0x31, 0xf5, 0x0c, 0xba, 0x00, 0xd4,
+    0x71, 0x76, 0xeb, 0xa5, 0x53, 0xba, 0xdd, 0x85, 0x9c, 0x62, 0xfb, 0xfc, 0x0a, 0x16, 0xca, 0x83,
+    0xba, 0xc3, 0xca, 0xc5, 0xd5, 0xcf, 0xd8, 0x97, 0x51, 0x22, 0xdd, 0xe9, 0x43, 0x6d, 0x25, 0xd4,
+    0x25, 0x13, 0x6c, 0x6b, 0x85, 0xcc, 0x5a, 0x15, 0xad, 0xa6, 0x0e, 0xeb, 0x2e, 0x52, 0x1f, 0xdf,
+    0xb5, 0x06, 0x5b, 0xf6, 0x09, 0x8b, 0xc8, 0xe2, 0xd0, 0x64, 0x03, 0x25, 0x15, 0x71, 0xef, 0x70,
+    0x45, 0x47, 0x57, 0xac, 0x94, 0xd2, 0xf6, 0x6b, 0x1f, 0x71, 0xda, 0x8e, 0xa5, 0x42, 0xf0, 0x18,
+    0x57, 0xba, 0x28, 0x05, 0x3b, 0x6a, 0x6a, 0xf5, 0x71, 0x83, 0xfb, 0x63, 0x34, 0x4c, 0xf7, 0x64,
+    0xf8, 0x1a, 0xc7, 0x17, 0x76, 0x72, 0xa2, 0x79, 0x66, 0x75, 0xad, 0xa0, 0xe3, 0xf7, 0xa0, 0x4d,
+    0xdb, 0x5d, 0x26, 0x51, 0x9c, 0x7a, 0x3c, 0x1d, 0xcb, 0xd3, 0x10, 0x5e, 0x46, 0xdd, 0x8b, 0x4e,
+    0x7b, 0x68, 0xe1, 0xe2, 0xeb, 0xf7, 0xfb, 0xa1, 0xe2, 0xd4, 0x6f, 0x22, 0x08, 0x50, 0x1e, 0x14,
+    0x56, 0x44, 0x7a, 0x86, 0x01, 0x4c, 0x9d, 0x10, 0x20, 0x5c, 0x99, 0x6e, 0xcc, 0x55, 0x57, 0xf0,
+    0xe0, 0xfa, 0x8c, 0xa0, 0x80, 0xc3, 0xeb, 0xb8, 0xa4, 0xb1, 0xdc, 0xc5, 0x84, 0x5b, 0x2d, 0x15,
+    0x8e, 0xf9, 0xb4, 0xe6, 0x78, 0x78, 0x4f, 0xd0, 0xda, 0x2b, 0x7a, 0xf6, 0xa7, 0x8c, 0xd5, 0xe5,
+    0xd3, 0x66, 0x5a, 0x33, 0x54, 0x23, 0xb7, 0xab, 0xb7, 0xdc, 0x11, 0x0e, 0x43, 0x4b, 0xde, 0x4f,
+    0x61, 0xbb, 0x26, 0xd8, 0xae, 0x5c, 0x99, 0x9b, 0xed, 0x9c, 0xc1, 0x6b, 0x02, 0x18, 0xde, 0xbc,
+    0xc0, 0x53, 0x2e, 0xcf, 0x7b, 0x7c, 0x25, 0x26, 0xe3, 0x82, 0xec, 0x98, 0xbe, 0x36, 0xd1, 0x63,
+    0xd1, 0x64, 0xc2, 0x97, 0x25, 0x2d, 0x9d, 0x4b, 0x53, 0x2d, 0x70, 0x57, 0x5f, 0xa0, 0xc0, 0xe5,
+    0xe3, 0x47, 0xa5, 0x3c, 0x79, 0x12, 0x06, 0x02, 0x1e, 0x93, 0x75, 0xe2, 0x62, 0xd7, 0xbb, 0x5d,
+    0xba, 0xca, 0xb9, 0x2b, 0x2f, 0x63, 0x96, 0x6c, 0x57, 0x5f, 0xb9, 0xe8, 0x47, 0xd3, 0x29, 0x51,
+    0xae, 0x08, 0x0f, 0x83, 0x09, 0x28, 0x2e, 0x0e, 0xb8, 0xc8, 0xcc, 0xd5, 0xcd, 0x50, 0x79, 0x35,
+    0x5f, 0xd7, 0xe5, 0x1e, 0x0c, 0xf3, 0x28, 0x3d, 0xe7, 0x88, 0x82, 0x5b, 0x17, 0xdf, 0xe1, 0x7c,
+    0x58, 0xdd, 0xbb, 0x89, 0x28, 0xf0, 0x62, 0x90, 0x8e, 0x7e, 0x41, 0xb7, 0xfb, 0x56, 0x8e, 0x8d,
+    0x76, 0x3d, 0x3d, 0x1e, 0x21, 0xa5, 0xb5, 0x27, 0xec, 0xc5, 0x75, 0xdd, 0xc1, 0x53, 0xa5, 0x78,
+    0x03, 0x85, 0x8f, 0x1c, 0x88, 0x1c, 0xcb, 0x6c, 0x09, 0xf2, 0xb2, 0x8c, 0xce, 0x23, 0xf1, 0x11,
+    0x94, 0xd1, 0x56, 0x17, 0x82, 0x54, 0xed, 0xd5, 0xd7, 0x6d, 0x40, 0xcb, 0x5a, 0x63, 0x1a, 0xd5,
+    0x5b, 0xd0, 0x97, 0xf0, 0xe8, 0x82, 0x57, 0x2c, 0xff, 0xab, 0xad, 0x99, 0x9c, 0xe3, 0xfd, 0x0c,
+    0xdf, 0xd8, 0x52, 0xb6, 0xfc, 0xd1, 0x5c, 0x68, 0x22, 0xaf, 0x1e, 0x7c, 0x5c, 0x04, 0x3d, 0xc5,
+    0x4d, 0x65, 0x33, 0x9e, 0x37, 0x89, 0x80, 0x1f, 0xc6, 0x15, 0x04, 0xda, 0x2b, 0x1f, 0xd7, 0xd7,
+    0xe3, 0x80, 0xba, 0xbc, 0xcc, 0x56, 0x85, 0x48, 0x2a, 0xe9, 0x57, 0xf5, 0xb8, 0xcc, 0x58, 0x20,
+    0xdc, 0x34, 0x5b, 0xa7, 0xc2, 0xab, 0x13, 0x37, 0xc2, 0x28, 0x1e, 0xaa, 0x7b, 0xa4, 0x1b, 0xaa,
+    0xd1, 0x0d, 0x19, 0x5d, 0x79, 0x17, 0xc9, 0x96, 0x75, 0x56, 0x4b, 0x72, 0x13, 0xa6, 0xb2, 0x4a,
+    0x4b, 0x0f, 0x4e, 0xf1, 0x5e, 0x9b, 0x2d, 0x7a, 0x40, 0xf7, 0xdf, 0x10, 0xe9, 0x7a, 0x17, 0x30,
+    0x77, 0xba, 0x84, 0xd1, 0x00, 0xdb, 0x7b, 0x20, 0xf2, 0xce, 0xb5, 0x68, 0x34, 0x93, 0x48, 0xb8,
+    0x8c, 0x6e, 0xdd, 0x00, 0x0f, 0x27, 0x07, 0xdb, 0xed, 0xab, 0x3c, 0xdb, 0x0d, 0x16, 0x57, 0x9d,
+    0x4e, 0xd0, 0x3b, 0x68, 0x7c, 0xa2, 0xe7, 0x51, 0x92, 0xe0, 0xf5, 0xf1, 0xf2, 0xde, 0x9a, 0x3e,
+    0xd8, 0x3d, 0xdc, 0xe0, 0x17, 0xce, 0xe5, 0xe9, 0x70, 0x5d, 0x7a, 0x45, 0xd9, 0x35, 0x23, 0xec,
+    0xc8, 0xfc, 0xb5, 0x72, 0x2f, 0xa3, 0x8e, 0xea, 0xa6, 0xa0, 0x91, 0x37, 0x7d, 0xd6, 0xd8, 0xb8,
+    0x31, 0x38, 0xdf, 0xb5, 0xf5, 0x96, 0x81, 0xd1, 0x55, 0x43, 0x1c, 0x93, 0x16, 0x53, 0x85, 0x73,
+    0xea, 0xda, 0xa5, 0x97, 0x66, 0x1b, 0x8f, 0x05, 0x32, 0xbe, 0xbd, 0x63, 0x7d, 0x57, 0xc3, 0x7f,
+    0x98, 0xfb, 0xba, 0x4b, 0x02, 0xea, 0x6f, 0x97, 0xe8, 0xc7, 0xb9, 0xb7, 0xa7, 0x48, 0xfb, 0xc0,
+    0x8f, 0x45, 0x8f, 0xef, 0x84, 0xf8, 0x16, 0xd4, 0x28, 0x8e, 0x3d, 0x5e, 0x95, 0xa5, 0xfa, 0xac,
+    0x95, 0x5a, 0xc3, 0x69, 0x9e, 0x1d, 0xab, 0x3d, 0x32, 0x0a, 0x83, 0xfa, 0x00, 0xd0, 0xb5, 0x33,
+    0xaa, 0x8f, 0xb9, 0x3a, 0xc9, 0xe6, 0x0e, 0x08, 0x5f, 0xa7, 0x4c, 0x88, 0xb6, 0x21, 0x02, 0xbf,
+    0x71, 0xb4, 0x05, 0xe7, 0x0c, 0x30, 0x34, 0xd3, 0xad, 0xdb, 0x7c, 0xf4, 0x5b, 0x2d, 0x4d, 0x40,
+    0x67, 0x89, 0x4b, 0x63, 0x0e, 0x7d, 0xf8, 0xa8, 0x85, 0x39, 0x22, 0x82, 0xb4, 0x59, 0xa4, 0x2d,
+    0xd7, 0x11, 0x82, 0xeb, 0xd6, 0x7e, 0xdd, 0xd4, 0x59, 0x95, 0x2e, 0x6b, 0xce, 0x8b, 0x4c, 0xe8,
+    0x9b, 0x4c, 0x5b, 0xae, 0xdd, 0xe6, 0xed, 0x79, 0x11, 0x8d, 0x60, 0xb5, 0x5a, 0x4b, 0xe8, 0x3d,
+    0xcb, 0xb4, 0x5f, 0x75, 0x41, 0x2a, 0x21, 0xf1, 0x5d, 0xf9, 0x6a, 0xa5, 0x1e, 0x1a, 0x8f, 0x0b,
+    0x35, 0x2c, 0x7c, 0x7a, 0x12, 0x56, 0xee, 0xd8, 0xe1, 0x07, 0xa9, 0x6e, 0x32, 0x74, 0x63, 0xf0,
+    0xca, 0x69, 0x4d, 0x88, 0xd3, 0x76, 0x27, 0xfc, 0x9c, 0x45, 0xfa, 0xfd, 0x86, 0x0f, 0xb1, 0x7e,
+    0xff, 0xd1, 0x3b, 0xd5, 0x68, 0xad, 0xd7, 0xc4, 0x6f, 0x36, 0x88, 0x18, 0x9d, 0x18, 0x4c, 0xf8,
+    0xdf, 0x1e, 0x48, 0xfa, 0x6a, 0xd8, 0x4d, 0x46, 0xf2, 0x29, 0xba, 0x2a, 0x38, 0x94, 0x05, 0x7d,
+    0x8e, 0x6c, 0x01, 0xe1, 0xfe, 0xf7, 0x1b, 0x48, 0xc2, 0xf9, 0xe3, 0xf4, 0x30, 0x4e, 0x35, 0xaa,
+    0x6f, 0x36, 0x90, 0xe2, 0x84, 0x5a, 0x0b, 0xb6, 0x1f, 0x39, 0x8e, 0xb4, 0xb5, 0x10, 0x86, 0x0d,
+    0x53, 0xa2, 0x24, 0x4c, 0x62, 0x77, 0xe1, 0x19, 0xcd, 0x5f, 0xe6, 0x47, 0xe3, 0x00, 0xce, 0xfc,
+    0xb4, 0x9c, 0x2c, 0x50, 0xf4, 0x22, 0x23, 0xeb, 0x52, 0x9d, 0xc2, 0xba, 0xf4, 0x2b, 0x26, 0x34,
+    0xab, 0x5b, 0x92, 0xca, 0x4a, 0xf3, 0x5b, 0x3e, 0x5c, 0x54, 0xb9, 0xc3, 0x78, 0xb9, 0x3c, 0x8b,
+    0x04, 0xfc, 0x79, 0x1e, 0x4d, 0x63, 0x4a, 0x3e, 0x3a, 0x5f, 0x7f, 0xa9, 0x0f, 0x24, 0x1e, 0x7d,
+    0xdb, 0xd7, 0x5f, 0xea, 0xaa, 0xd5, 0x89, 0xd8, 0xfb, 0x83, 0x41, 0x23, 0x4c, 0x75, 0x10, 0xf6,
+    0xde, 0xc0, 0x9b, 0x8b, 0x22, 0x50, 0xba, 0xd5, 0x47, 0xab, 0xe4, 0xde, 0xec, 0xe3, 0x6c, 0xae,
+    0xc4, 0x43, 0x9b, 0x55, 0x37, 0x71, 0x57, 0xc7, 0xb9, 0xbb, 0x20, 0x51, 0x5d, 0x23, 0x23, 0xa0,
+    0x0e, 0x55, 0x63, 0xb2, 0xa3, 0x2f, 0xe2, 0x14, 0xa6, 0x86, 0xdf, 0xe5, 0x6b, 0x79, 0x90, 0x0f,
+    0xfa, 0xd2, 0x45, 0x5a, 0xad, 0x5e, 0x2b, 0x24, 0x38, 0xa6, 0x47, 0x59, 0x92, 0xe5, 0x63, 0xf0,
+    0x41, 0xb1, 0x8a, 0x3c, 0x74, 0xbb, 0x1d, 0x78, 0x7f, 0x1f, 0x2a, 0xe0, 0xb1, 0xff, 0xed, 0xe0,
+    0x31, 0x6b, 0x44, 0xe7, 0x41, 0xbc, 0x63, 0x60, 0x9d, 0xfe, 0x55, 0x28, 0x9a, 0x21, 0xb5, 0xf3,
+    0xbf, 0x5a, 0x2f, 0xbd, 0x9c, 0xa5, 0x3b, 0x56, 0x8a, 0x79, 0xb4, 0xe4, 0xc5, 0xb5, 0x0d, 0x4b,
+    0x12, 0xaf, 0x69, 0x77, 0x0f, 0x1a, 0xc4, 0xff, 0x87, 0xd8, 0xf2, 0x4f, 0x83, 0x2d, 0x3a, 0xe4,
+    0x1c, 0x67, 0xf6, 0xe3, 0x7d, 0xe0, 0x20, 0xf6, 0xf6, 0x68, 0x12, 0xe7, 0xe0, 0x09, 0xf8, 0x7b,
+    0x73, 0xc6, 0xc1, 0x15, 0x3b, 0x89, 0xca, 0x79, 0xd8, 0x40, 0x56, 0x94, 0x4f, 0x42, 0xc2, 0xbf,
+    0x87, 0xbf, 0xf6, 0x05, 0x0f, 0x29, 0xcf, 0x76, 0xf2, 0x1c, 0xaf, 0xd5, 0xd9, 0xa6, 0x37, 0xd7,
+    0x71, 0xc9, 0xd9, 0x08, 0xfd, 0x55, 0xd4, 0xdd, 0xbb, 0x21, 0x75, 0xd7, 0xf1, 0x3a, 0x6c, 0xe2,
+    0x2b, 0x2a, 0xa9, 0xbf, 0x56, 0x26, 0x3c, 0xe4, 0xb3, 0x2c, 0x99, 0xb2, 0xbd, 0xfb, 0xcb, 0x4b,
+    0x56, 0x44, 0x69, 0xd1, 0x2b, 0x60, 0x16, 0x9c, 0x05, 0xdf, 0x81, 0x5f, 0xa7, 0x64, 0x1d, 0x9e,
+    0xf6, 0x4e, 0xf0, 0xa8, 0x2a, 0x3b, 0x15, 0xae, 0xcc, 0xf0, 0x1e, 0x4a, 0xc2, 0xbe, 0x4f, 0x0a,
+    0xb4, 0xf3, 0xc4, 0xc2, 0xec, 0x63, 0x1e, 0x4c, 0x7e, 0xb3, 0xd0, 0xb7, 0x79, 0xb1, 0xfa, 0xfe,
+    0x8e, 0x66, 0x97, 0xb6, 0xf9, 0xf8, 0xd3, 0x56, 0xdf, 0xef, 0xd8, 0xea, 0xf3, 0x1b, 0xf6, 0xd7,
+    0x11, 0xbc, 0x1f, 0x88, 0xb0, 0x3e, 0xe4, 0xd9, 0x76, 0x9d, 0x9d, 0xfe, 0xd1, 0x4d, 0x32, 0x00,
+    0xf3, 0x03, 0xb4, 0x01, 0xc6, 0x85, 0xb8, 0x15, 0x5a, 0xdf, 0xbd, 0xe6, 0x8e, 0x9d, 0x77, 0x20,
+    0x9b, 0xad, 0xbd, 0x06, 0xea, 0xbf, 0xd4, 0xdc, 0xf7, 0x55, 0x9f, 0xaf, 0xb9, 0x2a, 0xdb, 0x3d,
+    0x61, 0xd0, 0x70, 0x05, 0xdf, 0x76, 0xc7, 0x10, 0x7c, 0x4e, 0xad, 0x90, 0x1b, 0xfc, 0x48, 0x11,
+    0x5e, 0x47, 0x4b, 0x73, 0xb9, 0x58, 0x95, 0x02, 0x99, 0x7a, 0xd2, 0x10, 0x60, 0xb8, 0xe3, 0xde,
+    0xf0, 0xb1, 0x9f, 0x2b, 0x67, 0xbf, 0x9a, 0xbc, 0xba, 0x5d, 0xae, 0xda, 0xde, 0x72, 0xf6, 0xf4,
+    0x0a, 0x32, 0x44, 0xe6, 0x07, 0xa4, 0xb9, 0xbe, 0x36, 0x82, 0x2c, 0x86, 0xfe, 0x39, 0xda, 0x7a,
+    0x9d, 0x4e, 0xaa, 0xcb, 0x49, 0x96, 0xe3, 0x11, 0x88, 0xb8, 0xba, 0x1c, 0x5e, 0x4c, 0xb2, 0x57,
+    0x1d, 0xe4, 0xc3, 0xff, 0x00, 0x4c, 0x47, 0xa0, 0xb0, 0xdb, 0x7a, 0x00, 0x00,
+};
+
+#endif // WEB_ASSETS_H
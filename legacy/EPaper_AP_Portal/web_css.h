@@ -1,6 +1,7 @@
 #ifndef WEB_CSS_H
 #define WEB_CSS_H
 
+// Source only: the server sends the gzip copy in web_assets.h (see README)
 const char CSS_STYLES[] PROGMEM = R"rawliteral(
 :root {
     --primary: #2563eb;
@@ -210,6 +211,16 @@ header h1 {
     cursor: pointer;
 }
 
+.control-group select {
+    flex: 1;
+    padding: 6px;
+    font-size: 14px;
+    border: 1px solid var(--border);
+    border-radius: 6px;
+    background: transparent;
+    color: inherit;
+}
+
 .control-group span {
     width: 40px;
     text-align: right;
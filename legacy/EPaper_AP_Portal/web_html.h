@@ -1,6 +1,7 @@
 #ifndef WEB_HTML_H
 #define WEB_HTML_H
 
+// Source only: the server sends the gzip copy in web_assets.h (see README)
 const char HTML_PAGE[] PROGMEM = R"rawliteral(
 <!DOCTYPE html>
 <html lang="en">
@@ -63,6 +64,14 @@ const char HTML_PAGE[] PROGMEM = R"rawliteral(
                     <input type="range" id="contrast" min="-100" max="100" value="0">
                     <span id="contrastVal">0</span>
                 </div>
+                <div class="control-group">
+                    <label>Upload</label>
+                    <select id="uploadFormat">
+                        <option value="binary" selected>Binary</option>
+                        <option value="packbits">PackBits</option>
+                        <option value="nibble">Nibble (legacy)</option>
+                    </select>
+                </div>
             </div>
 
             <div class="actions">
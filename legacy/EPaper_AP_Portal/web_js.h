@@ -1,6 +1,7 @@
 #ifndef WEB_JS_H
 #define WEB_JS_H
 
+// Source only: the server sends the gzip copy in web_assets.h (see README)
 const char JS_APP[] PROGMEM = R"rawliteral(
 (function() {
     'use strict';
@@ -23,6 +24,7 @@ const char JS_APP[] PROGMEM = R"rawliteral(
     const contrastSlider = $('#contrast');
     const brightnessVal = $('#brightnessVal');
     const contrastVal = $('#contrastVal');
+    const uploadFormat = $('#uploadFormat');
     const btnSend = $('#btnSend');
     const btnReset = $('#btnReset');
     const btnClear = $('#btnClear');
@@ -474,6 +476,49 @@ const char JS_APP[] PROGMEM = R"rawliteral(
         return String.fromCharCode((v & 0xF) + 97, ((v >> 4) & 0xF) + 97);
     }
 
+    // ===========================================
+    // PackBits compression
+    // ===========================================
+    // Header n >= 0: n+1 literal bytes follow; n < 0: the next byte
+    // repeats 1-n times. Dithered images have long white and black runs.
+    function packBits(data) {
+        const out = new Uint8Array(data.length + Math.ceil(data.length / 128));
+        let o = 0;
+        let i = 0;
+        while (i < data.length) {
+            let run = 1;
+            while (i + run < data.length && run < 128 && data[i + run] === data[i]) run++;
+            if (run >= 2) {
+                out[o++] = 257 - run;
+                out[o++] = data[i];
+                i += run;
+                continue;
+            }
+            // Literal span, ended by a run of three or more
+            const start = i;
+            while (i < data.length && i - start < 128 &&
+                   !(i + 2 < data.length && data[i] === data[i + 1] && data[i] === data[i + 2])) {
+                i++;
+            }
+            out[o++] = i - start - 1;
+            out.set(data.subarray(start, i), o);
+            o += i - start;
+        }
+        return out.subarray(0, o);
+    }
+
+    // CRC-CCITT (0x1021, initial 0xFFFF) of the bytes a chunk decodes to
+    function crc16(bytes) {
+        let crc = 0xFFFF;
+        for (let i = 0; i < bytes.length; i++) {
+            crc ^= bytes[i] << 8;
+            for (let j = 0; j < 8; j++) {
+                crc = (crc & 0x8000) ? ((crc << 1) ^ 0x1021) & 0xFFFF : (crc << 1) & 0xFFFF;
+            }
+        }
+        return crc;
+    }
+
     // ===========================================
     // API Communication
     // ===========================================
@@ -505,43 +550,14 @@ const char JS_APP[] PROGMEM = R"rawliteral(
             console.log('Packed stats - Non-zero bytes:', nonZeroCount, 'All-FF bytes:', allFFCount, 'of', packed.length);
             console.log('First 16 packed bytes:', Array.from(packed.slice(0, 16)).map(b => b.toString(16).padStart(2, '0')).join(' '));
 
-            // Encode data
-            let encodedData = '';
-            for (let i = 0; i < packed.length; i++) {
-                encodedData += byteToStr(packed[i]);
-            }
-            console.log('Encoded length:', encodedData.length, 'First 40 chars:', encodedData.substring(0, 40));
-
-            setStatus('Uploading to display...', true);
-
-            // Send in chunks
-            const chunkSize = 1000;
-            const totalChunks = Math.ceil(encodedData.length / chunkSize);
-
-            for (let i = 0; i < totalChunks; i++) {
-                const chunk = encodedData.slice(i * chunkSize, (i + 1) * chunkSize);
-                const isFirst = i === 0;
-
-                const response = await fetch('/api/upload', {
-                    method: 'POST',
-                    headers: {
-                        'Content-Type': 'text/plain',
-                        ...(isFirst ? { 'X-Upload-Start': '1' } : {})
-                    },
-                    body: chunk
-                });
-
-                if (!response.ok) {
-                    const text = await response.text();
-                    throw new Error('Upload failed: ' + text);
-                }
-
-                const result = await response.json();
-                console.log('Upload chunk', i + 1, '/', totalChunks, '- received:', result.received, 'total:', result.total);
-
-                const progress = Math.round(((i + 1) / totalChunks) * 80);
-                showProgress(progress);
-            }
+            const format = uploadFormat.value;
+            setStatus('Uploading to display (' + format + ')...', true);
+            const uploadStart = performance.now();
+            const result = format === 'nibble' ? await uploadNibble(packed)
+                                               : await uploadSession(packed, format === 'packbits');
+            const uploadMs = Math.round(performance.now() - uploadStart);
+            console.log('Upload', format + ':', result.wire_bytes, 'bytes,', uploadMs, 'ms in browser,',
+                        result.elapsed_ms, 'ms on device');
 
             setStatus('Refreshing display...', true);
             showProgress(90);
@@ -553,7 +569,7 @@ const char JS_APP[] PROGMEM = R"rawliteral(
             }
 
             showProgress(100);
-            setStatus('Image displayed successfully!');
+            setStatus('Image displayed (' + format + ', ' + result.wire_bytes + ' bytes in ' + uploadMs + ' ms)');
 
             setTimeout(() => hideProgress(), 1000);
 
@@ -566,6 +582,107 @@ const char JS_APP[] PROGMEM = R"rawliteral(
         }
     }
 
+    // POST one upload request; a rejected one is rolled back by the
+    // server, so it is resent as is
+    async function postUpload(headers, body) {
+        let response;
+        for (let attempt = 0; attempt < 3; attempt++) {
+            response = await fetch('/api/upload', { method: 'POST', headers: headers, body: body });
+            if (response.ok) break;
+        }
+        if (!response.ok) {
+            const text = await response.text();
+            throw new Error('Upload failed: ' + text);
+        }
+        return response.json();
+    }
+
+    // Upload session: chunks are written at their offset, so a chunk lost
+    // to a WiFi drop is simply resent from the server's missing list
+    // instead of restarting the image. Chunks are a multiple of the
+    // server's block size.
+    const SESSION_CHUNK = 3000;
+    const SESSION_ROUNDS = 5;
+
+    async function uploadSession(packed, compress) {
+        const hex = (crc) => crc.toString(16).padStart(4, '0');
+        const startResponse = await fetch('/api/upload/session', {
+            method: 'POST',
+            headers: { 'X-Image-CRC': hex(crc16(packed)) }
+        });
+        if (!startResponse.ok) {
+            throw new Error('Upload session failed: ' + await startResponse.text());
+        }
+        let state = await startResponse.json();
+        const session = state.session;
+
+        for (let round = 0; round < SESSION_ROUNDS && !state.complete; round++) {
+            for (const [from, to] of state.missing) {
+                for (let offset = from; offset < to; offset += SESSION_CHUNK) {
+                    const bytes = packed.subarray(offset, Math.min(offset + SESSION_CHUNK, to));
+                    const headers = {
+                        'Content-Type': 'application/octet-stream',
+                        'X-Upload-Session': String(session),
+                        'X-Upload-Offset': String(offset),
+                        'X-Chunk-CRC': hex(crc16(bytes))
+                    };
+                    if (compress) headers['X-Encoding'] = 'packbits';
+                    try {
+                        const result = await postUpload(headers, compress ? packBits(bytes) : bytes);
+                        if (result.complete) state = result;
+                        showProgress(Math.round(result.received / result.size * 80));
+                    } catch (error) {
+                        // Still missing on the server; picked up next round
+                        console.warn('Chunk at', offset, 'failed:', error.message);
+                    }
+                }
+            }
+            if (!state.complete) {
+                const statusResponse = await fetch('/api/upload/session');
+                if (!statusResponse.ok) {
+                    throw new Error('Upload session lost: ' + await statusResponse.text());
+                }
+                state = await statusResponse.json();
+                console.log('Session round', round + 1, '- received:', state.received, 'missing:', state.missing);
+            }
+        }
+        if (!state.complete) {
+            throw new Error('Upload incomplete after ' + SESSION_ROUNDS + ' rounds');
+        }
+        return state;
+    }
+
+    // Original format: two characters per byte, sent in 1000-character requests
+    async function uploadNibble(packed) {
+        let encodedData = '';
+        for (let i = 0; i < packed.length; i++) {
+            encodedData += byteToStr(packed[i]);
+        }
+        console.log('Encoded length:', encodedData.length, 'First 40 chars:', encodedData.substring(0, 40));
+
+        // Send in chunks
+        const chunkSize = 1000;
+        const totalChunks = Math.ceil(encodedData.length / chunkSize);
+        let result = null;
+
+        for (let i = 0; i < totalChunks; i++) {
+            const chunk = encodedData.slice(i * chunkSize, (i + 1) * chunkSize);
+            const isFirst = i === 0;
+            const chunkBytes = packed.subarray(i * chunkSize / 2, (i + 1) * chunkSize / 2);
+
+            result = await postUpload({
+                'Content-Type': 'text/plain',
+                'X-Chunk-CRC': crc16(chunkBytes).toString(16).padStart(4, '0'),
+                ...(isFirst ? { 'X-Upload-Start': '1' } : {})
+            }, chunk);
+            console.log('Upload chunk', i + 1, '/', totalChunks, '- received:', result.received, 'total:', result.total);
+
+            const progress = Math.round(((i + 1) / totalChunks) * 80);
+            showProgress(progress);
+        }
+        return result;
+    }
+
     // ===========================================
     // Event Listeners
     // ===========================================
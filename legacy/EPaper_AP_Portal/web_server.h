@@ -4,11 +4,11 @@
 #include <WebServer.h>
 #include <ArduinoJson.h>
 #include "config.h"
+#include "log.h"
 #include "epd_driver.h"
 #include "image_buffer.h"
-#include "web_html.h"
-#include "web_css.h"
-#include "web_js.h"
+#include "upload_decode.h"
+#include "web_assets.h"   // web_html.h, web_css.h, web_js.h gzip-compressed
 
 // ===========================================
 // CORS Headers for API
@@ -16,21 +16,35 @@
 void sendCorsHeaders(WebServer* server) {
     server->sendHeader("Access-Control-Allow-Origin", "*");
     server->sendHeader("Access-Control-Allow-Methods", "GET, POST, OPTIONS");
-    server->sendHeader("Access-Control-Allow-Headers", "Content-Type");
+    server->sendHeader("Access-Control-Allow-Headers", "Content-Type, X-Encoding, X-Upload-Start, X-Chunk-CRC, "
+                       "X-Upload-Session, X-Upload-Offset, X-Image-CRC");
 }
 
 // ===========================================
 // API Response Helpers
 // ===========================================
+// JSON is serialized into one static buffer instead of a String so the
+// handlers do not allocate. Handlers run on the loop task, one at a time.
+static char jsonBuffer[JSON_BUFFER_SIZE];
+
+void sendJsonDocument(WebServer* server, int code, const JsonDocument& doc) {
+    // serializeJson() would cut the document short without saying so
+    size_t length = measureJson(doc);
+    if (length >= sizeof(jsonBuffer)) {
+        LOG_E("JSON response of %u bytes exceeds JSON_BUFFER_SIZE", (unsigned)length);
+        server->send(500, "application/json", "{\"status\":\"error\",\"message\":\"Response too large\"}");
+        return;
+    }
+    serializeJson(doc, jsonBuffer, sizeof(jsonBuffer));
+    server->send(code, "application/json", jsonBuffer);
+}
+
 void sendJsonResponse(WebServer* server, int code, const char* status, const char* message) {
     sendCorsHeaders(server);
     StaticJsonDocument<256> doc;
     doc["status"] = status;
     doc["message"] = message;
-
-    String response;
-    serializeJson(doc, response);
-    server->send(code, "application/json", response);
+    sendJsonDocument(server, code, doc);
 }
 
 void sendJsonSuccess(WebServer* server, const char* message) {
@@ -45,21 +59,45 @@ void sendJsonError(WebServer* server, int code, const char* message) {
 // Route Handlers
 // ===========================================
 
+// Sends an asset from web_assets.h as stored (gzip), or 304 if the
+// client's copy is current. With no-cache the browser revalidates on every
+// load: a firmware update shows up at once, an unchanged page costs a 304.
+void sendAsset(WebServer* server, const char* type, const uint8_t* gz, size_t len, const char* etag) {
+    server->sendHeader("ETag", etag);
+    server->sendHeader("Cache-Control", "no-cache");
+    if (server->header("If-None-Match").indexOf(etag) >= 0) {
+        server->send(304);
+        return;
+    }
+    server->sendHeader("Content-Encoding", "gzip");
+    server->send_P(200, type, (const char*)gz, len);
+}
+
 // GET / - Main page
 void handleRoot(WebServer* server) {
-    server->send(200, "text/html", HTML_PAGE);
+    sendAsset(server, "text/html", HTML_PAGE_GZ, HTML_PAGE_GZ_LEN, HTML_PAGE_ETAG);
 }
 
 // GET /styles.css
 void handleCSS(WebServer* server) {
-    server->send(200, "text/css", CSS_STYLES);
+    sendAsset(server, "text/css", CSS_STYLES_GZ, CSS_STYLES_GZ_LEN, CSS_STYLES_ETAG);
 }
 
 // GET /app.js
 void handleJS(WebServer* server) {
-    server->send(200, "application/javascript", JS_APP);
+    sendAsset(server, "application/javascript", JS_APP_GZ, JS_APP_GZ_LEN, JS_APP_ETAG);
 }
 
+// Whole-image timing, from the X-Upload-Start request until the buffer
+// is full, for comparing formats
+struct UploadTiming {
+    UploadFormat format;
+    uint32_t startMs;
+    uint32_t wireBytes;    // Body bytes over HTTP, all requests
+    uint32_t elapsedMs;    // 0 while in progress
+};
+static UploadTiming uploadTiming;
+
 // GET /api/status - Get display status
 void handleApiStatus(WebServer* server) {
     sendCorsHeaders(server);
@@ -72,18 +110,23 @@ void handleApiStatus(WebServer* server) {
     doc["buffer"]["size"] = IMAGE_BUFFER_SIZE;
     doc["buffer"]["filled"] = ImageBuffer_GetFillLevel();
     doc["buffer"]["ready"] = ImageBuffer_IsReady();
+    if (uploadTiming.elapsedMs) {
+        doc["last_upload"]["format"] = uploadFormatNames[uploadTiming.format];
+        doc["last_upload"]["wire_bytes"] = uploadTiming.wireBytes;
+        doc["last_upload"]["elapsed_ms"] = uploadTiming.elapsedMs;
+    }
     doc["api"]["version"] = API_VERSION;
     doc["heap"]["free"] = ESP.getFreeHeap();
     doc["heap"]["total"] = ESP.getHeapSize();
+    doc["heap"]["min"] = ESP.getMinFreeHeap();
+    doc["heap"]["largest"] = ESP.getMaxAllocHeap();
 
     if (psramFound()) {
         doc["psram"]["free"] = ESP.getFreePsram();
         doc["psram"]["total"] = ESP.getPsramSize();
     }
 
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    sendJsonDocument(server, 200, doc);
 }
 
 // POST /api/clear - Clear display
@@ -93,99 +136,258 @@ void handleApiClear(WebServer* server) {
     sendJsonSuccess(server, "Display cleared");
 }
 
-// Decode nibble from character (matching original byteToStr format)
-// Original encodes: low_nibble+'a', high_nibble+'a'
-inline uint8_t decodeNibble(char c) {
-    if (c >= 'a' && c <= 'p') {
-        return c - 'a';
+// Body of POST /api/upload, called by WebServer as the data arrives
+void handleApiUploadBody(WebServer* server) {
+    HTTPRaw& raw = server->raw();
+
+    if (raw.status == RAW_START) {
+        UploadFormat format = UPLOAD_NIBBLE;
+        if (server->header("Content-Type").startsWith("application/octet-stream")) {
+            format = server->header("X-Encoding") == "packbits" ? UPLOAD_PACKBITS : UPLOAD_BINARY;
+        }
+        upload = {format, false, ImageBuffer_GetFillLevel(), 0, 0xFFFF, -1, 0, 0, false, nullptr, 0};
+
+        if (server->hasHeader("X-Upload-Session")) {
+            // Session chunk: written at its offset, CRC required
+            uint16_t id = server->header("X-Upload-Session").toInt();
+            long offset = server->header("X-Upload-Offset").toInt();
+            upload.inSession = true;
+            upload.startIndex = offset;
+            if (id == 0 || id != ImageBuffer_SessionId()) {
+                upload.refused = "Unknown upload session";
+                upload.refusedCode = 409;
+            } else if (!server->hasHeader("X-Upload-Offset") || !server->hasHeader("X-Chunk-CRC")) {
+                upload.refused = "Session chunks need X-Upload-Offset and X-Chunk-CRC";
+                upload.refusedCode = 400;
+            } else if (offset < 0 || offset >= IMAGE_BUFFER_SIZE || offset % UPLOAD_BLOCK_SIZE != 0) {
+                upload.refused = "Offset not on a block boundary";
+                upload.refusedCode = 400;
+            } else {
+                uploadTiming.format = format;
+            }
+            return;
+        }
+        if (ImageBuffer_SessionId() != 0 && !server->hasHeader("X-Upload-Start")) {
+            upload.refused = "Upload session in progress";
+            upload.refusedCode = 409;
+            return;
+        }
+
+        // Check if this is the start of a new upload - clear buffer completely
+        if (server->hasHeader("X-Upload-Start")) {
+            ImageBuffer_Clear();  // Clear to 0x00 (black) - actual image data will overwrite
+            memset(ImageBuffer_GetPtr(), 0x00, IMAGE_BUFFER_SIZE);  // Ensure clean slate
+            ImageBuffer_Reset();
+            uploadTiming = {format, (uint32_t)millis(), 0, 0};
+            LOG_I("Starting new %s image upload - buffer cleared", uploadFormatNames[format]);
+            upload.startIndex = 0;
+        }
+        return;
+    }
+    if (raw.status != RAW_WRITE || upload.overflow || upload.refused) return;
+
+    uploadTiming.wireBytes += raw.currentSize;
+    switch (upload.format) {
+        case UPLOAD_NIBBLE:
+            uploadDecodeNibbles(raw.buf, raw.currentSize);
+            break;
+        case UPLOAD_BINARY:
+            // Already in buffer format: no decode buffer at all
+            uploadStore(raw.buf, raw.currentSize);
+            break;
+        case UPLOAD_PACKBITS:
+            uploadDecodePackBits(raw.buf, raw.currentSize);
+            break;
+    }
+}
+
+// Session fields shared by the upload and session responses: what is in,
+// and the first UPLOAD_MAX_RANGES missing ranges as [start, end) offsets
+#define UPLOAD_MAX_RANGES 16
+
+void addSessionStatus(JsonDocument& doc) {
+    static uint16_t ranges[UPLOAD_MAX_RANGES][2];
+    doc["session"] = ImageBuffer_SessionId();
+    doc["size"] = IMAGE_BUFFER_SIZE;
+    doc["block_size"] = UPLOAD_BLOCK_SIZE;
+    doc["received"] = ImageBuffer_SessionReceivedBytes();
+    doc["complete"] = ImageBuffer_IsReady();
+    JsonArray missing = doc.createNestedArray("missing");
+    uint8_t count = ImageBuffer_MissingRanges(ranges, UPLOAD_MAX_RANGES);
+    for (uint8_t i = 0; i < count; i++) {
+        JsonArray range = missing.createNestedArray();
+        range.add(ranges[i][0]);
+        range.add(ranges[i][1]);
     }
-    return 0;
 }
 
-// POST /api/upload - Upload image data (1-bit packed format)
-// Data is encoded as pairs of chars: each char is 'a' + nibble value
-// First char = low nibble, second char = high nibble
-void handleApiUpload(WebServer* server) {
-    if (!server->hasArg("plain")) {
-        sendJsonError(server, 400, "No data received");
+// POST /api/upload/session - Open an upload session, dropping the buffer
+// and any earlier session. X-Image-CRC (hex) is the CRC-CCITT of the whole
+// frame, checked once every block is in.
+void handleApiUploadSessionStart(WebServer* server) {
+    bool hasCrc = server->hasHeader("X-Image-CRC");
+    uint16_t crc = hasCrc ? strtol(server->header("X-Image-CRC").c_str(), nullptr, 16) : 0;
+    uint16_t id = ImageBuffer_BeginSession(hasCrc, crc);
+    uploadTiming = {UPLOAD_BINARY, (uint32_t)millis(), 0, 0};
+    LOG_I("Upload session %u opened%s", id, hasCrc ? " with frame CRC" : "");
+
+    sendCorsHeaders(server);
+    StaticJsonDocument<1024> doc;
+    doc["status"] = "success";
+    addSessionStatus(doc);
+    sendJsonDocument(server, 200, doc);
+}
+
+// GET /api/upload/session - Progress of the open session
+void handleApiUploadSessionStatus(WebServer* server) {
+    if (ImageBuffer_SessionId() == 0) {
+        sendJsonError(server, 404, "No upload session");
         return;
     }
+    sendCorsHeaders(server);
+    StaticJsonDocument<1024> doc;
+    doc["status"] = "success";
+    addSessionStatus(doc);
+    sendJsonDocument(server, 200, doc);
+}
+
+// Session chunk done: keep it if it checks out, then try to commit the frame
+void handleApiUploadSessionChunk(WebServer* server) {
+    const char* error = upload.refused;
+    int code = upload.refused ? upload.refusedCode : 400;
+    uint16_t end = upload.startIndex + upload.received;
+    if (error) {
+        // Nothing was written
+    } else if (upload.received == 0 && !upload.overflow) {
+        error = "Empty data";
+    } else if (upload.overflow) {
+        error = "Upload exceeds image buffer";
+        code = 413;
+    } else if (upload.lowNibble >= 0) {
+        error = "Odd number of nibbles";
+    } else if (upload.literal > 0 || upload.repeat > 0) {
+        error = "Truncated PackBits run";
+    } else if (end % UPLOAD_BLOCK_SIZE != 0 && end != IMAGE_BUFFER_SIZE) {
+        error = "Chunk does not end on a block boundary";
+    } else if (strtol(server->header("X-Chunk-CRC").c_str(), nullptr, 16) != upload.crc) {
+        error = "CRC mismatch";
+    }
 
-    String body = server->arg("plain");
+    if (error) {
+        // Whatever was written is suspect: those blocks are missing again
+        if (!upload.refused) ImageBuffer_MarkBlocks(upload.startIndex, upload.received, false);
+        LOG_W("Session chunk at %u rejected: %s", upload.startIndex, error);
+        sendJsonError(server, code, error);
+        return;
+    }
 
-    // Check if this is the start of a new upload - clear buffer completely
-    if (server->hasHeader("X-Upload-Start")) {
-        ImageBuffer_Clear();  // Clear to 0x00 (black) - actual image data will overwrite
-        memset(ImageBuffer_GetPtr(), 0x00, IMAGE_BUFFER_SIZE);  // Ensure clean slate
-        ImageBuffer_Reset();
-        Serial.println("Starting new image upload - buffer cleared");
+    ImageBuffer_MarkBlocks(upload.startIndex, upload.received, true);
+    LOG_D("Session chunk at %u: %u bytes", upload.startIndex, upload.received);
+    if (ImageBuffer_CommitSession() && uploadTiming.elapsedMs == 0) {
+        uploadTiming.elapsedMs = max(1UL, millis() - uploadTiming.startMs);
+        LOG_I("Upload complete: session, %u bytes on the wire, %u ms",
+              (unsigned)uploadTiming.wireBytes, (unsigned)uploadTiming.elapsedMs);
     }
 
-    int len = body.length();
-    if (len == 0) {
-        sendJsonError(server, 400, "Empty data");
+    sendCorsHeaders(server);
+    StaticJsonDocument<1024> doc;
+    doc["status"] = "success";
+    doc["format"] = uploadFormatNames[upload.format];
+    doc["offset"] = upload.startIndex;
+    doc["length"] = upload.received;
+    addSessionStatus(doc);
+    if (ImageBuffer_IsReady()) {
+        doc["wire_bytes"] = uploadTiming.wireBytes;
+        doc["elapsed_ms"] = uploadTiming.elapsedMs;
+    }
+    sendJsonDocument(server, 200, doc);
+}
+
+// POST /api/upload - Upload image data (1-bit packed format), answered
+// once the body has streamed through handleApiUploadBody. A whole image
+// can come in one request (binary, packbits) or as a sequence appended to
+// the buffer (any format, the first with X-Upload-Start). With an
+// X-Chunk-CRC header (CRC-CCITT of the decoded bytes, hex) the request is
+// verified; a rejected request is rolled back so it can simply be resent.
+// Requests with X-Upload-Session are session chunks instead, written at
+// X-Upload-Offset in any order.
+void handleApiUpload(WebServer* server) {
+    if (upload.inSession) {
+        handleApiUploadSessionChunk(server);
         return;
     }
 
-    // Decode nibble-encoded data (matching original format)
-    // Each byte is encoded as 2 chars: low_nibble+'a', high_nibble+'a'
-    uint8_t chunk[UPLOAD_CHUNK_SIZE];
-    uint16_t chunkLen = 0;
+    const char* error = upload.refused;
+    int code = upload.refused ? upload.refusedCode : 400;
+    if (error) {
+        // Nothing was written
+    } else if (upload.received == 0 && !upload.overflow) {
+        error = "Empty data";
+    } else if (upload.overflow) {
+        error = "Upload exceeds image buffer";
+        code = 413;
+    } else if (upload.lowNibble >= 0) {
+        error = "Odd number of nibbles";
+    } else if (upload.literal > 0 || upload.repeat > 0) {
+        error = "Truncated PackBits run";
+    } else if (server->hasHeader("X-Chunk-CRC") &&
+               strtol(server->header("X-Chunk-CRC").c_str(), nullptr, 16) != upload.crc) {
+        error = "CRC mismatch";
+    }
 
-    for (int i = 0; i < len - 1 && chunkLen < UPLOAD_CHUNK_SIZE; i += 2) {
-        uint8_t lowNibble = decodeNibble(body[i]);
-        uint8_t highNibble = decodeNibble(body[i + 1]);
-        chunk[chunkLen++] = lowNibble | (highNibble << 4);
+    if (error) {
+        if (!upload.refused) ImageBuffer_Rewind(upload.startIndex);
+        LOG_W("Upload chunk rejected: %s", error);
+        sendJsonError(server, code, error);
+        return;
     }
 
-    if (chunkLen > 0) {
-        // Debug: print first few bytes of this chunk
-        Serial.printf("Chunk data (first 8 bytes): ");
-        for (int i = 0; i < min(8, (int)chunkLen); i++) {
-            Serial.printf("%02X ", chunk[i]);
-        }
-        Serial.println();
+    LOG_D("Received %d bytes, total: %d", upload.received, ImageBuffer_GetFillLevel());
 
-        ImageBuffer_Receive(chunk, chunkLen);
-        Serial.printf("Received %d bytes, total: %d\n", chunkLen, ImageBuffer_GetFillLevel());
+    if (ImageBuffer_IsReady() && uploadTiming.elapsedMs == 0) {
+        uploadTiming.elapsedMs = max(1UL, millis() - uploadTiming.startMs);
+        LOG_I("Upload complete: %s, %u bytes on the wire, %u ms", uploadFormatNames[uploadTiming.format],
+              (unsigned)uploadTiming.wireBytes, (unsigned)uploadTiming.elapsedMs);
     }
 
     sendCorsHeaders(server);
     StaticJsonDocument<256> doc;
     doc["status"] = "success";
-    doc["received"] = chunkLen;
+    doc["format"] = uploadFormatNames[upload.format];
+    doc["received"] = upload.received;
     doc["total"] = ImageBuffer_GetFillLevel();
     doc["complete"] = ImageBuffer_IsReady();
-
-    String response;
-    serializeJson(doc, response);
-    server->send(200, "application/json", response);
+    if (ImageBuffer_IsReady()) {
+        doc["wire_bytes"] = uploadTiming.wireBytes;
+        doc["elapsed_ms"] = uploadTiming.elapsedMs;
+    }
+    sendJsonDocument(server, 200, doc);
 }
 
-// POST /api/display - Display the buffered image
+// POST /api/display - Display the buffered image. Only a complete frame
+// (verified, for a session) is shown; a half-uploaded one stays off the panel.
 void handleApiDisplay(WebServer* server) {
     if (!ImageBuffer_IsReady()) {
-        // If buffer is not full but has some data, use it anyway
-        if (ImageBuffer_GetFillLevel() == 0) {
+        if (ImageBuffer_SessionId() != 0) {
+            sendJsonError(server, 409, "Upload session incomplete");
+        } else if (ImageBuffer_GetFillLevel() == 0) {
             sendJsonError(server, 400, "No image data in buffer");
-            return;
+        } else {
+            sendJsonError(server, 409, "Image data incomplete");
         }
+        return;
     }
 
-    // Debug: print first 16 bytes of buffer
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+    // Scanning the whole buffer costs a few ms; debug builds only
     uint8_t* buf = ImageBuffer_GetPtr();
-    Serial.printf("Buffer before display (first 16 bytes): ");
-    for (int i = 0; i < 16; i++) {
-        Serial.printf("%02X ", buf[i]);
-    }
-    Serial.println();
-
-    // Count non-zero bytes
+    logHexDump("Buffer before display", buf, 16);
     int nonZero = 0;
     for (int i = 0; i < IMAGE_BUFFER_SIZE; i++) {
         if (buf[i] != 0) nonZero++;
     }
-    Serial.printf("Non-zero bytes in buffer: %d of %d\n", nonZero, IMAGE_BUFFER_SIZE);
+    LOG_D("Non-zero bytes in buffer: %d of %d", nonZero, IMAGE_BUFFER_SIZE);
+#endif
 
     EPD_4in2_V2_Display(ImageBuffer_GetPtr());
     sendJsonSuccess(server, "Image displayed");
@@ -210,9 +412,14 @@ void handleOptions(WebServer* server) {
     server->send(204);
 }
 
-// Captive portal redirect
+// Captive portal redirect (URL built once instead of per request)
 void handleCaptive(WebServer* server) {
-    server->sendHeader("Location", String("http://") + AP_LOCAL_IP.toString(), true);
+    static char location[24] = "";
+    if (!location[0]) {
+        snprintf(location, sizeof(location), "http://%u.%u.%u.%u",
+                 AP_LOCAL_IP[0], AP_LOCAL_IP[1], AP_LOCAL_IP[2], AP_LOCAL_IP[3]);
+    }
+    server->sendHeader("Location", location, true);
     server->send(302, "text/plain", "");
 }
 
@@ -221,8 +428,9 @@ void handleCaptive(WebServer* server) {
 // ===========================================
 void setupWebServer(WebServer* server) {
     // Register custom headers to be collected
-    const char* headerKeys[] = {"X-Upload-Start"};
-    server->collectHeaders(headerKeys, 1);
+    const char* headerKeys[] = {"Content-Type", "X-Encoding", "X-Upload-Start", "X-Chunk-CRC",
+                                "X-Upload-Session", "X-Upload-Offset", "X-Image-CRC", "If-None-Match"};
+    server->collectHeaders(headerKeys, 8);
 
     // Main page routes
     server->on("/", HTTP_GET, [server]() { handleRoot(server); });
@@ -232,7 +440,10 @@ void setupWebServer(WebServer* server) {
     // API routes
     server->on("/api/status", HTTP_GET, [server]() { handleApiStatus(server); });
     server->on("/api/clear", HTTP_POST, [server]() { handleApiClear(server); });
-    server->on("/api/upload", HTTP_POST, [server]() { handleApiUpload(server); });
+    server->on("/api/upload", HTTP_POST, [server]() { handleApiUpload(server); },
+               [server]() { handleApiUploadBody(server); });
+    server->on("/api/upload/session", HTTP_POST, [server]() { handleApiUploadSessionStart(server); });
+    server->on("/api/upload/session", HTTP_GET, [server]() { handleApiUploadSessionStatus(server); });
     server->on("/api/display", HTTP_POST, [server]() { handleApiDisplay(server); });
     server->on("/api/sleep", HTTP_POST, [server]() { handleApiSleep(server); });
     server->on("/api/test", HTTP_POST, [server]() { handleApiTest(server); });
@@ -241,6 +452,7 @@ void setupWebServer(WebServer* server) {
     server->on("/api/status", HTTP_OPTIONS, [server]() { handleOptions(server); });
     server->on("/api/clear", HTTP_OPTIONS, [server]() { handleOptions(server); });
     server->on("/api/upload", HTTP_OPTIONS, [server]() { handleOptions(server); });
+    server->on("/api/upload/session", HTTP_OPTIONS, [server]() { handleOptions(server); });
     server->on("/api/display", HTTP_OPTIONS, [server]() { handleOptions(server); });
     server->on("/api/sleep", HTTP_OPTIONS, [server]() { handleOptions(server); });
     server->on("/api/test", HTTP_OPTIONS, [server]() { handleOptions(server); });